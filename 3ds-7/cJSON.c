@@ -44,9 +44,28 @@
 #include <limits.h>
 #include <ctype.h>
 #include <float.h>
+#include <errno.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
-#ifdef ENABLE_LOCALES
-#include <locale.h>
+/* vector instruction sets used to scan the input, define CJSON_DISABLE_SIMD to force the scalar code */
+#if !defined(CJSON_DISABLE_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CJSON_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CJSON_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CJSON_SIMD_NEON
+#endif
+#endif
+#if defined(_MSC_VER) && (defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2))
+#include <intrin.h>
 #endif
 
 #if defined(_MSC_VER)
@@ -57,6 +76,9 @@
 #endif
 
 #include "cJSON.h"
+#if CJSON_THREADS
+#include <pthread.h>
+#endif
 
 /* define our own boolean type */
 #ifdef true
@@ -89,13 +111,6 @@ typedef struct {
     const unsigned char *json;
     size_t position;
 } error;
-static error global_error = { NULL, 0 };
-
-CJSON_PUBLIC(const char *) cJSON_GetErrorPtr(void)
-{
-    return (const char*) (global_error.json + global_error.position);
-}
-
 CJSON_PUBLIC(char *) cJSON_GetStringValue(const cJSON * const item)
 {
     if (!cJSON_IsString(item))
@@ -183,3001 +198,9773 @@ static void * CJSON_CDECL internal_realloc(void *pointer, size_t size)
 /* strlen of character literals resolved at compile time */
 #define static_strlen(string_literal) (sizeof(string_literal) - sizeof(""))
 
-static internal_hooks global_hooks = { internal_malloc, internal_free, internal_realloc };
+/* interned keys are packed into blocks that are only freed with the context */
+typedef struct key_block
+{
+    struct key_block *next;
+    size_t used;
+    size_t size;
+} key_block;
 
-static unsigned char* cJSON_strdup(const unsigned char* string, const internal_hooks * const hooks)
+/* open addressing set of interned keys, at most half full */
+typedef struct
 {
-    size_t length = 0;
-    unsigned char *copy = NULL;
+    char **slots;
+    size_t capacity;
+    size_t count;
+    key_block *blocks;
+} key_table;
 
-    if (string == NULL)
-    {
-        return NULL;
-    }
+struct cJSON_Context
+{
+    internal_hooks hooks;
+    error last_error;
+    size_t nesting_limit;
+    int options;
+    key_table keys;
+};
 
-    length = strlen((const char*)string) + sizeof("");
-    copy = (unsigned char*)hooks->allocate(length);
-    if (copy == NULL)
+/* the context used by all functions without a context parameter */
+static cJSON_Context global_context = { { internal_malloc, internal_free, internal_realloc }, { NULL, 0 }, CJSON_NESTING_LIMIT, 0, { NULL, 0, 0, NULL } };
+#define global_hooks (global_context.hooks)
+#define global_error (global_context.last_error)
+
+CJSON_PUBLIC(const char *) cJSON_GetErrorPtr(void)
+{
+    return cJSON_GetContextErrorPtr(&global_context);
+}
+
+CJSON_PUBLIC(const char *) cJSON_GetContextErrorPtr(const cJSON_Context *context)
+{
+    if (context == NULL)
     {
         return NULL;
     }
-    memcpy(copy, string, length);
 
-    return copy;
+    return (const char*) (context->last_error.json + context->last_error.position);
 }
 
-CJSON_PUBLIC(void) cJSON_InitHooks(cJSON_Hooks* hooks)
+#if CJSON_POOL
+#if defined(CJSON_THREAD_LOCAL)
+/* provided by the build */
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define CJSON_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+#define CJSON_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define CJSON_THREAD_LOCAL __thread
+#else
+/* single threaded targets like the consoles */
+#define CJSON_THREAD_LOCAL
+#endif
+
+/* Strings of up to 64 bytes that cJSON only uses while parsing are allocated with the full size of their
+ * size_class, so the length of a string tells a size_class its block is at least as large as, even after
+ * decoding has shortened it. */
+#define POOL_STRING_CLASSES 3
+#define pool_class_size(size_class) (((size_t)16) << (size_class))
+/* different hooks, as used by contexts, keep separate free lists */
+#define POOL_HOOK_SETS 4
+
+typedef struct pool_block
 {
-    if (hooks == NULL)
-    {
-        /* Reset hooks */
-        global_hooks.allocate = malloc;
-        global_hooks.deallocate = free;
-        global_hooks.reallocate = realloc;
-        return;
-    }
+    struct pool_block *next;
+} pool_block;
 
-    global_hooks.allocate = malloc;
-    if (hooks->malloc_fn != NULL)
-    {
-        global_hooks.allocate = hooks->malloc_fn;
-    }
+typedef struct
+{
+    /* the cached blocks belong to the allocator of these hooks */
+    void (CJSON_CDECL *deallocate)(void *pointer);
+    pool_block *nodes;
+    pool_block *strings[POOL_STRING_CLASSES];
+    size_t cached_nodes;
+    size_t cached_strings;
+    size_t cached_bytes;
+} hook_pool;
 
-    global_hooks.deallocate = free;
-    if (hooks->free_fn != NULL)
+typedef struct
+{
+    hook_pool sets[POOL_HOOK_SETS];
+    size_t cached_bytes;
+    size_t reused;
+    size_t allocated;
+    cJSON_bool registered; /* for the thread exit destructor */
+} node_pool;
+
+static CJSON_THREAD_LOCAL node_pool pool;
+
+static void pool_trim_set(hook_pool * const set, const size_t keep_bytes)
+{
+    int size_class = 0;
+
+    while ((pool.cached_bytes > keep_bytes) && (set->nodes != NULL))
     {
-        global_hooks.deallocate = hooks->free_fn;
+        pool_block *block = set->nodes;
+        set->nodes = block->next;
+        set->cached_nodes--;
+        set->cached_bytes -= sizeof(cJSON);
+        pool.cached_bytes -= sizeof(cJSON);
+        set->deallocate(block);
     }
 
-    /* use realloc only if both free and malloc are used */
-    global_hooks.reallocate = NULL;
-    if ((global_hooks.allocate == malloc) && (global_hooks.deallocate == free))
+    /* the largest strings first */
+    for (size_class = POOL_STRING_CLASSES - 1; size_class >= 0; size_class--)
     {
-        global_hooks.reallocate = realloc;
+        while ((pool.cached_bytes > keep_bytes) && (set->strings[size_class] != NULL))
+        {
+            pool_block *block = set->strings[size_class];
+            set->strings[size_class] = block->next;
+            set->cached_strings--;
+            set->cached_bytes -= pool_class_size(size_class);
+            pool.cached_bytes -= pool_class_size(size_class);
+            set->deallocate(block);
+        }
     }
 }
 
-/* Internal constructor. */
-static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
+static void pool_trim(const size_t keep_bytes)
 {
-    cJSON* node = (cJSON*)hooks->allocate(sizeof(cJSON));
-    if (node)
+    size_t index = 0;
+
+    for (index = 0; index < POOL_HOOK_SETS; index++)
     {
-        memset(node, '\0', sizeof(cJSON));
+        pool_trim_set(&pool.sets[index], keep_bytes);
     }
+}
 
-    return node;
+#if CJSON_THREADS
+static pthread_key_t pool_key;
+static pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+static cJSON_bool pool_key_created = false;
+
+/* give the cache of an exiting thread back to the allocator */
+static void pool_thread_exit(void *unused)
+{
+    (void)unused;
+    pool_trim(0);
 }
 
-/* Delete a cJSON structure. */
-CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
+static void pool_create_key(void)
 {
-    cJSON *next = NULL;
-    while (item != NULL)
+    pool_key_created = (pthread_key_create(&pool_key, pool_thread_exit) == 0);
+}
+#endif
+
+/* the free lists of the hooks, claim an empty set for them if they have none and claim is set */
+static hook_pool *pool_hooks(const internal_hooks * const hooks, const cJSON_bool claim)
+{
+    hook_pool *unused = NULL;
+    size_t index = 0;
+
+    for (index = 0; index < POOL_HOOK_SETS; index++)
     {
-        next = item->next;
-        if (!(item->type & cJSON_IsReference) && (item->child != NULL))
-        {
-            cJSON_Delete(item->child);
-        }
-        if (!(item->type & cJSON_IsReference) && (item->valuestring != NULL))
+        hook_pool * const set = &pool.sets[index];
+        if (set->deallocate == hooks->deallocate)
         {
-            global_hooks.deallocate(item->valuestring);
-            item->valuestring = NULL;
+            return set;
         }
-        if (!(item->type & cJSON_StringIsConst) && (item->string != NULL))
+        if ((unused == NULL) && (set->cached_bytes == 0))
         {
-            global_hooks.deallocate(item->string);
-            item->string = NULL;
+            unused = set;
         }
-        global_hooks.deallocate(item);
-        item = next;
     }
+
+    if (!claim || (unused == NULL))
+    {
+        return NULL;
+    }
+    unused->deallocate = hooks->deallocate;
+
+    return unused;
 }
 
-/* get the decimal point character of the current locale */
-static unsigned char get_decimal_point(void)
+/* size_class -1 is the node list */
+static pool_block **pool_list(hook_pool * const set, const int size_class)
 {
-#ifdef ENABLE_LOCALES
-    struct lconv *lconv = localeconv();
-    return (unsigned char) lconv->decimal_point[0];
-#else
-    return '.';
-#endif
+    return (size_class < 0) ? &set->nodes : &set->strings[size_class];
 }
 
-typedef struct
+static void *pool_take(const int size_class, const size_t size, const internal_hooks * const hooks)
 {
-    const unsigned char *content;
-    size_t length;
-    size_t offset;
-    size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
-    internal_hooks hooks;
-} parse_buffer;
-
-/* check if the given size is left to read in a given parse buffer (starting with 1) */
-#define can_read(buffer, size) ((buffer != NULL) && (((buffer)->offset + size) <= (buffer)->length))
-/* check if the buffer can be accessed at the given index (starting with 0) */
-#define can_access_at_index(buffer, index) ((buffer != NULL) && (((buffer)->offset + index) < (buffer)->length))
-#define cannot_access_at_index(buffer, index) (!can_access_at_index(buffer, index))
-/* get a pointer to the buffer at the position */
-#define buffer_at_offset(buffer) ((buffer)->content + (buffer)->offset)
+    hook_pool * const set = pool_hooks(hooks, false);
+    pool_block **list = NULL;
+    pool_block *block = NULL;
 
-/* Parse the input text to generate a number, and populate the result into item. */
-static cJSON_bool parse_number(cJSON * const item, parse_buffer * const input_buffer)
-{
-    double number = 0;
-    unsigned char *after_end = NULL;
-    unsigned char *number_c_string;
-    unsigned char decimal_point = get_decimal_point();
-    size_t i = 0;
-    size_t number_string_length = 0;
-    cJSON_bool has_decimal_point = false;
+    if (set != NULL)
+    {
+        list = pool_list(set, size_class);
+    }
+    if ((list == NULL) || (*list == NULL))
+    {
+        pool.allocated++;
+        return hooks->allocate(size);
+    }
 
-    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    block = *list;
+    *list = block->next;
+    if (size_class < 0)
     {
-        return false;
+        set->cached_nodes--;
+    }
+    else
+    {
+        set->cached_strings--;
     }
+    set->cached_bytes -= size;
+    pool.cached_bytes -= size;
+    pool.reused++;
 
-    /* copy the number into a temporary buffer and replace '.' with the decimal point
-     * of the current locale (for strtod)
-     * This also takes care of '\0' not necessarily being available for marking the end of the input */
-    for (i = 0; can_access_at_index(input_buffer, i); i++)
-    {
-        switch (buffer_at_offset(input_buffer)[i])
-        {
-            case '0':
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-            case '8':
-            case '9':
-            case '+':
-            case '-':
-            case 'e':
-            case 'E':
-                number_string_length++;
-                break;
+    return block;
+}
 
-            case '.':
-                number_string_length++;
-                has_decimal_point = true;
-                break;
+static void pool_give(const int size_class, const size_t size, void * const pointer, const internal_hooks * const hooks)
+{
+    pool_block * const block = (pool_block*)pointer;
+    hook_pool *set = NULL;
+    pool_block **list = NULL;
 
-            default:
-                goto loop_end;
-        }
+    if ((pool.cached_bytes + size) > CJSON_POOL_LIMIT)
+    {
+        hooks->deallocate(pointer);
+        return;
     }
-loop_end:
-    /* malloc for temporary buffer, add 1 for '\0' */
-    number_c_string = (unsigned char *) input_buffer->hooks.allocate(number_string_length + 1);
-    if (number_c_string == NULL)
+    set = pool_hooks(hooks, true);
+    if (set == NULL)
     {
-        return false; /* allocation failure */
+        /* every set caches blocks of other hooks */
+        hooks->deallocate(pointer);
+        return;
     }
 
-    memcpy(number_c_string, buffer_at_offset(input_buffer), number_string_length);
-    number_c_string[number_string_length] = '\0';
-
-    if (has_decimal_point)
+#if CJSON_THREADS
+    if (!pool.registered)
     {
-        for (i = 0; i < number_string_length; i++)
+        pool.registered = true;
+        pthread_once(&pool_key_once, pool_create_key);
+        if (pool_key_created)
         {
-            if (number_c_string[i] == '.')
-            {
-                /* replace '.' with the decimal point of the current locale (for strtod) */
-                number_c_string[i] = decimal_point;
-            }
+            pthread_setspecific(pool_key, &pool);
         }
     }
+#endif
 
-    number = strtod((const char*)number_c_string, (char**)&after_end);
-    if (number_c_string == after_end)
-    {
-        /* free the temporary buffer */
-        input_buffer->hooks.deallocate(number_c_string);
-        return false; /* parse_error */
-    }
-
-    item->valuedouble = number;
-
-    /* use saturation in case of overflow */
-    if (number >= INT_MAX)
+    list = pool_list(set, size_class);
+    block->next = *list;
+    *list = block;
+    if (size_class < 0)
     {
-        item->valueint = INT_MAX;
+        set->cached_nodes++;
     }
-    else if (number <= (double)INT_MIN)
+    else
     {
-        item->valueint = INT_MIN;
+        set->cached_strings++;
     }
-    else
+    set->cached_bytes += size;
+    pool.cached_bytes += size;
+}
+
+/* size size_class for a string of size bytes, -1 if it is too large */
+static int pool_string_class(const size_t size)
+{
+    int size_class = 0;
+
+    for (size_class = 0; size_class < POOL_STRING_CLASSES; size_class++)
     {
-        item->valueint = (int)number;
+        if (size <= pool_class_size(size_class))
+        {
+            return size_class;
+        }
     }
 
-    item->type = cJSON_Number;
+    return -1;
+}
+#endif
 
-    input_buffer->offset += (size_t)(after_end - number_c_string);
-    /* free the temporary buffer */
-    input_buffer->hooks.deallocate(number_c_string);
-    return true;
+static void *allocate_node(const internal_hooks * const hooks)
+{
+#if CJSON_POOL
+    return pool_take(-1, sizeof(cJSON), hooks);
+#else
+    return hooks->allocate(sizeof(cJSON));
+#endif
 }
 
-/* don't ask me, but the original cJSON_SetNumberValue returns an integer or double */
-CJSON_PUBLIC(double) cJSON_SetNumberHelper(cJSON *object, double number)
+static void free_node(cJSON * const node, const internal_hooks * const hooks)
 {
-    if (number >= INT_MAX)
-    {
-        object->valueint = INT_MAX;
-    }
-    else if (number <= (double)INT_MIN)
+#if CJSON_POOL
+    pool_give(-1, sizeof(cJSON), node, hooks);
+#else
+    hooks->deallocate(node);
+#endif
+}
+
+/* Allocate a string that is released with free_string before parsing returns. Strings that end up in an item
+ * are allocated with their exact size instead, they never come back to the pool. */
+static void *allocate_string(const size_t size, const internal_hooks * const hooks)
+{
+#if CJSON_POOL
+    const int size_class = pool_string_class(size);
+    if (size_class >= 0)
     {
-        object->valueint = INT_MIN;
+        return pool_take(size_class, pool_class_size(size_class), hooks);
     }
-    else
+#endif
+
+    return hooks->allocate(size);
+}
+
+/* Release a string allocated with allocate_string. The size_class comes from the length, so strings an item
+ * points to can't go through here: the user may have replaced them with a block of any size. */
+static void free_string(char * const string, const internal_hooks * const hooks)
+{
+#if CJSON_POOL
+    const int size_class = pool_string_class(strlen(string) + sizeof(""));
+    if (size_class >= 0)
     {
-        object->valueint = (int)number;
+        pool_give(size_class, pool_class_size(size_class), string, hooks);
+        return;
     }
+#endif
 
-    return object->valuedouble = number;
+    hooks->deallocate(string);
 }
 
-/* Note: when passing a NULL valuestring, cJSON_SetValuestring treats this as an error and return NULL */
-CJSON_PUBLIC(char*) cJSON_SetValuestring(cJSON *object, const char *valuestring)
+static unsigned char* cJSON_strdup(const unsigned char* string, const internal_hooks * const hooks)
 {
-    char *copy = NULL;
-    size_t v1_len;
-    size_t v2_len;
-    /* if object's type is not cJSON_String or is cJSON_IsReference, it should not set valuestring */
-    if ((object == NULL) || !(object->type & cJSON_String) || (object->type & cJSON_IsReference))
+    size_t length = 0;
+    unsigned char *copy = NULL;
+
+    if (string == NULL)
     {
         return NULL;
     }
-    /* return NULL if the object is corrupted or valuestring is NULL */
-    if (object->valuestring == NULL || valuestring == NULL)
+
+    length = strlen((const char*)string) + sizeof("");
+    copy = (unsigned char*)hooks->allocate(length);
+    if (copy == NULL)
     {
         return NULL;
     }
+    memcpy(copy, string, length);
 
-    v1_len = strlen(valuestring);
-    v2_len = strlen(object->valuestring);
+    return copy;
+}
 
-    if (v1_len <= v2_len)
+static void set_hooks(internal_hooks * const target, const cJSON_Hooks * const hooks)
+{
+    if (hooks == NULL)
     {
-        /* strcpy does not handle overlapping string: [X1, X2] [Y1, Y2] => X2 < Y1 or Y2 < X1 */
-        if (!( valuestring + v1_len < object->valuestring || object->valuestring + v2_len < valuestring ))
-        {
-            return NULL;
-        }
-        strcpy(object->valuestring, valuestring);
-        return object->valuestring;
+        /* Reset hooks */
+        target->allocate = malloc;
+        target->deallocate = free;
+        target->reallocate = realloc;
+        return;
     }
-    copy = (char*) cJSON_strdup((const unsigned char*)valuestring, &global_hooks);
-    if (copy == NULL)
+
+    target->allocate = malloc;
+    if (hooks->malloc_fn != NULL)
     {
-        return NULL;
+        target->allocate = hooks->malloc_fn;
     }
-    if (object->valuestring != NULL)
+
+    target->deallocate = free;
+    if (hooks->free_fn != NULL)
     {
-        cJSON_free(object->valuestring);
+        target->deallocate = hooks->free_fn;
     }
-    object->valuestring = copy;
 
-    return copy;
+    /* use realloc only if both free and malloc are used */
+    target->reallocate = NULL;
+    if ((target->allocate == malloc) && (target->deallocate == free))
+    {
+        target->reallocate = realloc;
+    }
 }
 
-typedef struct
+CJSON_PUBLIC(void) cJSON_InitHooks(cJSON_Hooks* hooks)
 {
-    unsigned char *buffer;
-    size_t length;
-    size_t offset;
-    size_t depth; /* current nesting depth (for formatted printing) */
-    cJSON_bool noalloc;
-    cJSON_bool format; /* is this print a formatted print */
-    internal_hooks hooks;
-} printbuffer;
+#if CJSON_POOL
+    /* cached memory has to go back to the allocator it came from, which may go away with these hooks */
+    hook_pool * const set = pool_hooks(&global_hooks, false);
+    if (set != NULL)
+    {
+        pool_trim_set(set, 0);
+    }
+#endif
 
-/* realloc printbuffer if necessary to have at least "needed" bytes more */
-static unsigned char* ensure(printbuffer * const p, size_t needed)
+    set_hooks(&global_hooks, hooks);
+}
+
+CJSON_PUBLIC(cJSON_Context *) cJSON_CreateContext(const cJSON_Hooks *hooks)
 {
-    unsigned char *newbuffer = NULL;
-    size_t newsize = 0;
+    internal_hooks context_hooks;
+    cJSON_Context *context = NULL;
 
-    if ((p == NULL) || (p->buffer == NULL))
+    set_hooks(&context_hooks, hooks);
+    context = (cJSON_Context*)context_hooks.allocate(sizeof(cJSON_Context));
+    if (context == NULL)
     {
         return NULL;
     }
 
-    if ((p->length > 0) && (p->offset >= p->length))
-    {
-        /* make sure that offset is valid */
-        return NULL;
-    }
+    context->hooks = context_hooks;
+    context->last_error.json = NULL;
+    context->last_error.position = 0;
+    context->nesting_limit = CJSON_NESTING_LIMIT;
+    context->options = 0;
+    memset(&context->keys, '\0', sizeof(key_table));
 
-    if (needed > INT_MAX)
+    return context;
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteContext(cJSON_Context *context)
+{
+    key_block *block = NULL;
+
+    if ((context == NULL) || (context == &global_context))
     {
-        /* sizes bigger than INT_MAX are currently not supported */
-        return NULL;
+        return;
     }
 
-    needed += p->offset + 1;
-    if (needed <= p->length)
+    block = context->keys.blocks;
+    while (block != NULL)
     {
-        return p->buffer + p->offset;
+        key_block *next = block->next;
+        context->hooks.deallocate(block);
+        block = next;
+    }
+    if (context->keys.slots != NULL)
+    {
+        context->hooks.deallocate(context->keys.slots);
     }
 
-    if (p->noalloc) {
-        return NULL;
+    context->hooks.deallocate(context);
+}
+
+static size_t hash_key(const unsigned char * const key, const size_t length)
+{
+    /* FNV-1a */
+    size_t hash = (size_t)2166136261u;
+    size_t i = 0;
+
+    for (i = 0; i < length; i++)
+    {
+        hash = (hash ^ key[i]) * (size_t)16777619u;
     }
 
-    /* calculate new buffer size */
-    if (needed > (INT_MAX / 2))
+    return hash;
+}
+
+/* returns the table's copy of the length bytes at key, adding it if needed */
+static char *intern_key(key_table * const table, const internal_hooks * const hooks, const unsigned char * const key, const size_t length)
+{
+    size_t slot = 0;
+    char *copy = NULL;
+
+    /* grow at half load, which also creates the table */
+    if ((table->count * 2) >= table->capacity)
     {
-        /* overflow of int, use INT_MAX if possible */
-        if (needed <= INT_MAX)
+        const size_t capacity = (table->capacity == 0) ? 64 : (table->capacity * 2);
+        char **slots = (char**)hooks->allocate(capacity * sizeof(char*));
+        size_t i = 0;
+
+        if (slots == NULL)
         {
-            newsize = INT_MAX;
+            return NULL;
         }
-        else
+        memset(slots, '\0', capacity * sizeof(char*));
+        for (i = 0; i < table->capacity; i++)
         {
-            return NULL;
+            if (table->slots[i] != NULL)
+            {
+                slot = hash_key((const unsigned char*)table->slots[i], strlen(table->slots[i])) & (capacity - 1);
+                while (slots[slot] != NULL)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                slots[slot] = table->slots[i];
+            }
         }
-    }
-    else
-    {
-        newsize = needed * 2;
+        if (table->slots != NULL)
+        {
+            hooks->deallocate(table->slots);
+        }
+        table->slots = slots;
+        table->capacity = capacity;
     }
 
-    if (p->hooks.reallocate != NULL)
+    slot = hash_key(key, length) & (table->capacity - 1);
+    while (table->slots[slot] != NULL)
     {
-        /* reallocate with realloc if available */
-        newbuffer = (unsigned char*)p->hooks.reallocate(p->buffer, newsize);
-        if (newbuffer == NULL)
+        if ((strncmp(table->slots[slot], (const char*)key, length) == 0) && (table->slots[slot][length] == '\0'))
         {
-            p->hooks.deallocate(p->buffer);
-            p->length = 0;
-            p->buffer = NULL;
-
-            return NULL;
+            return table->slots[slot];
         }
+        slot = (slot + 1) & (table->capacity - 1);
     }
-    else
+
+    /* new key, copy it into the current block */
+    if ((table->blocks == NULL) || ((table->blocks->size - table->blocks->used) < (length + 1)))
     {
-        /* otherwise reallocate manually */
-        newbuffer = (unsigned char*)p->hooks.allocate(newsize);
-        if (!newbuffer)
+        const size_t size = (length + 1 > 4096) ? (length + 1) : 4096;
+        key_block *block = (key_block*)hooks->allocate(sizeof(key_block) + size);
+        if (block == NULL)
         {
-            p->hooks.deallocate(p->buffer);
-            p->length = 0;
-            p->buffer = NULL;
-
             return NULL;
         }
-
-        memcpy(newbuffer, p->buffer, p->offset + 1);
-        p->hooks.deallocate(p->buffer);
+        block->used = 0;
+        block->size = size;
+        block->next = table->blocks;
+        table->blocks = block;
     }
-    p->length = newsize;
-    p->buffer = newbuffer;
+    copy = (char*)(table->blocks + 1) + table->blocks->used;
+    memcpy(copy, key, length);
+    copy[length] = '\0';
+    table->blocks->used += length + 1;
 
-    return newbuffer + p->offset;
+    table->slots[slot] = copy;
+    table->count++;
+
+    return copy;
 }
 
-/* calculate the new length of the string in a printbuffer and update the offset */
-static void update_offset(printbuffer * const buffer)
+CJSON_PUBLIC(const char *) cJSON_InternKeyCtx(cJSON_Context *context, const char *key)
 {
-    const unsigned char *buffer_pointer = NULL;
-    if ((buffer == NULL) || (buffer->buffer == NULL))
+    if ((context == NULL) || (context == &global_context) || (key == NULL))
     {
-        return;
+        return NULL;
     }
-    buffer_pointer = buffer->buffer + buffer->offset;
 
-    buffer->offset += strlen((const char*)buffer_pointer);
-}
-
-/* securely comparison of floating-point variables */
-static cJSON_bool compare_double(double a, double b)
-{
-    double maxVal = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
-    return (fabs(a - b) <= maxVal * DBL_EPSILON);
+    return intern_key(&context->keys, &context->hooks, (const unsigned char*)key, strlen(key));
 }
 
-/* Render the number nicely from the given item into a string. */
-static cJSON_bool print_number(const cJSON * const item, printbuffer * const output_buffer)
+CJSON_PUBLIC(size_t) cJSON_GetContextKeyMemory(const cJSON_Context *context)
 {
-    unsigned char *output_pointer = NULL;
-    double d = item->valuedouble;
-    int length = 0;
-    size_t i = 0;
-    unsigned char number_buffer[26] = {0}; /* temporary buffer to print the number into */
-    unsigned char decimal_point = get_decimal_point();
-    double test = 0.0;
+    const key_block *block = NULL;
+    size_t memory = 0;
 
-    if (output_buffer == NULL)
+    if (context == NULL)
     {
-        return false;
+        return 0;
     }
 
-    /* This checks for NaN and Infinity */
-    if (isnan(d) || isinf(d))
-    {
-        length = sprintf((char*)number_buffer, "null");
-    }
-    else if(d == (double)item->valueint)
+    memory = context->keys.capacity * sizeof(char*);
+    for (block = context->keys.blocks; block != NULL; block = block->next)
     {
-        length = sprintf((char*)number_buffer, "%d", item->valueint);
+        memory += sizeof(key_block) + block->size;
     }
-    else
-    {
-        /* Try 15 decimal places of precision to avoid nonsignificant nonzero digits */
-        length = sprintf((char*)number_buffer, "%1.15g", d);
 
-        /* Check whether the original double can be recovered */
-        if ((sscanf((char*)number_buffer, "%lg", &test) != 1) || !compare_double((double)test, d))
-        {
-            /* If not, print with 17 decimal places of precision */
-            length = sprintf((char*)number_buffer, "%1.17g", d);
-        }
-    }
+    return memory;
+}
 
-    /* sprintf failed or buffer overrun occurred */
-    if ((length < 0) || (length > (int)(sizeof(number_buffer) - 1)))
+CJSON_PUBLIC(void) cJSON_SetContextNestingLimit(cJSON_Context *context, size_t limit)
+{
+    if (context != NULL)
     {
-        return false;
+        context->nesting_limit = limit;
     }
+}
 
-    /* reserve appropriate space in the output */
-    output_pointer = ensure(output_buffer, (size_t)length + sizeof(""));
-    if (output_pointer == NULL)
+CJSON_PUBLIC(void) cJSON_SetContextOptions(cJSON_Context *context, int options)
+{
+    if (context != NULL)
     {
-        return false;
+        context->options = options;
     }
+}
 
-    /* copy the printed number to the output and replace locale
-     * dependent decimal point with '.' */
-    for (i = 0; i < ((size_t)length); i++)
+CJSON_PUBLIC(void) cJSON_FreeCtx(cJSON_Context *context, void *object)
+{
+    if ((context != NULL) && (object != NULL))
     {
-        if (number_buffer[i] == decimal_point)
-        {
-            output_pointer[i] = '.';
-            continue;
-        }
-
-        output_pointer[i] = number_buffer[i];
+        context->hooks.deallocate(object);
     }
-    output_pointer[i] = '\0';
+}
 
-    output_buffer->offset += (size_t)length;
+/* Internal constructor. */
+static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
+{
+    cJSON* node = (cJSON*)allocate_node(hooks);
+    if (node)
+    {
+        memset(node, '\0', sizeof(cJSON));
+    }
 
-    return true;
+    return node;
 }
 
-/* parse 4 digit hexadecimal number */
-static unsigned parse_hex4(const unsigned char * const input)
+/* Delete a cJSON structure. */
+static void delete_item(cJSON *item, const internal_hooks * const hooks)
 {
-    unsigned int h = 0;
-    size_t i = 0;
-
-    for (i = 0; i < 4; i++)
+    cJSON *next = NULL;
+    while (item != NULL)
     {
-        /* parse digit */
-        if ((input[i] >= '0') && (input[i] <= '9'))
-        {
-            h += (unsigned int) input[i] - '0';
-        }
-        else if ((input[i] >= 'A') && (input[i] <= 'F'))
+        next = item->next;
+        if (!(item->type & cJSON_IsReference) && (item->child != NULL))
         {
-            h += (unsigned int) 10 + input[i] - 'A';
+            /* queue the children in front of the remaining siblings instead of recursing */
+            cJSON *last_child = item->child;
+            while (last_child->next != NULL)
+            {
+                last_child = last_child->next;
+            }
+            last_child->next = next;
+            next = item->child;
         }
-        else if ((input[i] >= 'a') && (input[i] <= 'f'))
+        /* the strings may have been replaced by the user, so they go to the allocator and not to the pool */
+        if (!(item->type & cJSON_IsReference) && (item->valuestring != NULL))
         {
-            h += (unsigned int) 10 + input[i] - 'a';
+            hooks->deallocate(item->valuestring);
+            item->valuestring = NULL;
         }
-        else /* invalid */
+        if (!(item->type & cJSON_StringIsConst) && (item->string != NULL))
         {
-            return 0;
+            hooks->deallocate(item->string);
+            item->string = NULL;
         }
-
-        if (i < 3)
+#if CJSON_ARRAY_INDEX
+        if (item->array_index != NULL)
         {
-            /* shift left to make place for the next nibble */
-            h = h << 4;
+            /* cJSON_BuildArrayIndex builds the index and the add, insert, detach and replace functions
+             * grow or drop it, all through array_index_allocate, which always uses the global hooks,
+             * whichever hooks or context allocated the items */
+            global_hooks.deallocate(item->array_index);
+            item->array_index = NULL;
         }
+#endif
+        free_node(item, hooks);
+        item = next;
     }
+}
 
-    return h;
+CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
+{
+    delete_item(item, &global_hooks);
 }
 
-/* converts a UTF-16 literal to UTF-8
- * A literal can be one or two sequences of the form \uXXXX */
-static unsigned char utf16_literal_to_utf8(const unsigned char * const input_pointer, const unsigned char * const input_end, unsigned char **output_pointer)
+CJSON_PUBLIC(void) cJSON_DeleteCtx(cJSON_Context *context, cJSON *item)
 {
-    long unsigned int codepoint = 0;
-    unsigned int first_code = 0;
-    const unsigned char *first_sequence = input_pointer;
-    unsigned char utf8_length = 0;
-    unsigned char utf8_position = 0;
-    unsigned char sequence_length = 0;
-    unsigned char first_byte_mark = 0;
+    delete_item(item, (context != NULL) ? &context->hooks : &global_hooks);
+}
 
-    if ((input_end - first_sequence) < 6)
-    {
-        /* input ends unexpectedly */
-        goto fail;
-    }
+typedef struct
+{
+    const unsigned char *content;
+    size_t length;
+    size_t offset;
+    size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
+    internal_hooks hooks;
+    cJSON_bool in_place; /* strings are decoded into the input and referenced from there */
+    size_t nesting_limit;
+    key_table *keys; /* intern object keys here, NULL to allocate each one */
+    cJSON_bool temporary_strings; /* parse_string allocates with allocate_string, the caller frees with free_string */
+} parse_buffer;
 
-    /* get the first utf16 sequence */
-    first_code = parse_hex4(first_sequence + 2);
+static void* cast_away_const(const void* string);
 
-    /* check that the code is valid */
-    if (((first_code >= 0xDC00) && (first_code <= 0xDFFF)))
+/* check if the given size is left to read in a given parse buffer (starting with 1) */
+#define can_read(buffer, size) ((buffer != NULL) && (((buffer)->offset + size) <= (buffer)->length))
+/* check if the buffer can be accessed at the given index (starting with 0) */
+#define can_access_at_index(buffer, index) ((buffer != NULL) && (((buffer)->offset + index) < (buffer)->length))
+#define cannot_access_at_index(buffer, index) (!can_access_at_index(buffer, index))
+/* get a pointer to the buffer at the position */
+#define buffer_at_offset(buffer) ((buffer)->content + (buffer)->offset)
+
+/* 64 bit unsigned integer for the number conversions */
+#if defined(_MSC_VER)
+typedef unsigned __int64 cjson_uint64;
+#elif defined(__GNUC__)
+__extension__ typedef unsigned long long cjson_uint64;
+#else
+typedef unsigned long long cjson_uint64;
+#endif
+#define cjson_u64(high, low) ((((cjson_uint64)(high)) << 32) | ((cjson_uint64)(low)))
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 cjson_uint128;
+#endif
+
+/* reinterpret the bits of an IEEE 754 binary64 as a double */
+static double double_from_bits(const cjson_uint64 bits)
+{
+    double number = 0;
+    memcpy(&number, &bits, sizeof(number));
+    return number;
+}
+
+/* full 128 bit product of a and b, returns the low half */
+static cjson_uint64 multiply_64x64(const cjson_uint64 a, const cjson_uint64 b, cjson_uint64 * const high)
+{
+#if defined(__SIZEOF_INT128__)
+    const cjson_uint128 product = (cjson_uint128)a * b;
+    *high = (cjson_uint64)(product >> 64);
+    return (cjson_uint64)product;
+#else
+    const cjson_uint64 a_low = a & 0xFFFFFFFFu;
+    const cjson_uint64 a_high = a >> 32;
+    const cjson_uint64 b_low = b & 0xFFFFFFFFu;
+    const cjson_uint64 b_high = b >> 32;
+    const cjson_uint64 low_low = a_low * b_low;
+    const cjson_uint64 high_low = a_high * b_low;
+    const cjson_uint64 cross = (low_low >> 32) + (high_low & 0xFFFFFFFFu) + (a_low * b_high);
+
+    *high = (a_high * b_high) + (high_low >> 32) + (cross >> 32);
+    return (cross << 32) | (low_low & 0xFFFFFFFFu);
+#endif
+}
+
+static unsigned int leading_zeros_64(cjson_uint64 value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_clzll(value);
+#else
+    unsigned int count = 0;
+    while (!(value & cjson_u64(0x80000000, 0)))
     {
-        goto fail;
+        value <<= 1;
+        count++;
     }
+    return count;
+#endif
+}
 
-    /* UTF16 surrogate pair */
-    if ((first_code >= 0xD800) && (first_code <= 0xDBFF))
+/* 128 bit approximations (rounded down) of the powers of ten from 1e-348 to 1e347,
+ * normalized so that the most significant bit is set, stored as { low, high } */
+#define POWERS_OF_TEN_MIN_EXPONENT (-348)
+#define POWERS_OF_TEN_MAX_EXPONENT 347
+static const cjson_uint64 powers_of_ten[][2] =
+{
+    { cjson_u64(0x1732C869, 0xCD60E453), cjson_u64(0xFA8FD5A0, 0x081C0288) }, /* 1e-348 */
+    { cjson_u64(0x0E7FBD42, 0x205C8EB4), cjson_u64(0x9C99E584, 0x05118195) }, /* 1e-347 */
+    { cjson_u64(0x521FAC92, 0xA873B261), cjson_u64(0xC3C05EE5, 0x0655E1FA) }, /* 1e-346 */
+    { cjson_u64(0xE6A797B7, 0x52909EF9), cjson_u64(0xF4B0769E, 0x47EB5A78) }, /* 1e-345 */
+    { cjson_u64(0x9028BED2, 0x939A635C), cjson_u64(0x98EE4A22, 0xECF3188B) }, /* 1e-344 */
+    { cjson_u64(0x7432EE87, 0x3880FC33), cjson_u64(0xBF29DCAB, 0xA82FDEAE) }, /* 1e-343 */
+    { cjson_u64(0x113FAA29, 0x06A13B3F), cjson_u64(0xEEF453D6, 0x923BD65A) }, /* 1e-342 */
+    { cjson_u64(0x4AC7CA59, 0xA424C507), cjson_u64(0x9558B466, 0x1B6565F8) }, /* 1e-341 */
+    { cjson_u64(0x5D79BCF0, 0x0D2DF649), cjson_u64(0xBAAEE17F, 0xA23EBF76) }, /* 1e-340 */
+    { cjson_u64(0xF4D82C2C, 0x107973DC), cjson_u64(0xE95A99DF, 0x8ACE6F53) }, /* 1e-339 */
+    { cjson_u64(0x79071B9B, 0x8A4BE869), cjson_u64(0x91D8A02B, 0xB6C10594) }, /* 1e-338 */
+    { cjson_u64(0x9748E282, 0x6CDEE284), cjson_u64(0xB64EC836, 0xA47146F9) }, /* 1e-337 */
+    { cjson_u64(0xFD1B1B23, 0x08169B25), cjson_u64(0xE3E27A44, 0x4D8D98B7) }, /* 1e-336 */
+    { cjson_u64(0xFE30F0F5, 0xE50E20F7), cjson_u64(0x8E6D8C6A, 0xB0787F72) }, /* 1e-335 */
+    { cjson_u64(0xBDBD2D33, 0x5E51A935), cjson_u64(0xB208EF85, 0x5C969F4F) }, /* 1e-334 */
+    { cjson_u64(0xAD2C7880, 0x35E61382), cjson_u64(0xDE8B2B66, 0xB3BC4723) }, /* 1e-333 */
+    { cjson_u64(0x4C3BCB50, 0x21AFCC31), cjson_u64(0x8B16FB20, 0x3055AC76) }, /* 1e-332 */
+    { cjson_u64(0xDF4ABE24, 0x2A1BBF3D), cjson_u64(0xADDCB9E8, 0x3C6B1793) }, /* 1e-331 */
+    { cjson_u64(0xD71D6DAD, 0x34A2AF0D), cjson_u64(0xD953E862, 0x4B85DD78) }, /* 1e-330 */
+    { cjson_u64(0x8672648C, 0x40E5AD68), cjson_u64(0x87D4713D, 0x6F33AA6B) }, /* 1e-329 */
+    { cjson_u64(0x680EFDAF, 0x511F18C2), cjson_u64(0xA9C98D8C, 0xCB009506) }, /* 1e-328 */
+    { cjson_u64(0x0212BD1B, 0x2566DEF2), cjson_u64(0xD43BF0EF, 0xFDC0BA48) }, /* 1e-327 */
+    { cjson_u64(0x014BB630, 0xF7604B57), cjson_u64(0x84A57695, 0xFE98746D) }, /* 1e-326 */
+    { cjson_u64(0x419EA3BD, 0x35385E2D), cjson_u64(0xA5CED43B, 0x7E3E9188) }, /* 1e-325 */
+    { cjson_u64(0x52064CAC, 0x828675B9), cjson_u64(0xCF42894A, 0x5DCE35EA) }, /* 1e-324 */
+    { cjson_u64(0x7343EFEB, 0xD1940993), cjson_u64(0x818995CE, 0x7AA0E1B2) }, /* 1e-323 */
+    { cjson_u64(0x1014EBE6, 0xC5F90BF8), cjson_u64(0xA1EBFB42, 0x19491A1F) }, /* 1e-322 */
+    { cjson_u64(0xD41A26E0, 0x77774EF6), cjson_u64(0xCA66FA12, 0x9F9B60A6) }, /* 1e-321 */
+    { cjson_u64(0x8920B098, 0x955522B4), cjson_u64(0xFD00B897, 0x478238D0) }, /* 1e-320 */
+    { cjson_u64(0x55B46E5F, 0x5D5535B0), cjson_u64(0x9E20735E, 0x8CB16382) }, /* 1e-319 */
+    { cjson_u64(0xEB2189F7, 0x34AA831D), cjson_u64(0xC5A89036, 0x2FDDBC62) }, /* 1e-318 */
+    { cjson_u64(0xA5E9EC75, 0x01D523E4), cjson_u64(0xF712B443, 0xBBD52B7B) }, /* 1e-317 */
+    { cjson_u64(0x47B233C9, 0x2125366E), cjson_u64(0x9A6BB0AA, 0x55653B2D) }, /* 1e-316 */
+    { cjson_u64(0x999EC0BB, 0x696E840A), cjson_u64(0xC1069CD4, 0xEABE89F8) }, /* 1e-315 */
+    { cjson_u64(0xC00670EA, 0x43CA250D), cjson_u64(0xF148440A, 0x256E2C76) }, /* 1e-314 */
+    { cjson_u64(0x38040692, 0x6A5E5728), cjson_u64(0x96CD2A86, 0x5764DBCA) }, /* 1e-313 */
+    { cjson_u64(0xC6050837, 0x04F5ECF2), cjson_u64(0xBC807527, 0xED3E12BC) }, /* 1e-312 */
+    { cjson_u64(0xF7864A44, 0xC633682E), cjson_u64(0xEBA09271, 0xE88D976B) }, /* 1e-311 */
+    { cjson_u64(0x7AB3EE6A, 0xFBE0211D), cjson_u64(0x93445B87, 0x31587EA3) }, /* 1e-310 */
+    { cjson_u64(0x5960EA05, 0xBAD82964), cjson_u64(0xB8157268, 0xFDAE9E4C) }, /* 1e-309 */
+    { cjson_u64(0x6FB92487, 0x298E33BD), cjson_u64(0xE61ACF03, 0x3D1A45DF) }, /* 1e-308 */
+    { cjson_u64(0xA5D3B6D4, 0x79F8E056), cjson_u64(0x8FD0C162, 0x06306BAB) }, /* 1e-307 */
+    { cjson_u64(0x8F48A489, 0x9877186C), cjson_u64(0xB3C4F1BA, 0x87BC8696) }, /* 1e-306 */
+    { cjson_u64(0x331ACDAB, 0xFE94DE87), cjson_u64(0xE0B62E29, 0x29ABA83C) }, /* 1e-305 */
+    { cjson_u64(0x9FF0C08B, 0x7F1D0B14), cjson_u64(0x8C71DCD9, 0xBA0B4925) }, /* 1e-304 */
+    { cjson_u64(0x07ECF0AE, 0x5EE44DD9), cjson_u64(0xAF8E5410, 0x288E1B6F) }, /* 1e-303 */
+    { cjson_u64(0xC9E82CD9, 0xF69D6150), cjson_u64(0xDB71E914, 0x32B1A24A) }, /* 1e-302 */
+    { cjson_u64(0xBE311C08, 0x3A225CD2), cjson_u64(0x892731AC, 0x9FAF056E) }, /* 1e-301 */
+    { cjson_u64(0x6DBD630A, 0x48AAF406), cjson_u64(0xAB70FE17, 0xC79AC6CA) }, /* 1e-300 */
+    { cjson_u64(0x092CBBCC, 0xDAD5B108), cjson_u64(0xD64D3D9D, 0xB981787D) }, /* 1e-299 */
+    { cjson_u64(0x25BBF560, 0x08C58EA5), cjson_u64(0x85F04682, 0x93F0EB4E) }, /* 1e-298 */
+    { cjson_u64(0xAF2AF2B8, 0x0AF6F24E), cjson_u64(0xA76C5823, 0x38ED2621) }, /* 1e-297 */
+    { cjson_u64(0x1AF5AF66, 0x0DB4AEE1), cjson_u64(0xD1476E2C, 0x07286FAA) }, /* 1e-296 */
+    { cjson_u64(0x50D98D9F, 0xC890ED4D), cjson_u64(0x82CCA4DB, 0x847945CA) }, /* 1e-295 */
+    { cjson_u64(0xE50FF107, 0xBAB528A0), cjson_u64(0xA37FCE12, 0x6597973C) }, /* 1e-294 */
+    { cjson_u64(0x1E53ED49, 0xA96272C8), cjson_u64(0xCC5FC196, 0xFEFD7D0C) }, /* 1e-293 */
+    { cjson_u64(0x25E8E89C, 0x13BB0F7A), cjson_u64(0xFF77B1FC, 0xBEBCDC4F) }, /* 1e-292 */
+    { cjson_u64(0x77B19161, 0x8C54E9AC), cjson_u64(0x9FAACF3D, 0xF73609B1) }, /* 1e-291 */
+    { cjson_u64(0xD59DF5B9, 0xEF6A2417), cjson_u64(0xC795830D, 0x75038C1D) }, /* 1e-290 */
+    { cjson_u64(0x4B057328, 0x6B44AD1D), cjson_u64(0xF97AE3D0, 0xD2446F25) }, /* 1e-289 */
+    { cjson_u64(0x4EE367F9, 0x430AEC32), cjson_u64(0x9BECCE62, 0x836AC577) }, /* 1e-288 */
+    { cjson_u64(0x229C41F7, 0x93CDA73F), cjson_u64(0xC2E801FB, 0x244576D5) }, /* 1e-287 */
+    { cjson_u64(0x6B435275, 0x78C1110F), cjson_u64(0xF3A20279, 0xED56D48A) }, /* 1e-286 */
+    { cjson_u64(0x830A1389, 0x6B78AAA9), cjson_u64(0x9845418C, 0x345644D6) }, /* 1e-285 */
+    { cjson_u64(0x23CC986B, 0xC656D553), cjson_u64(0xBE5691EF, 0x416BD60C) }, /* 1e-284 */
+    { cjson_u64(0x2CBFBE86, 0xB7EC8AA8), cjson_u64(0xEDEC366B, 0x11C6CB8F) }, /* 1e-283 */
+    { cjson_u64(0x7BF7D714, 0x32F3D6A9), cjson_u64(0x94B3A202, 0xEB1C3F39) }, /* 1e-282 */
+    { cjson_u64(0xDAF5CCD9, 0x3FB0CC53), cjson_u64(0xB9E08A83, 0xA5E34F07) }, /* 1e-281 */
+    { cjson_u64(0xD1B3400F, 0x8F9CFF68), cjson_u64(0xE858AD24, 0x8F5C22C9) }, /* 1e-280 */
+    { cjson_u64(0x23100809, 0xB9C21FA1), cjson_u64(0x91376C36, 0xD99995BE) }, /* 1e-279 */
+    { cjson_u64(0xABD40A0C, 0x2832A78A), cjson_u64(0xB5854744, 0x8FFFFB2D) }, /* 1e-278 */
+    { cjson_u64(0x16C90C8F, 0x323F516C), cjson_u64(0xE2E69915, 0xB3FFF9F9) }, /* 1e-277 */
+    { cjson_u64(0xAE3DA7D9, 0x7F6792E3), cjson_u64(0x8DD01FAD, 0x907FFC3B) }, /* 1e-276 */
+    { cjson_u64(0x99CD11CF, 0xDF41779C), cjson_u64(0xB1442798, 0xF49FFB4A) }, /* 1e-275 */
+    { cjson_u64(0x40405643, 0xD711D583), cjson_u64(0xDD95317F, 0x31C7FA1D) }, /* 1e-274 */
+    { cjson_u64(0x482835EA, 0x666B2572), cjson_u64(0x8A7D3EEF, 0x7F1CFC52) }, /* 1e-273 */
+    { cjson_u64(0xDA324365, 0x0005EECF), cjson_u64(0xAD1C8EAB, 0x5EE43B66) }, /* 1e-272 */
+    { cjson_u64(0x90BED43E, 0x40076A82), cjson_u64(0xD863B256, 0x369D4A40) }, /* 1e-271 */
+    { cjson_u64(0x5A7744A6, 0xE804A291), cjson_u64(0x873E4F75, 0xE2224E68) }, /* 1e-270 */
+    { cjson_u64(0x711515D0, 0xA205CB36), cjson_u64(0xA90DE353, 0x5AAAE202) }, /* 1e-269 */
+    { cjson_u64(0x0D5A5B44, 0xCA873E03), cjson_u64(0xD3515C28, 0x31559A83) }, /* 1e-268 */
+    { cjson_u64(0xE858790A, 0xFE9486C2), cjson_u64(0x8412D999, 0x1ED58091) }, /* 1e-267 */
+    { cjson_u64(0x626E974D, 0xBE39A872), cjson_u64(0xA5178FFF, 0x668AE0B6) }, /* 1e-266 */
+    { cjson_u64(0xFB0A3D21, 0x2DC8128F), cjson_u64(0xCE5D73FF, 0x402D98E3) }, /* 1e-265 */
+    { cjson_u64(0x7CE66634, 0xBC9D0B99), cjson_u64(0x80FA687F, 0x881C7F8E) }, /* 1e-264 */
+    { cjson_u64(0x1C1FFFC1, 0xEBC44E80), cjson_u64(0xA139029F, 0x6A239F72) }, /* 1e-263 */
+    { cjson_u64(0xA327FFB2, 0x66B56220), cjson_u64(0xC9874347, 0x44AC874E) }, /* 1e-262 */
+    { cjson_u64(0x4BF1FF9F, 0x0062BAA8), cjson_u64(0xFBE91419, 0x15D7A922) }, /* 1e-261 */
+    { cjson_u64(0x6F773FC3, 0x603DB4A9), cjson_u64(0x9D71AC8F, 0xADA6C9B5) }, /* 1e-260 */
+    { cjson_u64(0xCB550FB4, 0x384D21D3), cjson_u64(0xC4CE17B3, 0x99107C22) }, /* 1e-259 */
+    { cjson_u64(0x7E2A53A1, 0x46606A48), cjson_u64(0xF6019DA0, 0x7F549B2B) }, /* 1e-258 */
+    { cjson_u64(0x2EDA7444, 0xCBFC426D), cjson_u64(0x99C10284, 0x4F94E0FB) }, /* 1e-257 */
+    { cjson_u64(0xFA911155, 0xFEFB5308), cjson_u64(0xC0314325, 0x637A1939) }, /* 1e-256 */
+    { cjson_u64(0x793555AB, 0x7EBA27CA), cjson_u64(0xF03D93EE, 0xBC589F88) }, /* 1e-255 */
+    { cjson_u64(0x4BC1558B, 0x2F3458DE), cjson_u64(0x96267C75, 0x35B763B5) }, /* 1e-254 */
+    { cjson_u64(0x9EB1AAED, 0xFB016F16), cjson_u64(0xBBB01B92, 0x83253CA2) }, /* 1e-253 */
+    { cjson_u64(0x465E15A9, 0x79C1CADC), cjson_u64(0xEA9C2277, 0x23EE8BCB) }, /* 1e-252 */
+    { cjson_u64(0x0BFACD89, 0xEC191EC9), cjson_u64(0x92A1958A, 0x7675175F) }, /* 1e-251 */
+    { cjson_u64(0xCEF980EC, 0x671F667B), cjson_u64(0xB749FAED, 0x14125D36) }, /* 1e-250 */
+    { cjson_u64(0x82B7E127, 0x80E7401A), cjson_u64(0xE51C79A8, 0x5916F484) }, /* 1e-249 */
+    { cjson_u64(0xD1B2ECB8, 0xB0908810), cjson_u64(0x8F31CC09, 0x37AE58D2) }, /* 1e-248 */
+    { cjson_u64(0x861FA7E6, 0xDCB4AA15), cjson_u64(0xB2FE3F0B, 0x8599EF07) }, /* 1e-247 */
+    { cjson_u64(0x67A791E0, 0x93E1D49A), cjson_u64(0xDFBDCECE, 0x67006AC9) }, /* 1e-246 */
+    { cjson_u64(0xE0C8BB2C, 0x5C6D24E0), cjson_u64(0x8BD6A141, 0x006042BD) }, /* 1e-245 */
+    { cjson_u64(0x58FAE9F7, 0x73886E18), cjson_u64(0xAECC4991, 0x4078536D) }, /* 1e-244 */
+    { cjson_u64(0xAF39A475, 0x506A899E), cjson_u64(0xDA7F5BF5, 0x90966848) }, /* 1e-243 */
+    { cjson_u64(0x6D8406C9, 0x52429603), cjson_u64(0x888F9979, 0x7A5E012D) }, /* 1e-242 */
+    { cjson_u64(0xC8E5087B, 0xA6D33B83), cjson_u64(0xAAB37FD7, 0xD8F58178) }, /* 1e-241 */
+    { cjson_u64(0xFB1E4A9A, 0x90880A64), cjson_u64(0xD5605FCD, 0xCF32E1D6) }, /* 1e-240 */
+    { cjson_u64(0x5CF2EEA0, 0x9A55067F), cjson_u64(0x855C3BE0, 0xA17FCD26) }, /* 1e-239 */
+    { cjson_u64(0xF42FAA48, 0xC0EA481E), cjson_u64(0xA6B34AD8, 0xC9DFC06F) }, /* 1e-238 */
+    { cjson_u64(0xF13B94DA, 0xF124DA26), cjson_u64(0xD0601D8E, 0xFC57B08B) }, /* 1e-237 */
+    { cjson_u64(0x76C53D08, 0xD6B70858), cjson_u64(0x823C1279, 0x5DB6CE57) }, /* 1e-236 */
+    { cjson_u64(0x54768C4B, 0x0C64CA6E), cjson_u64(0xA2CB1717, 0xB52481ED) }, /* 1e-235 */
+    { cjson_u64(0xA9942F5D, 0xCF7DFD09), cjson_u64(0xCB7DDCDD, 0xA26DA268) }, /* 1e-234 */
+    { cjson_u64(0xD3F93B35, 0x435D7C4C), cjson_u64(0xFE5D5415, 0x0B090B02) }, /* 1e-233 */
+    { cjson_u64(0xC47BC501, 0x4A1A6DAF), cjson_u64(0x9EFA548D, 0x26E5A6E1) }, /* 1e-232 */
+    { cjson_u64(0x359AB641, 0x9CA1091B), cjson_u64(0xC6B8E9B0, 0x709F109A) }, /* 1e-231 */
+    { cjson_u64(0xC30163D2, 0x03C94B62), cjson_u64(0xF867241C, 0x8CC6D4C0) }, /* 1e-230 */
+    { cjson_u64(0x79E0DE63, 0x425DCF1D), cjson_u64(0x9B407691, 0xD7FC44F8) }, /* 1e-229 */
+    { cjson_u64(0x985915FC, 0x12F542E4), cjson_u64(0xC2109436, 0x4DFB5636) }, /* 1e-228 */
+    { cjson_u64(0x3E6F5B7B, 0x17B2939D), cjson_u64(0xF294B943, 0xE17A2BC4) }, /* 1e-227 */
+    { cjson_u64(0xA705992C, 0xEECF9C42), cjson_u64(0x979CF3CA, 0x6CEC5B5A) }, /* 1e-226 */
+    { cjson_u64(0x50C6FF78, 0x2A838353), cjson_u64(0xBD8430BD, 0x08277231) }, /* 1e-225 */
+    { cjson_u64(0xA4F8BF56, 0x35246428), cjson_u64(0xECE53CEC, 0x4A314EBD) }, /* 1e-224 */
+    { cjson_u64(0x871B7795, 0xE136BE99), cjson_u64(0x940F4613, 0xAE5ED136) }, /* 1e-223 */
+    { cjson_u64(0x28E2557B, 0x59846E3F), cjson_u64(0xB9131798, 0x99F68584) }, /* 1e-222 */
+    { cjson_u64(0x331AEADA, 0x2FE589CF), cjson_u64(0xE757DD7E, 0xC07426E5) }, /* 1e-221 */
+    { cjson_u64(0x3FF0D2C8, 0x5DEF7621), cjson_u64(0x9096EA6F, 0x3848984F) }, /* 1e-220 */
+    { cjson_u64(0x0FED077A, 0x756B53A9), cjson_u64(0xB4BCA50B, 0x065ABE63) }, /* 1e-219 */
+    { cjson_u64(0xD3E84959, 0x12C62894), cjson_u64(0xE1EBCE4D, 0xC7F16DFB) }, /* 1e-218 */
+    { cjson_u64(0x64712DD7, 0xABBBD95C), cjson_u64(0x8D3360F0, 0x9CF6E4BD) }, /* 1e-217 */
+    { cjson_u64(0xBD8D794D, 0x96AACFB3), cjson_u64(0xB080392C, 0xC4349DEC) }, /* 1e-216 */
+    { cjson_u64(0xECF0D7A0, 0xFC5583A0), cjson_u64(0xDCA04777, 0xF541C567) }, /* 1e-215 */
+    { cjson_u64(0xF41686C4, 0x9DB57244), cjson_u64(0x89E42CAA, 0xF9491B60) }, /* 1e-214 */
+    { cjson_u64(0x311C2875, 0xC522CED5), cjson_u64(0xAC5D37D5, 0xB79B6239) }, /* 1e-213 */
+    { cjson_u64(0x7D633293, 0x366B828B), cjson_u64(0xD77485CB, 0x25823AC7) }, /* 1e-212 */
+    { cjson_u64(0xAE5DFF9C, 0x02033197), cjson_u64(0x86A8D39E, 0xF77164BC) }, /* 1e-211 */
+    { cjson_u64(0xD9F57F83, 0x0283FDFC), cjson_u64(0xA8530886, 0xB54DBDEB) }, /* 1e-210 */
+    { cjson_u64(0xD072DF63, 0xC324FD7B), cjson_u64(0xD267CAA8, 0x62A12D66) }, /* 1e-209 */
+    { cjson_u64(0x4247CB9E, 0x59F71E6D), cjson_u64(0x8380DEA9, 0x3DA4BC60) }, /* 1e-208 */
+    { cjson_u64(0x52D9BE85, 0xF074E608), cjson_u64(0xA4611653, 0x8D0DEB78) }, /* 1e-207 */
+    { cjson_u64(0x67902E27, 0x6C921F8B), cjson_u64(0xCD795BE8, 0x70516656) }, /* 1e-206 */
+    { cjson_u64(0x00BA1CD8, 0xA3DB53B6), cjson_u64(0x806BD971, 0x4632DFF6) }, /* 1e-205 */
+    { cjson_u64(0x80E8A40E, 0xCCD228A4), cjson_u64(0xA086CFCD, 0x97BF97F3) }, /* 1e-204 */
+    { cjson_u64(0x6122CD12, 0x8006B2CD), cjson_u64(0xC8A883C0, 0xFDAF7DF0) }, /* 1e-203 */
+    { cjson_u64(0x796B8057, 0x20085F81), cjson_u64(0xFAD2A4B1, 0x3D1B5D6C) }, /* 1e-202 */
+    { cjson_u64(0xCBE33036, 0x74053BB0), cjson_u64(0x9CC3A6EE, 0xC6311A63) }, /* 1e-201 */
+    { cjson_u64(0xBEDBFC44, 0x11068A9C), cjson_u64(0xC3F490AA, 0x77BD60FC) }, /* 1e-200 */
+    { cjson_u64(0xEE92FB55, 0x15482D44), cjson_u64(0xF4F1B4D5, 0x15ACB93B) }, /* 1e-199 */
+    { cjson_u64(0x751BDD15, 0x2D4D1C4A), cjson_u64(0x99171105, 0x2D8BF3C5) }, /* 1e-198 */
+    { cjson_u64(0xD262D45A, 0x78A0635D), cjson_u64(0xBF5CD546, 0x78EEF0B6) }, /* 1e-197 */
+    { cjson_u64(0x86FB8971, 0x16C87C34), cjson_u64(0xEF340A98, 0x172AACE4) }, /* 1e-196 */
+    { cjson_u64(0xD45D35E6, 0xAE3D4DA0), cjson_u64(0x9580869F, 0x0E7AAC0E) }, /* 1e-195 */
+    { cjson_u64(0x89748360, 0x59CCA109), cjson_u64(0xBAE0A846, 0xD2195712) }, /* 1e-194 */
+    { cjson_u64(0x2BD1A438, 0x703FC94B), cjson_u64(0xE998D258, 0x869FACD7) }, /* 1e-193 */
+    { cjson_u64(0x7B6306A3, 0x4627DDCF), cjson_u64(0x91FF8377, 0x5423CC06) }, /* 1e-192 */
+    { cjson_u64(0x1A3BC84C, 0x17B1D542), cjson_u64(0xB67F6455, 0x292CBF08) }, /* 1e-191 */
+    { cjson_u64(0x20CABA5F, 0x1D9E4A93), cjson_u64(0xE41F3D6A, 0x7377EECA) }, /* 1e-190 */
+    { cjson_u64(0x547EB47B, 0x7282EE9C), cjson_u64(0x8E938662, 0x882AF53E) }, /* 1e-189 */
+    { cjson_u64(0xE99E619A, 0x4F23AA43), cjson_u64(0xB23867FB, 0x2A35B28D) }, /* 1e-188 */
+    { cjson_u64(0x6405FA00, 0xE2EC94D4), cjson_u64(0xDEC681F9, 0xF4C31F31) }, /* 1e-187 */
+    { cjson_u64(0xDE83BC40, 0x8DD3DD04), cjson_u64(0x8B3C113C, 0x38F9F37E) }, /* 1e-186 */
+    { cjson_u64(0x9624AB50, 0xB148D445), cjson_u64(0xAE0B158B, 0x4738705E) }, /* 1e-185 */
+    { cjson_u64(0x3BADD624, 0xDD9B0957), cjson_u64(0xD98DDAEE, 0x19068C76) }, /* 1e-184 */
+    { cjson_u64(0xE54CA5D7, 0x0A80E5D6), cjson_u64(0x87F8A8D4, 0xCFA417C9) }, /* 1e-183 */
+    { cjson_u64(0x5E9FCF4C, 0xCD211F4C), cjson_u64(0xA9F6D30A, 0x038D1DBC) }, /* 1e-182 */
+    { cjson_u64(0x7647C320, 0x0069671F), cjson_u64(0xD47487CC, 0x8470652B) }, /* 1e-181 */
+    { cjson_u64(0x29ECD9F4, 0x0041E073), cjson_u64(0x84C8D4DF, 0xD2C63F3B) }, /* 1e-180 */
+    { cjson_u64(0xF4681071, 0x00525890), cjson_u64(0xA5FB0A17, 0xC777CF09) }, /* 1e-179 */
+    { cjson_u64(0x7182148D, 0x4066EEB4), cjson_u64(0xCF79CC9D, 0xB955C2CC) }, /* 1e-178 */
+    { cjson_u64(0xC6F14CD8, 0x48405530), cjson_u64(0x81AC1FE2, 0x93D599BF) }, /* 1e-177 */
+    { cjson_u64(0xB8ADA00E, 0x5A506A7C), cjson_u64(0xA21727DB, 0x38CB002F) }, /* 1e-176 */
+    { cjson_u64(0xA6D90811, 0xF0E4851C), cjson_u64(0xCA9CF1D2, 0x06FDC03B) }, /* 1e-175 */
+    { cjson_u64(0x908F4A16, 0x6D1DA663), cjson_u64(0xFD442E46, 0x88BD304A) }, /* 1e-174 */
+    { cjson_u64(0x9A598E4E, 0x043287FE), cjson_u64(0x9E4A9CEC, 0x15763E2E) }, /* 1e-173 */
+    { cjson_u64(0x40EFF1E1, 0x853F29FD), cjson_u64(0xC5DD4427, 0x1AD3CDBA) }, /* 1e-172 */
+    { cjson_u64(0xD12BEE59, 0xE68EF47C), cjson_u64(0xF7549530, 0xE188C128) }, /* 1e-171 */
+    { cjson_u64(0x82BB74F8, 0x301958CE), cjson_u64(0x9A94DD3E, 0x8CF578B9) }, /* 1e-170 */
+    { cjson_u64(0xE36A5236, 0x3C1FAF01), cjson_u64(0xC13A148E, 0x3032D6E7) }, /* 1e-169 */
+    { cjson_u64(0xDC44E6C3, 0xCB279AC1), cjson_u64(0xF18899B1, 0xBC3F8CA1) }, /* 1e-168 */
+    { cjson_u64(0x29AB103A, 0x5EF8C0B9), cjson_u64(0x96F5600F, 0x15A7B7E5) }, /* 1e-167 */
+    { cjson_u64(0x7415D448, 0xF6B6F0E7), cjson_u64(0xBCB2B812, 0xDB11A5DE) }, /* 1e-166 */
+    { cjson_u64(0x111B495B, 0x3464AD21), cjson_u64(0xEBDF6617, 0x91D60F56) }, /* 1e-165 */
+    { cjson_u64(0xCAB10DD9, 0x00BEEC34), cjson_u64(0x936B9FCE, 0xBB25C995) }, /* 1e-164 */
+    { cjson_u64(0x3D5D514F, 0x40EEA742), cjson_u64(0xB84687C2, 0x69EF3BFB) }, /* 1e-163 */
+    { cjson_u64(0x0CB4A5A3, 0x112A5112), cjson_u64(0xE65829B3, 0x046B0AFA) }, /* 1e-162 */
+    { cjson_u64(0x47F0E785, 0xEABA72AB), cjson_u64(0x8FF71A0F, 0xE2C2E6DC) }, /* 1e-161 */
+    { cjson_u64(0x59ED2167, 0x65690F56), cjson_u64(0xB3F4E093, 0xDB73A093) }, /* 1e-160 */
+    { cjson_u64(0x306869C1, 0x3EC3532C), cjson_u64(0xE0F218B8, 0xD25088B8) }, /* 1e-159 */
+    { cjson_u64(0x1E414218, 0xC73A13FB), cjson_u64(0x8C974F73, 0x83725573) }, /* 1e-158 */
+    { cjson_u64(0xE5D1929E, 0xF90898FA), cjson_u64(0xAFBD2350, 0x644EEACF) }, /* 1e-157 */
+    { cjson_u64(0xDF45F746, 0xB74ABF39), cjson_u64(0xDBAC6C24, 0x7D62A583) }, /* 1e-156 */
+    { cjson_u64(0x6B8BBA8C, 0x328EB783), cjson_u64(0x894BC396, 0xCE5DA772) }, /* 1e-155 */
+    { cjson_u64(0x066EA92F, 0x3F326564), cjson_u64(0xAB9EB47C, 0x81F5114F) }, /* 1e-154 */
+    { cjson_u64(0xC80A537B, 0x0EFEFEBD), cjson_u64(0xD686619B, 0xA27255A2) }, /* 1e-153 */
+    { cjson_u64(0xBD06742C, 0xE95F5F36), cjson_u64(0x8613FD01, 0x45877585) }, /* 1e-152 */
+    { cjson_u64(0x2C481138, 0x23B73704), cjson_u64(0xA798FC41, 0x96E952E7) }, /* 1e-151 */
+    { cjson_u64(0xF75A1586, 0x2CA504C5), cjson_u64(0xD17F3B51, 0xFCA3A7A0) }, /* 1e-150 */
+    { cjson_u64(0x9A984D73, 0xDBE722FB), cjson_u64(0x82EF8513, 0x3DE648C4) }, /* 1e-149 */
+    { cjson_u64(0xC13E60D0, 0xD2E0EBBA), cjson_u64(0xA3AB6658, 0x0D5FDAF5) }, /* 1e-148 */
+    { cjson_u64(0x318DF905, 0x079926A8), cjson_u64(0xCC963FEE, 0x10B7D1B3) }, /* 1e-147 */
+    { cjson_u64(0xFDF17746, 0x497F7052), cjson_u64(0xFFBBCFE9, 0x94E5C61F) }, /* 1e-146 */
+    { cjson_u64(0xFEB6EA8B, 0xEDEFA633), cjson_u64(0x9FD561F1, 0xFD0F9BD3) }, /* 1e-145 */
+    { cjson_u64(0xFE64A52E, 0xE96B8FC0), cjson_u64(0xC7CABA6E, 0x7C5382C8) }, /* 1e-144 */
+    { cjson_u64(0x3DFDCE7A, 0xA3C673B0), cjson_u64(0xF9BD690A, 0x1B68637B) }, /* 1e-143 */
+    { cjson_u64(0x06BEA10C, 0xA65C084E), cjson_u64(0x9C1661A6, 0x51213E2D) }, /* 1e-142 */
+    { cjson_u64(0x486E494F, 0xCFF30A62), cjson_u64(0xC31BFA0F, 0xE5698DB8) }, /* 1e-141 */
+    { cjson_u64(0x5A89DBA3, 0xC3EFCCFA), cjson_u64(0xF3E2F893, 0xDEC3F126) }, /* 1e-140 */
+    { cjson_u64(0xF8962946, 0x5A75E01C), cjson_u64(0x986DDB5C, 0x6B3A76B7) }, /* 1e-139 */
+    { cjson_u64(0xF6BBB397, 0xF1135823), cjson_u64(0xBE895233, 0x86091465) }, /* 1e-138 */
+    { cjson_u64(0x746AA07D, 0xED582E2C), cjson_u64(0xEE2BA6C0, 0x678B597F) }, /* 1e-137 */
+    { cjson_u64(0xA8C2A44E, 0xB4571CDC), cjson_u64(0x94DB4838, 0x40B717EF) }, /* 1e-136 */
+    { cjson_u64(0x92F34D62, 0x616CE413), cjson_u64(0xBA121A46, 0x50E4DDEB) }, /* 1e-135 */
+    { cjson_u64(0x77B020BA, 0xF9C81D17), cjson_u64(0xE896A0D7, 0xE51E1566) }, /* 1e-134 */
+    { cjson_u64(0x0ACE1474, 0xDC1D122E), cjson_u64(0x915E2486, 0xEF32CD60) }, /* 1e-133 */
+    { cjson_u64(0x0D819992, 0x132456BA), cjson_u64(0xB5B5ADA8, 0xAAFF80B8) }, /* 1e-132 */
+    { cjson_u64(0x10E1FFF6, 0x97ED6C69), cjson_u64(0xE3231912, 0xD5BF60E6) }, /* 1e-131 */
+    { cjson_u64(0xCA8D3FFA, 0x1EF463C1), cjson_u64(0x8DF5EFAB, 0xC5979C8F) }, /* 1e-130 */
+    { cjson_u64(0xBD308FF8, 0xA6B17CB2), cjson_u64(0xB1736B96, 0xB6FD83B3) }, /* 1e-129 */
+    { cjson_u64(0xAC7CB3F6, 0xD05DDBDE), cjson_u64(0xDDD0467C, 0x64BCE4A0) }, /* 1e-128 */
+    { cjson_u64(0x6BCDF07A, 0x423AA96B), cjson_u64(0x8AA22C0D, 0xBEF60EE4) }, /* 1e-127 */
+    { cjson_u64(0x86C16C98, 0xD2C953C6), cjson_u64(0xAD4AB711, 0x2EB3929D) }, /* 1e-126 */
+    { cjson_u64(0xE871C7BF, 0x077BA8B7), cjson_u64(0xD89D64D5, 0x7A607744) }, /* 1e-125 */
+    { cjson_u64(0x11471CD7, 0x64AD4972), cjson_u64(0x87625F05, 0x6C7C4A8B) }, /* 1e-124 */
+    { cjson_u64(0xD598E40D, 0x3DD89BCF), cjson_u64(0xA93AF6C6, 0xC79B5D2D) }, /* 1e-123 */
+    { cjson_u64(0x4AFF1D10, 0x8D4EC2C3), cjson_u64(0xD389B478, 0x79823479) }, /* 1e-122 */
+    { cjson_u64(0xCEDF722A, 0x585139BA), cjson_u64(0x843610CB, 0x4BF160CB) }, /* 1e-121 */
+    { cjson_u64(0xC2974EB4, 0xEE658828), cjson_u64(0xA54394FE, 0x1EEDB8FE) }, /* 1e-120 */
+    { cjson_u64(0x733D2262, 0x29FEEA32), cjson_u64(0xCE947A3D, 0xA6A9273E) }, /* 1e-119 */
+    { cjson_u64(0x0806357D, 0x5A3F525F), cjson_u64(0x811CCC66, 0x8829B887) }, /* 1e-118 */
+    { cjson_u64(0xCA07C2DC, 0xB0CF26F7), cjson_u64(0xA163FF80, 0x2A3426A8) }, /* 1e-117 */
+    { cjson_u64(0xFC89B393, 0xDD02F0B5), cjson_u64(0xC9BCFF60, 0x34C13052) }, /* 1e-116 */
+    { cjson_u64(0xBBAC2078, 0xD443ACE2), cjson_u64(0xFC2C3F38, 0x41F17C67) }, /* 1e-115 */
+    { cjson_u64(0xD54B944B, 0x84AA4C0D), cjson_u64(0x9D9BA783, 0x2936EDC0) }, /* 1e-114 */
+    { cjson_u64(0x0A9E795E, 0x65D4DF11), cjson_u64(0xC5029163, 0xF384A931) }, /* 1e-113 */
+    { cjson_u64(0x4D4617B5, 0xFF4A16D5), cjson_u64(0xF64335BC, 0xF065D37D) }, /* 1e-112 */
+    { cjson_u64(0x504BCED1, 0xBF8E4E45), cjson_u64(0x99EA0196, 0x163FA42E) }, /* 1e-111 */
+    { cjson_u64(0xE45EC286, 0x2F71E1D6), cjson_u64(0xC06481FB, 0x9BCF8D39) }, /* 1e-110 */
+    { cjson_u64(0x5D767327, 0xBB4E5A4C), cjson_u64(0xF07DA27A, 0x82C37088) }, /* 1e-109 */
+    { cjson_u64(0x3A6A07F8, 0xD510F86F), cjson_u64(0x964E858C, 0x91BA2655) }, /* 1e-108 */
+    { cjson_u64(0x890489F7, 0x0A55368B), cjson_u64(0xBBE226EF, 0xB628AFEA) }, /* 1e-107 */
+    { cjson_u64(0x2B45AC74, 0xCCEA842E), cjson_u64(0xEADAB0AB, 0xA3B2DBE5) }, /* 1e-106 */
+    { cjson_u64(0x3B0B8BC9, 0x0012929D), cjson_u64(0x92C8AE6B, 0x464FC96F) }, /* 1e-105 */
+    { cjson_u64(0x09CE6EBB, 0x40173744), cjson_u64(0xB77ADA06, 0x17E3BBCB) }, /* 1e-104 */
+    { cjson_u64(0xCC420A6A, 0x101D0515), cjson_u64(0xE5599087, 0x9DDCAABD) }, /* 1e-103 */
+    { cjson_u64(0x9FA94682, 0x4A12232D), cjson_u64(0x8F57FA54, 0xC2A9EAB6) }, /* 1e-102 */
+    { cjson_u64(0x47939822, 0xDC96ABF9), cjson_u64(0xB32DF8E9, 0xF3546564) }, /* 1e-101 */
+    { cjson_u64(0x59787E2B, 0x93BC56F7), cjson_u64(0xDFF97724, 0x70297EBD) }, /* 1e-100 */
+    { cjson_u64(0x57EB4EDB, 0x3C55B65A), cjson_u64(0x8BFBEA76, 0xC619EF36) }, /* 1e-99 */
+    { cjson_u64(0xEDE62292, 0x0B6B23F1), cjson_u64(0xAEFAE514, 0x77A06B03) }, /* 1e-98 */
+    { cjson_u64(0xE95FAB36, 0x8E45ECED), cjson_u64(0xDAB99E59, 0x958885C4) }, /* 1e-97 */
+    { cjson_u64(0x11DBCB02, 0x18EBB414), cjson_u64(0x88B402F7, 0xFD75539B) }, /* 1e-96 */
+    { cjson_u64(0xD652BDC2, 0x9F26A119), cjson_u64(0xAAE103B5, 0xFCD2A881) }, /* 1e-95 */
+    { cjson_u64(0x4BE76D33, 0x46F0495F), cjson_u64(0xD59944A3, 0x7C0752A2) }, /* 1e-94 */
+    { cjson_u64(0x6F70A440, 0x0C562DDB), cjson_u64(0x857FCAE6, 0x2D8493A5) }, /* 1e-93 */
+    { cjson_u64(0xCB4CCD50, 0x0F6BB952), cjson_u64(0xA6DFBD9F, 0xB8E5B88E) }, /* 1e-92 */
+    { cjson_u64(0x7E2000A4, 0x1346A7A7), cjson_u64(0xD097AD07, 0xA71F26B2) }, /* 1e-91 */
+    { cjson_u64(0x8ED40066, 0x8C0C28C8), cjson_u64(0x825ECC24, 0xC873782F) }, /* 1e-90 */
+    { cjson_u64(0x72890080, 0x2F0F32FA), cjson_u64(0xA2F67F2D, 0xFA90563B) }, /* 1e-89 */
+    { cjson_u64(0x4F2B40A0, 0x3AD2FFB9), cjson_u64(0xCBB41EF9, 0x79346BCA) }, /* 1e-88 */
+    { cjson_u64(0xE2F610C8, 0x4987BFA8), cjson_u64(0xFEA126B7, 0xD78186BC) }, /* 1e-87 */
+    { cjson_u64(0x0DD9CA7D, 0x2DF4D7C9), cjson_u64(0x9F24B832, 0xE6B0F436) }, /* 1e-86 */
+    { cjson_u64(0x91503D1C, 0x79720DBB), cjson_u64(0xC6EDE63F, 0xA05D3143) }, /* 1e-85 */
+    { cjson_u64(0x75A44C63, 0x97CE912A), cjson_u64(0xF8A95FCF, 0x88747D94) }, /* 1e-84 */
+    { cjson_u64(0xC986AFBE, 0x3EE11ABA), cjson_u64(0x9B69DBE1, 0xB548CE7C) }, /* 1e-83 */
+    { cjson_u64(0xFBE85BAD, 0xCE996168), cjson_u64(0xC24452DA, 0x229B021B) }, /* 1e-82 */
+    { cjson_u64(0xFAE27299, 0x423FB9C3), cjson_u64(0xF2D56790, 0xAB41C2A2) }, /* 1e-81 */
+    { cjson_u64(0xDCCD879F, 0xC967D41A), cjson_u64(0x97C560BA, 0x6B0919A5) }, /* 1e-80 */
+    { cjson_u64(0x5400E987, 0xBBC1C920), cjson_u64(0xBDB6B8E9, 0x05CB600F) }, /* 1e-79 */
+    { cjson_u64(0x290123E9, 0xAAB23B68), cjson_u64(0xED246723, 0x473E3813) }, /* 1e-78 */
+    { cjson_u64(0xF9A0B672, 0x0AAF6521), cjson_u64(0x9436C076, 0x0C86E30B) }, /* 1e-77 */
+    { cjson_u64(0xF808E40E, 0x8D5B3E69), cjson_u64(0xB9447093, 0x8FA89BCE) }, /* 1e-76 */
+    { cjson_u64(0xB60B1D12, 0x30B20E04), cjson_u64(0xE7958CB8, 0x7392C2C2) }, /* 1e-75 */
+    { cjson_u64(0xB1C6F22B, 0x5E6F48C2), cjson_u64(0x90BD77F3, 0x483BB9B9) }, /* 1e-74 */
+    { cjson_u64(0x1E38AEB6, 0x360B1AF3), cjson_u64(0xB4ECD5F0, 0x1A4AA828) }, /* 1e-73 */
+    { cjson_u64(0x25C6DA63, 0xC38DE1B0), cjson_u64(0xE2280B6C, 0x20DD5232) }, /* 1e-72 */
+    { cjson_u64(0x579C487E, 0x5A38AD0E), cjson_u64(0x8D590723, 0x948A535F) }, /* 1e-71 */
+    { cjson_u64(0x2D835A9D, 0xF0C6D851), cjson_u64(0xB0AF48EC, 0x79ACE837) }, /* 1e-70 */
+    { cjson_u64(0xF8E43145, 0x6CF88E65), cjson_u64(0xDCDB1B27, 0x98182244) }, /* 1e-69 */
+    { cjson_u64(0x1B8E9ECB, 0x641B58FF), cjson_u64(0x8A08F0F8, 0xBF0F156B) }, /* 1e-68 */
+    { cjson_u64(0xE272467E, 0x3D222F3F), cjson_u64(0xAC8B2D36, 0xEED2DAC5) }, /* 1e-67 */
+    { cjson_u64(0x5B0ED81D, 0xCC6ABB0F), cjson_u64(0xD7ADF884, 0xAA879177) }, /* 1e-66 */
+    { cjson_u64(0x98E94712, 0x9FC2B4E9), cjson_u64(0x86CCBB52, 0xEA94BAEA) }, /* 1e-65 */
+    { cjson_u64(0x3F2398D7, 0x47B36224), cjson_u64(0xA87FEA27, 0xA539E9A5) }, /* 1e-64 */
+    { cjson_u64(0x8EEC7F0D, 0x19A03AAD), cjson_u64(0xD29FE4B1, 0x8E88640E) }, /* 1e-63 */
+    { cjson_u64(0x1953CF68, 0x300424AC), cjson_u64(0x83A3EEEE, 0xF9153E89) }, /* 1e-62 */
+    { cjson_u64(0x5FA8C342, 0x3C052DD7), cjson_u64(0xA48CEAAA, 0xB75A8E2B) }, /* 1e-61 */
+    { cjson_u64(0x3792F412, 0xCB06794D), cjson_u64(0xCDB02555, 0x653131B6) }, /* 1e-60 */
+    { cjson_u64(0xE2BBD88B, 0xBEE40BD0), cjson_u64(0x808E1755, 0x5F3EBF11) }, /* 1e-59 */
+    { cjson_u64(0x5B6ACEAE, 0xAE9D0EC4), cjson_u64(0xA0B19D2A, 0xB70E6ED6) }, /* 1e-58 */
+    { cjson_u64(0xF245825A, 0x5A445275), cjson_u64(0xC8DE0475, 0x64D20A8B) }, /* 1e-57 */
+    { cjson_u64(0xEED6E2F0, 0xF0D56712), cjson_u64(0xFB158592, 0xBE068D2E) }, /* 1e-56 */
+    { cjson_u64(0x55464DD6, 0x9685606B), cjson_u64(0x9CED737B, 0xB6C4183D) }, /* 1e-55 */
+    { cjson_u64(0xAA97E14C, 0x3C26B886), cjson_u64(0xC428D05A, 0xA4751E4C) }, /* 1e-54 */
+    { cjson_u64(0xD53DD99F, 0x4B3066A8), cjson_u64(0xF5330471, 0x4D9265DF) }, /* 1e-53 */
+    { cjson_u64(0xE546A803, 0x8EFE4029), cjson_u64(0x993FE2C6, 0xD07B7FAB) }, /* 1e-52 */
+    { cjson_u64(0xDE985204, 0x72BDD033), cjson_u64(0xBF8FDB78, 0x849A5F96) }, /* 1e-51 */
+    { cjson_u64(0x963E6685, 0x8F6D4440), cjson_u64(0xEF73D256, 0xA5C0F77C) }, /* 1e-50 */
+    { cjson_u64(0xDDE70013, 0x79A44AA8), cjson_u64(0x95A86376, 0x27989AAD) }, /* 1e-49 */
+    { cjson_u64(0x5560C018, 0x580D5D52), cjson_u64(0xBB127C53, 0xB17EC159) }, /* 1e-48 */
+    { cjson_u64(0xAAB8F01E, 0x6E10B4A6), cjson_u64(0xE9D71B68, 0x9DDE71AF) }, /* 1e-47 */
+    { cjson_u64(0xCAB39613, 0x04CA70E8), cjson_u64(0x92267121, 0x62AB070D) }, /* 1e-46 */
+    { cjson_u64(0x3D607B97, 0xC5FD0D22), cjson_u64(0xB6B00D69, 0xBB55C8D1) }, /* 1e-45 */
+    { cjson_u64(0x8CB89A7D, 0xB77C506A), cjson_u64(0xE45C10C4, 0x2A2B3B05) }, /* 1e-44 */
+    { cjson_u64(0x77F3608E, 0x92ADB242), cjson_u64(0x8EB98A7A, 0x9A5B04E3) }, /* 1e-43 */
+    { cjson_u64(0x55F038B2, 0x37591ED3), cjson_u64(0xB267ED19, 0x40F1C61C) }, /* 1e-42 */
+    { cjson_u64(0x6B6C46DE, 0xC52F6688), cjson_u64(0xDF01E85F, 0x912E37A3) }, /* 1e-41 */
+    { cjson_u64(0x2323AC4B, 0x3B3DA015), cjson_u64(0x8B61313B, 0xBABCE2C6) }, /* 1e-40 */
+    { cjson_u64(0xABEC975E, 0x0A0D081A), cjson_u64(0xAE397D8A, 0xA96C1B77) }, /* 1e-39 */
+    { cjson_u64(0x96E7BD35, 0x8C904A21), cjson_u64(0xD9C7DCED, 0x53C72255) }, /* 1e-38 */
+    { cjson_u64(0x7E50D641, 0x77DA2E54), cjson_u64(0x881CEA14, 0x545C7575) }, /* 1e-37 */
+    { cjson_u64(0xDDE50BD1, 0xD5D0B9E9), cjson_u64(0xAA242499, 0x697392D2) }, /* 1e-36 */
+    { cjson_u64(0x955E4EC6, 0x4B44E864), cjson_u64(0xD4AD2DBF, 0xC3D07787) }, /* 1e-35 */
+    { cjson_u64(0xBD5AF13B, 0xEF0B113E), cjson_u64(0x84EC3C97, 0xDA624AB4) }, /* 1e-34 */
+    { cjson_u64(0xECB1AD8A, 0xEACDD58E), cjson_u64(0xA6274BBD, 0xD0FADD61) }, /* 1e-33 */
+    { cjson_u64(0x67DE18ED, 0xA5814AF2), cjson_u64(0xCFB11EAD, 0x453994BA) }, /* 1e-32 */
+    { cjson_u64(0x80EACF94, 0x8770CED7), cjson_u64(0x81CEB32C, 0x4B43FCF4) }, /* 1e-31 */
+    { cjson_u64(0xA1258379, 0xA94D028D), cjson_u64(0xA2425FF7, 0x5E14FC31) }, /* 1e-30 */
+    { cjson_u64(0x096EE458, 0x13A04330), cjson_u64(0xCAD2F7F5, 0x359A3B3E) }, /* 1e-29 */
+    { cjson_u64(0x8BCA9D6E, 0x188853FC), cjson_u64(0xFD87B5F2, 0x8300CA0D) }, /* 1e-28 */
+    { cjson_u64(0x775EA264, 0xCF55347D), cjson_u64(0x9E74D1B7, 0x91E07E48) }, /* 1e-27 */
+    { cjson_u64(0x95364AFE, 0x032A819D), cjson_u64(0xC6120625, 0x76589DDA) }, /* 1e-26 */
+    { cjson_u64(0x3A83DDBD, 0x83F52204), cjson_u64(0xF79687AE, 0xD3EEC551) }, /* 1e-25 */
+    { cjson_u64(0xC4926A96, 0x72793542), cjson_u64(0x9ABE14CD, 0x44753B52) }, /* 1e-24 */
+    { cjson_u64(0x75B7053C, 0x0F178293), cjson_u64(0xC16D9A00, 0x95928A27) }, /* 1e-23 */
+    { cjson_u64(0x5324C68B, 0x12DD6338), cjson_u64(0xF1C90080, 0xBAF72CB1) }, /* 1e-22 */
+    { cjson_u64(0xD3F6FC16, 0xEBCA5E03), cjson_u64(0x971DA050, 0x74DA7BEE) }, /* 1e-21 */
+    { cjson_u64(0x88F4BB1C, 0xA6BCF584), cjson_u64(0xBCE50864, 0x92111AEA) }, /* 1e-20 */
+    { cjson_u64(0x2B31E9E3, 0xD06C32E5), cjson_u64(0xEC1E4A7D, 0xB69561A5) }, /* 1e-19 */
+    { cjson_u64(0x3AFF322E, 0x62439FCF), cjson_u64(0x9392EE8E, 0x921D5D07) }, /* 1e-18 */
+    { cjson_u64(0x09BEFEB9, 0xFAD487C2), cjson_u64(0xB877AA32, 0x36A4B449) }, /* 1e-17 */
+    { cjson_u64(0x4C2EBE68, 0x7989A9B3), cjson_u64(0xE69594BE, 0xC44DE15B) }, /* 1e-16 */
+    { cjson_u64(0x0F9D3701, 0x4BF60A10), cjson_u64(0x901D7CF7, 0x3AB0ACD9) }, /* 1e-15 */
+    { cjson_u64(0x538484C1, 0x9EF38C94), cjson_u64(0xB424DC35, 0x095CD80F) }, /* 1e-14 */
+    { cjson_u64(0x2865A5F2, 0x06B06FB9), cjson_u64(0xE12E1342, 0x4BB40E13) }, /* 1e-13 */
+    { cjson_u64(0xF93F87B7, 0x442E45D3), cjson_u64(0x8CBCCC09, 0x6F5088CB) }, /* 1e-12 */
+    { cjson_u64(0xF78F69A5, 0x1539D748), cjson_u64(0xAFEBFF0B, 0xCB24AAFE) }, /* 1e-11 */
+    { cjson_u64(0xB573440E, 0x5A884D1B), cjson_u64(0xDBE6FECE, 0xBDEDD5BE) }, /* 1e-10 */
+    { cjson_u64(0x31680A88, 0xF8953030), cjson_u64(0x89705F41, 0x36B4A597) }, /* 1e-9 */
+    { cjson_u64(0xFDC20D2B, 0x36BA7C3D), cjson_u64(0xABCC7711, 0x8461CEFC) }, /* 1e-8 */
+    { cjson_u64(0x3D329076, 0x04691B4C), cjson_u64(0xD6BF94D5, 0xE57A42BC) }, /* 1e-7 */
+    { cjson_u64(0xA63F9A49, 0xC2C1B10F), cjson_u64(0x8637BD05, 0xAF6C69B5) }, /* 1e-6 */
+    { cjson_u64(0x0FCF80DC, 0x33721D53), cjson_u64(0xA7C5AC47, 0x1B478423) }, /* 1e-5 */
+    { cjson_u64(0xD3C36113, 0x404EA4A8), cjson_u64(0xD1B71758, 0xE219652B) }, /* 1e-4 */
+    { cjson_u64(0x645A1CAC, 0x083126E9), cjson_u64(0x83126E97, 0x8D4FDF3B) }, /* 1e-3 */
+    { cjson_u64(0x3D70A3D7, 0x0A3D70A3), cjson_u64(0xA3D70A3D, 0x70A3D70A) }, /* 1e-2 */
+    { cjson_u64(0xCCCCCCCC, 0xCCCCCCCC), cjson_u64(0xCCCCCCCC, 0xCCCCCCCC) }, /* 1e-1 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x80000000, 0x00000000) }, /* 1e0 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xA0000000, 0x00000000) }, /* 1e1 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xC8000000, 0x00000000) }, /* 1e2 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xFA000000, 0x00000000) }, /* 1e3 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x9C400000, 0x00000000) }, /* 1e4 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xC3500000, 0x00000000) }, /* 1e5 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xF4240000, 0x00000000) }, /* 1e6 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x98968000, 0x00000000) }, /* 1e7 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xBEBC2000, 0x00000000) }, /* 1e8 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xEE6B2800, 0x00000000) }, /* 1e9 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x9502F900, 0x00000000) }, /* 1e10 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xBA43B740, 0x00000000) }, /* 1e11 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xE8D4A510, 0x00000000) }, /* 1e12 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x9184E72A, 0x00000000) }, /* 1e13 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xB5E620F4, 0x80000000) }, /* 1e14 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xE35FA931, 0xA0000000) }, /* 1e15 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x8E1BC9BF, 0x04000000) }, /* 1e16 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xB1A2BC2E, 0xC5000000) }, /* 1e17 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xDE0B6B3A, 0x76400000) }, /* 1e18 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x8AC72304, 0x89E80000) }, /* 1e19 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xAD78EBC5, 0xAC620000) }, /* 1e20 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xD8D726B7, 0x177A8000) }, /* 1e21 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x87867832, 0x6EAC9000) }, /* 1e22 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xA968163F, 0x0A57B400) }, /* 1e23 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xD3C21BCE, 0xCCEDA100) }, /* 1e24 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x84595161, 0x401484A0) }, /* 1e25 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xA56FA5B9, 0x9019A5C8) }, /* 1e26 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0xCECB8F27, 0xF4200F3A) }, /* 1e27 */
+    { cjson_u64(0x40000000, 0x00000000), cjson_u64(0x813F3978, 0xF8940984) }, /* 1e28 */
+    { cjson_u64(0x50000000, 0x00000000), cjson_u64(0xA18F07D7, 0x36B90BE5) }, /* 1e29 */
+    { cjson_u64(0xA4000000, 0x00000000), cjson_u64(0xC9F2C9CD, 0x04674EDE) }, /* 1e30 */
+    { cjson_u64(0x4D000000, 0x00000000), cjson_u64(0xFC6F7C40, 0x45812296) }, /* 1e31 */
+    { cjson_u64(0xF0200000, 0x00000000), cjson_u64(0x9DC5ADA8, 0x2B70B59D) }, /* 1e32 */
+    { cjson_u64(0x6C280000, 0x00000000), cjson_u64(0xC5371912, 0x364CE305) }, /* 1e33 */
+    { cjson_u64(0xC7320000, 0x00000000), cjson_u64(0xF684DF56, 0xC3E01BC6) }, /* 1e34 */
+    { cjson_u64(0x3C7F4000, 0x00000000), cjson_u64(0x9A130B96, 0x3A6C115C) }, /* 1e35 */
+    { cjson_u64(0x4B9F1000, 0x00000000), cjson_u64(0xC097CE7B, 0xC90715B3) }, /* 1e36 */
+    { cjson_u64(0x1E86D400, 0x00000000), cjson_u64(0xF0BDC21A, 0xBB48DB20) }, /* 1e37 */
+    { cjson_u64(0x13144480, 0x00000000), cjson_u64(0x96769950, 0xB50D88F4) }, /* 1e38 */
+    { cjson_u64(0x17D955A0, 0x00000000), cjson_u64(0xBC143FA4, 0xE250EB31) }, /* 1e39 */
+    { cjson_u64(0x5DCFAB08, 0x00000000), cjson_u64(0xEB194F8E, 0x1AE525FD) }, /* 1e40 */
+    { cjson_u64(0x5AA1CAE5, 0x00000000), cjson_u64(0x92EFD1B8, 0xD0CF37BE) }, /* 1e41 */
+    { cjson_u64(0xF14A3D9E, 0x40000000), cjson_u64(0xB7ABC627, 0x050305AD) }, /* 1e42 */
+    { cjson_u64(0x6D9CCD05, 0xD0000000), cjson_u64(0xE596B7B0, 0xC643C719) }, /* 1e43 */
+    { cjson_u64(0xE4820023, 0xA2000000), cjson_u64(0x8F7E32CE, 0x7BEA5C6F) }, /* 1e44 */
+    { cjson_u64(0xDDA2802C, 0x8A800000), cjson_u64(0xB35DBF82, 0x1AE4F38B) }, /* 1e45 */
+    { cjson_u64(0xD50B2037, 0xAD200000), cjson_u64(0xE0352F62, 0xA19E306E) }, /* 1e46 */
+    { cjson_u64(0x4526F422, 0xCC340000), cjson_u64(0x8C213D9D, 0xA502DE45) }, /* 1e47 */
+    { cjson_u64(0x9670B12B, 0x7F410000), cjson_u64(0xAF298D05, 0x0E4395D6) }, /* 1e48 */
+    { cjson_u64(0x3C0CDD76, 0x5F114000), cjson_u64(0xDAF3F046, 0x51D47B4C) }, /* 1e49 */
+    { cjson_u64(0xA5880A69, 0xFB6AC800), cjson_u64(0x88D8762B, 0xF324CD0F) }, /* 1e50 */
+    { cjson_u64(0x8EEA0D04, 0x7A457A00), cjson_u64(0xAB0E93B6, 0xEFEE0053) }, /* 1e51 */
+    { cjson_u64(0x72A49045, 0x98D6D880), cjson_u64(0xD5D238A4, 0xABE98068) }, /* 1e52 */
+    { cjson_u64(0x47A6DA2B, 0x7F864750), cjson_u64(0x85A36366, 0xEB71F041) }, /* 1e53 */
+    { cjson_u64(0x999090B6, 0x5F67D924), cjson_u64(0xA70C3C40, 0xA64E6C51) }, /* 1e54 */
+    { cjson_u64(0xFFF4B4E3, 0xF741CF6D), cjson_u64(0xD0CF4B50, 0xCFE20765) }, /* 1e55 */
+    { cjson_u64(0xBFF8F10E, 0x7A8921A4), cjson_u64(0x82818F12, 0x81ED449F) }, /* 1e56 */
+    { cjson_u64(0xAFF72D52, 0x192B6A0D), cjson_u64(0xA321F2D7, 0x226895C7) }, /* 1e57 */
+    { cjson_u64(0x9BF4F8A6, 0x9F764490), cjson_u64(0xCBEA6F8C, 0xEB02BB39) }, /* 1e58 */
+    { cjson_u64(0x02F236D0, 0x4753D5B4), cjson_u64(0xFEE50B70, 0x25C36A08) }, /* 1e59 */
+    { cjson_u64(0x01D76242, 0x2C946590), cjson_u64(0x9F4F2726, 0x179A2245) }, /* 1e60 */
+    { cjson_u64(0x424D3AD2, 0xB7B97EF5), cjson_u64(0xC722F0EF, 0x9D80AAD6) }, /* 1e61 */
+    { cjson_u64(0xD2E08987, 0x65A7DEB2), cjson_u64(0xF8EBAD2B, 0x84E0D58B) }, /* 1e62 */
+    { cjson_u64(0x63CC55F4, 0x9F88EB2F), cjson_u64(0x9B934C3B, 0x330C8577) }, /* 1e63 */
+    { cjson_u64(0x3CBF6B71, 0xC76B25FB), cjson_u64(0xC2781F49, 0xFFCFA6D5) }, /* 1e64 */
+    { cjson_u64(0x8BEF464E, 0x3945EF7A), cjson_u64(0xF316271C, 0x7FC3908A) }, /* 1e65 */
+    { cjson_u64(0x97758BF0, 0xE3CBB5AC), cjson_u64(0x97EDD871, 0xCFDA3A56) }, /* 1e66 */
+    { cjson_u64(0x3D52EEED, 0x1CBEA317), cjson_u64(0xBDE94E8E, 0x43D0C8EC) }, /* 1e67 */
+    { cjson_u64(0x4CA7AAA8, 0x63EE4BDD), cjson_u64(0xED63A231, 0xD4C4FB27) }, /* 1e68 */
+    { cjson_u64(0x8FE8CAA9, 0x3E74EF6A), cjson_u64(0x945E455F, 0x24FB1CF8) }, /* 1e69 */
+    { cjson_u64(0xB3E2FD53, 0x8E122B44), cjson_u64(0xB975D6B6, 0xEE39E436) }, /* 1e70 */
+    { cjson_u64(0x60DBBCA8, 0x7196B616), cjson_u64(0xE7D34C64, 0xA9C85D44) }, /* 1e71 */
+    { cjson_u64(0xBC8955E9, 0x46FE31CD), cjson_u64(0x90E40FBE, 0xEA1D3A4A) }, /* 1e72 */
+    { cjson_u64(0x6BABAB63, 0x98BDBE41), cjson_u64(0xB51D13AE, 0xA4A488DD) }, /* 1e73 */
+    { cjson_u64(0xC696963C, 0x7EED2DD1), cjson_u64(0xE264589A, 0x4DCDAB14) }, /* 1e74 */
+    { cjson_u64(0xFC1E1DE5, 0xCF543CA2), cjson_u64(0x8D7EB760, 0x70A08AEC) }, /* 1e75 */
+    { cjson_u64(0x3B25A55F, 0x43294BCB), cjson_u64(0xB0DE6538, 0x8CC8ADA8) }, /* 1e76 */
+    { cjson_u64(0x49EF0EB7, 0x13F39EBE), cjson_u64(0xDD15FE86, 0xAFFAD912) }, /* 1e77 */
+    { cjson_u64(0x6E356932, 0x6C784337), cjson_u64(0x8A2DBF14, 0x2DFCC7AB) }, /* 1e78 */
+    { cjson_u64(0x49C2C37F, 0x07965404), cjson_u64(0xACB92ED9, 0x397BF996) }, /* 1e79 */
+    { cjson_u64(0xDC33745E, 0xC97BE906), cjson_u64(0xD7E77A8F, 0x87DAF7FB) }, /* 1e80 */
+    { cjson_u64(0x69A028BB, 0x3DED71A3), cjson_u64(0x86F0AC99, 0xB4E8DAFD) }, /* 1e81 */
+    { cjson_u64(0xC40832EA, 0x0D68CE0C), cjson_u64(0xA8ACD7C0, 0x222311BC) }, /* 1e82 */
+    { cjson_u64(0xF50A3FA4, 0x90C30190), cjson_u64(0xD2D80DB0, 0x2AABD62B) }, /* 1e83 */
+    { cjson_u64(0x792667C6, 0xDA79E0FA), cjson_u64(0x83C7088E, 0x1AAB65DB) }, /* 1e84 */
+    { cjson_u64(0x577001B8, 0x91185938), cjson_u64(0xA4B8CAB1, 0xA1563F52) }, /* 1e85 */
+    { cjson_u64(0xED4C0226, 0xB55E6F86), cjson_u64(0xCDE6FD5E, 0x09ABCF26) }, /* 1e86 */
+    { cjson_u64(0x544F8158, 0x315B05B4), cjson_u64(0x80B05E5A, 0xC60B6178) }, /* 1e87 */
+    { cjson_u64(0x696361AE, 0x3DB1C721), cjson_u64(0xA0DC75F1, 0x778E39D6) }, /* 1e88 */
+    { cjson_u64(0x03BC3A19, 0xCD1E38E9), cjson_u64(0xC913936D, 0xD571C84C) }, /* 1e89 */
+    { cjson_u64(0x04AB48A0, 0x4065C723), cjson_u64(0xFB587849, 0x4ACE3A5F) }, /* 1e90 */
+    { cjson_u64(0x62EB0D64, 0x283F9C76), cjson_u64(0x9D174B2D, 0xCEC0E47B) }, /* 1e91 */
+    { cjson_u64(0x3BA5D0BD, 0x324F8394), cjson_u64(0xC45D1DF9, 0x42711D9A) }, /* 1e92 */
+    { cjson_u64(0xCA8F44EC, 0x7EE36479), cjson_u64(0xF5746577, 0x930D6500) }, /* 1e93 */
+    { cjson_u64(0x7E998B13, 0xCF4E1ECB), cjson_u64(0x9968BF6A, 0xBBE85F20) }, /* 1e94 */
+    { cjson_u64(0x9E3FEDD8, 0xC321A67E), cjson_u64(0xBFC2EF45, 0x6AE276E8) }, /* 1e95 */
+    { cjson_u64(0xC5CFE94E, 0xF3EA101E), cjson_u64(0xEFB3AB16, 0xC59B14A2) }, /* 1e96 */
+    { cjson_u64(0xBBA1F1D1, 0x58724A12), cjson_u64(0x95D04AEE, 0x3B80ECE5) }, /* 1e97 */
+    { cjson_u64(0x2A8A6E45, 0xAE8EDC97), cjson_u64(0xBB445DA9, 0xCA61281F) }, /* 1e98 */
+    { cjson_u64(0xF52D09D7, 0x1A3293BD), cjson_u64(0xEA157514, 0x3CF97226) }, /* 1e99 */
+    { cjson_u64(0x593C2626, 0x705F9C56), cjson_u64(0x924D692C, 0xA61BE758) }, /* 1e100 */
+    { cjson_u64(0x6F8B2FB0, 0x0C77836C), cjson_u64(0xB6E0C377, 0xCFA2E12E) }, /* 1e101 */
+    { cjson_u64(0x0B6DFB9C, 0x0F956447), cjson_u64(0xE498F455, 0xC38B997A) }, /* 1e102 */
+    { cjson_u64(0x4724BD41, 0x89BD5EAC), cjson_u64(0x8EDF98B5, 0x9A373FEC) }, /* 1e103 */
+    { cjson_u64(0x58EDEC91, 0xEC2CB657), cjson_u64(0xB2977EE3, 0x00C50FE7) }, /* 1e104 */
+    { cjson_u64(0x2F2967B6, 0x6737E3ED), cjson_u64(0xDF3D5E9B, 0xC0F653E1) }, /* 1e105 */
+    { cjson_u64(0xBD79E0D2, 0x0082EE74), cjson_u64(0x8B865B21, 0x5899F46C) }, /* 1e106 */
+    { cjson_u64(0xECD85906, 0x80A3AA11), cjson_u64(0xAE67F1E9, 0xAEC07187) }, /* 1e107 */
+    { cjson_u64(0xE80E6F48, 0x20CC9495), cjson_u64(0xDA01EE64, 0x1A708DE9) }, /* 1e108 */
+    { cjson_u64(0x3109058D, 0x147FDCDD), cjson_u64(0x884134FE, 0x908658B2) }, /* 1e109 */
+    { cjson_u64(0xBD4B46F0, 0x599FD415), cjson_u64(0xAA51823E, 0x34A7EEDE) }, /* 1e110 */
+    { cjson_u64(0x6C9E18AC, 0x7007C91A), cjson_u64(0xD4E5E2CD, 0xC1D1EA96) }, /* 1e111 */
+    { cjson_u64(0x03E2CF6B, 0xC604DDB0), cjson_u64(0x850FADC0, 0x9923329E) }, /* 1e112 */
+    { cjson_u64(0x84DB8346, 0xB786151C), cjson_u64(0xA6539930, 0xBF6BFF45) }, /* 1e113 */
+    { cjson_u64(0xE6126418, 0x65679A63), cjson_u64(0xCFE87F7C, 0xEF46FF16) }, /* 1e114 */
+    { cjson_u64(0x4FCB7E8F, 0x3F60C07E), cjson_u64(0x81F14FAE, 0x158C5F6E) }, /* 1e115 */
+    { cjson_u64(0xE3BE5E33, 0x0F38F09D), cjson_u64(0xA26DA399, 0x9AEF7749) }, /* 1e116 */
+    { cjson_u64(0x5CADF5BF, 0xD3072CC5), cjson_u64(0xCB090C80, 0x01AB551C) }, /* 1e117 */
+    { cjson_u64(0x73D9732F, 0xC7C8F7F6), cjson_u64(0xFDCB4FA0, 0x02162A63) }, /* 1e118 */
+    { cjson_u64(0x2867E7FD, 0xDCDD9AFA), cjson_u64(0x9E9F11C4, 0x014DDA7E) }, /* 1e119 */
+    { cjson_u64(0xB281E1FD, 0x541501B8), cjson_u64(0xC646D635, 0x01A1511D) }, /* 1e120 */
+    { cjson_u64(0x1F225A7C, 0xA91A4226), cjson_u64(0xF7D88BC2, 0x4209A565) }, /* 1e121 */
+    { cjson_u64(0x3375788D, 0xE9B06958), cjson_u64(0x9AE75759, 0x6946075F) }, /* 1e122 */
+    { cjson_u64(0x0052D6B1, 0x641C83AE), cjson_u64(0xC1A12D2F, 0xC3978937) }, /* 1e123 */
+    { cjson_u64(0xC0678C5D, 0xBD23A49A), cjson_u64(0xF209787B, 0xB47D6B84) }, /* 1e124 */
+    { cjson_u64(0xF840B7BA, 0x963646E0), cjson_u64(0x9745EB4D, 0x50CE6332) }, /* 1e125 */
+    { cjson_u64(0xB650E5A9, 0x3BC3D898), cjson_u64(0xBD176620, 0xA501FBFF) }, /* 1e126 */
+    { cjson_u64(0xA3E51F13, 0x8AB4CEBE), cjson_u64(0xEC5D3FA8, 0xCE427AFF) }, /* 1e127 */
+    { cjson_u64(0xC66F336C, 0x36B10137), cjson_u64(0x93BA47C9, 0x80E98CDF) }, /* 1e128 */
+    { cjson_u64(0xB80B0047, 0x445D4184), cjson_u64(0xB8A8D9BB, 0xE123F017) }, /* 1e129 */
+    { cjson_u64(0xA60DC059, 0x157491E5), cjson_u64(0xE6D3102A, 0xD96CEC1D) }, /* 1e130 */
+    { cjson_u64(0x87C89837, 0xAD68DB2F), cjson_u64(0x9043EA1A, 0xC7E41392) }, /* 1e131 */
+    { cjson_u64(0x29BABE45, 0x98C311FB), cjson_u64(0xB454E4A1, 0x79DD1877) }, /* 1e132 */
+    { cjson_u64(0xF4296DD6, 0xFEF3D67A), cjson_u64(0xE16A1DC9, 0xD8545E94) }, /* 1e133 */
+    { cjson_u64(0x1899E4A6, 0x5F58660C), cjson_u64(0x8CE2529E, 0x2734BB1D) }, /* 1e134 */
+    { cjson_u64(0x5EC05DCF, 0xF72E7F8F), cjson_u64(0xB01AE745, 0xB101E9E4) }, /* 1e135 */
+    { cjson_u64(0x76707543, 0xF4FA1F73), cjson_u64(0xDC21A117, 0x1D42645D) }, /* 1e136 */
+    { cjson_u64(0x6A06494A, 0x791C53A8), cjson_u64(0x899504AE, 0x72497EBA) }, /* 1e137 */
+    { cjson_u64(0x0487DB9D, 0x17636892), cjson_u64(0xABFA45DA, 0x0EDBDE69) }, /* 1e138 */
+    { cjson_u64(0x45A9D284, 0x5D3C42B6), cjson_u64(0xD6F8D750, 0x9292D603) }, /* 1e139 */
+    { cjson_u64(0x0B8A2392, 0xBA45A9B2), cjson_u64(0x865B8692, 0x5B9BC5C2) }, /* 1e140 */
+    { cjson_u64(0x8E6CAC77, 0x68D7141E), cjson_u64(0xA7F26836, 0xF282B732) }, /* 1e141 */
+    { cjson_u64(0x3207D795, 0x430CD926), cjson_u64(0xD1EF0244, 0xAF2364FF) }, /* 1e142 */
+    { cjson_u64(0x7F44E6BD, 0x49E807B8), cjson_u64(0x8335616A, 0xED761F1F) }, /* 1e143 */
+    { cjson_u64(0x5F16206C, 0x9C6209A6), cjson_u64(0xA402B9C5, 0xA8D3A6E7) }, /* 1e144 */
+    { cjson_u64(0x36DBA887, 0xC37A8C0F), cjson_u64(0xCD036837, 0x130890A1) }, /* 1e145 */
+    { cjson_u64(0xC2494954, 0xDA2C9789), cjson_u64(0x80222122, 0x6BE55A64) }, /* 1e146 */
+    { cjson_u64(0xF2DB9BAA, 0x10B7BD6C), cjson_u64(0xA02AA96B, 0x06DEB0FD) }, /* 1e147 */
+    { cjson_u64(0x6F928294, 0x94E5ACC7), cjson_u64(0xC83553C5, 0xC8965D3D) }, /* 1e148 */
+    { cjson_u64(0xCB772339, 0xBA1F17F9), cjson_u64(0xFA42A8B7, 0x3ABBF48C) }, /* 1e149 */
+    { cjson_u64(0xFF2A7604, 0x14536EFB), cjson_u64(0x9C69A972, 0x84B578D7) }, /* 1e150 */
+    { cjson_u64(0xFEF51385, 0x19684ABA), cjson_u64(0xC38413CF, 0x25E2D70D) }, /* 1e151 */
+    { cjson_u64(0x7EB25866, 0x5FC25D69), cjson_u64(0xF46518C2, 0xEF5B8CD1) }, /* 1e152 */
+    { cjson_u64(0xEF2F773F, 0xFBD97A61), cjson_u64(0x98BF2F79, 0xD5993802) }, /* 1e153 */
+    { cjson_u64(0xAAFB550F, 0xFACFD8FA), cjson_u64(0xBEEEFB58, 0x4AFF8603) }, /* 1e154 */
+    { cjson_u64(0x95BA2A53, 0xF983CF38), cjson_u64(0xEEAABA2E, 0x5DBF6784) }, /* 1e155 */
+    { cjson_u64(0xDD945A74, 0x7BF26183), cjson_u64(0x952AB45C, 0xFA97A0B2) }, /* 1e156 */
+    { cjson_u64(0x94F97111, 0x9AEEF9E4), cjson_u64(0xBA756174, 0x393D88DF) }, /* 1e157 */
+    { cjson_u64(0x7A37CD56, 0x01AAB85D), cjson_u64(0xE912B9D1, 0x478CEB17) }, /* 1e158 */
+    { cjson_u64(0xAC62E055, 0xC10AB33A), cjson_u64(0x91ABB422, 0xCCB812EE) }, /* 1e159 */
+    { cjson_u64(0x577B986B, 0x314D6009), cjson_u64(0xB616A12B, 0x7FE617AA) }, /* 1e160 */
+    { cjson_u64(0xED5A7E85, 0xFDA0B80B), cjson_u64(0xE39C4976, 0x5FDF9D94) }, /* 1e161 */
+    { cjson_u64(0x14588F13, 0xBE847307), cjson_u64(0x8E41ADE9, 0xFBEBC27D) }, /* 1e162 */
+    { cjson_u64(0x596EB2D8, 0xAE258FC8), cjson_u64(0xB1D21964, 0x7AE6B31C) }, /* 1e163 */
+    { cjson_u64(0x6FCA5F8E, 0xD9AEF3BB), cjson_u64(0xDE469FBD, 0x99A05FE3) }, /* 1e164 */
+    { cjson_u64(0x25DE7BB9, 0x480D5854), cjson_u64(0x8AEC23D6, 0x80043BEE) }, /* 1e165 */
+    { cjson_u64(0xAF561AA7, 0x9A10AE6A), cjson_u64(0xADA72CCC, 0x20054AE9) }, /* 1e166 */
+    { cjson_u64(0x1B2BA151, 0x8094DA04), cjson_u64(0xD910F7FF, 0x28069DA4) }, /* 1e167 */
+    { cjson_u64(0x90FB44D2, 0xF05D0842), cjson_u64(0x87AA9AFF, 0x79042286) }, /* 1e168 */
+    { cjson_u64(0x353A1607, 0xAC744A53), cjson_u64(0xA99541BF, 0x57452B28) }, /* 1e169 */
+    { cjson_u64(0x42889B89, 0x97915CE8), cjson_u64(0xD3FA922F, 0x2D1675F2) }, /* 1e170 */
+    { cjson_u64(0x69956135, 0xFEBADA11), cjson_u64(0x847C9B5D, 0x7C2E09B7) }, /* 1e171 */
+    { cjson_u64(0x43FAB983, 0x7E699095), cjson_u64(0xA59BC234, 0xDB398C25) }, /* 1e172 */
+    { cjson_u64(0x94F967E4, 0x5E03F4BB), cjson_u64(0xCF02B2C2, 0x1207EF2E) }, /* 1e173 */
+    { cjson_u64(0x1D1BE0EE, 0xBAC278F5), cjson_u64(0x8161AFB9, 0x4B44F57D) }, /* 1e174 */
+    { cjson_u64(0x6462D92A, 0x69731732), cjson_u64(0xA1BA1BA7, 0x9E1632DC) }, /* 1e175 */
+    { cjson_u64(0x7D7B8F75, 0x03CFDCFE), cjson_u64(0xCA28A291, 0x859BBF93) }, /* 1e176 */
+    { cjson_u64(0x5CDA7352, 0x44C3D43E), cjson_u64(0xFCB2CB35, 0xE702AF78) }, /* 1e177 */
+    { cjson_u64(0x3A088813, 0x6AFA64A7), cjson_u64(0x9DEFBF01, 0xB061ADAB) }, /* 1e178 */
+    { cjson_u64(0x088AAA18, 0x45B8FDD0), cjson_u64(0xC56BAEC2, 0x1C7A1916) }, /* 1e179 */
+    { cjson_u64(0x8AAD549E, 0x57273D45), cjson_u64(0xF6C69A72, 0xA3989F5B) }, /* 1e180 */
+    { cjson_u64(0x36AC54E2, 0xF678864B), cjson_u64(0x9A3C2087, 0xA63F6399) }, /* 1e181 */
+    { cjson_u64(0x84576A1B, 0xB416A7DD), cjson_u64(0xC0CB28A9, 0x8FCF3C7F) }, /* 1e182 */
+    { cjson_u64(0x656D44A2, 0xA11C51D5), cjson_u64(0xF0FDF2D3, 0xF3C30B9F) }, /* 1e183 */
+    { cjson_u64(0x9F644AE5, 0xA4B1B325), cjson_u64(0x969EB7C4, 0x7859E743) }, /* 1e184 */
+    { cjson_u64(0x873D5D9F, 0x0DDE1FEE), cjson_u64(0xBC4665B5, 0x96706114) }, /* 1e185 */
+    { cjson_u64(0xA90CB506, 0xD155A7EA), cjson_u64(0xEB57FF22, 0xFC0C7959) }, /* 1e186 */
+    { cjson_u64(0x09A7F124, 0x42D588F2), cjson_u64(0x9316FF75, 0xDD87CBD8) }, /* 1e187 */
+    { cjson_u64(0x0C11ED6D, 0x538AEB2F), cjson_u64(0xB7DCBF53, 0x54E9BECE) }, /* 1e188 */
+    { cjson_u64(0x8F1668C8, 0xA86DA5FA), cjson_u64(0xE5D3EF28, 0x2A242E81) }, /* 1e189 */
+    { cjson_u64(0xF96E017D, 0x694487BC), cjson_u64(0x8FA47579, 0x1A569D10) }, /* 1e190 */
+    { cjson_u64(0x37C981DC, 0xC395A9AC), cjson_u64(0xB38D92D7, 0x60EC4455) }, /* 1e191 */
+    { cjson_u64(0x85BBE253, 0xF47B1417), cjson_u64(0xE070F78D, 0x3927556A) }, /* 1e192 */
+    { cjson_u64(0x93956D74, 0x78CCEC8E), cjson_u64(0x8C469AB8, 0x43B89562) }, /* 1e193 */
+    { cjson_u64(0x387AC8D1, 0x970027B2), cjson_u64(0xAF584166, 0x54A6BABB) }, /* 1e194 */
+    { cjson_u64(0x06997B05, 0xFCC0319E), cjson_u64(0xDB2E51BF, 0xE9D0696A) }, /* 1e195 */
+    { cjson_u64(0x441FECE3, 0xBDF81F03), cjson_u64(0x88FCF317, 0xF22241E2) }, /* 1e196 */
+    { cjson_u64(0xD527E81C, 0xAD7626C3), cjson_u64(0xAB3C2FDD, 0xEEAAD25A) }, /* 1e197 */
+    { cjson_u64(0x8A71E223, 0xD8D3B074), cjson_u64(0xD60B3BD5, 0x6A5586F1) }, /* 1e198 */
+    { cjson_u64(0xF6872D56, 0x67844E49), cjson_u64(0x85C70565, 0x62757456) }, /* 1e199 */
+    { cjson_u64(0xB428F8AC, 0x016561DB), cjson_u64(0xA738C6BE, 0xBB12D16C) }, /* 1e200 */
+    { cjson_u64(0xE13336D7, 0x01BEBA52), cjson_u64(0xD106F86E, 0x69D785C7) }, /* 1e201 */
+    { cjson_u64(0xECC00246, 0x61173473), cjson_u64(0x82A45B45, 0x0226B39C) }, /* 1e202 */
+    { cjson_u64(0x27F002D7, 0xF95D0190), cjson_u64(0xA34D7216, 0x42B06084) }, /* 1e203 */
+    { cjson_u64(0x31EC038D, 0xF7B441F4), cjson_u64(0xCC20CE9B, 0xD35C78A5) }, /* 1e204 */
+    { cjson_u64(0x7E670471, 0x75A15271), cjson_u64(0xFF290242, 0xC83396CE) }, /* 1e205 */
+    { cjson_u64(0x0F0062C6, 0xE984D386), cjson_u64(0x9F79A169, 0xBD203E41) }, /* 1e206 */
+    { cjson_u64(0x52C07B78, 0xA3E60868), cjson_u64(0xC75809C4, 0x2C684DD1) }, /* 1e207 */
+    { cjson_u64(0xA7709A56, 0xCCDF8A82), cjson_u64(0xF92E0C35, 0x37826145) }, /* 1e208 */
+    { cjson_u64(0x88A66076, 0x400BB691), cjson_u64(0x9BBCC7A1, 0x42B17CCB) }, /* 1e209 */
+    { cjson_u64(0x6ACFF893, 0xD00EA435), cjson_u64(0xC2ABF989, 0x935DDBFE) }, /* 1e210 */
+    { cjson_u64(0x0583F6B8, 0xC4124D43), cjson_u64(0xF356F7EB, 0xF83552FE) }, /* 1e211 */
+    { cjson_u64(0xC3727A33, 0x7A8B704A), cjson_u64(0x98165AF3, 0x7B2153DE) }, /* 1e212 */
+    { cjson_u64(0x744F18C0, 0x592E4C5C), cjson_u64(0xBE1BF1B0, 0x59E9A8D6) }, /* 1e213 */
+    { cjson_u64(0x1162DEF0, 0x6F79DF73), cjson_u64(0xEDA2EE1C, 0x7064130C) }, /* 1e214 */
+    { cjson_u64(0x8ADDCB56, 0x45AC2BA8), cjson_u64(0x9485D4D1, 0xC63E8BE7) }, /* 1e215 */
+    { cjson_u64(0x6D953E2B, 0xD7173692), cjson_u64(0xB9A74A06, 0x37CE2EE1) }, /* 1e216 */
+    { cjson_u64(0xC8FA8DB6, 0xCCDD0437), cjson_u64(0xE8111C87, 0xC5C1BA99) }, /* 1e217 */
+    { cjson_u64(0x1D9C9892, 0x400A22A2), cjson_u64(0x910AB1D4, 0xDB9914A0) }, /* 1e218 */
+    { cjson_u64(0x2503BEB6, 0xD00CAB4B), cjson_u64(0xB54D5E4A, 0x127F59C8) }, /* 1e219 */
+    { cjson_u64(0x2E44AE64, 0x840FD61D), cjson_u64(0xE2A0B5DC, 0x971F303A) }, /* 1e220 */
+    { cjson_u64(0x5CEAECFE, 0xD289E5D2), cjson_u64(0x8DA471A9, 0xDE737E24) }, /* 1e221 */
+    { cjson_u64(0x7425A83E, 0x872C5F47), cjson_u64(0xB10D8E14, 0x56105DAD) }, /* 1e222 */
+    { cjson_u64(0xD12F124E, 0x28F77719), cjson_u64(0xDD50F199, 0x6B947518) }, /* 1e223 */
+    { cjson_u64(0x82BD6B70, 0xD99AAA6F), cjson_u64(0x8A5296FF, 0xE33CC92F) }, /* 1e224 */
+    { cjson_u64(0x636CC64D, 0x1001550B), cjson_u64(0xACE73CBF, 0xDC0BFB7B) }, /* 1e225 */
+    { cjson_u64(0x3C47F7E0, 0x5401AA4E), cjson_u64(0xD8210BEF, 0xD30EFA5A) }, /* 1e226 */
+    { cjson_u64(0x65ACFAEC, 0x34810A71), cjson_u64(0x8714A775, 0xE3E95C78) }, /* 1e227 */
+    { cjson_u64(0x7F1839A7, 0x41A14D0D), cjson_u64(0xA8D9D153, 0x5CE3B396) }, /* 1e228 */
+    { cjson_u64(0x1EDE4811, 0x1209A050), cjson_u64(0xD31045A8, 0x341CA07C) }, /* 1e229 */
+    { cjson_u64(0x934AED0A, 0xAB460432), cjson_u64(0x83EA2B89, 0x2091E44D) }, /* 1e230 */
+    { cjson_u64(0xF81DA84D, 0x5617853F), cjson_u64(0xA4E4B66B, 0x68B65D60) }, /* 1e231 */
+    { cjson_u64(0x36251260, 0xAB9D668E), cjson_u64(0xCE1DE406, 0x42E3F4B9) }, /* 1e232 */
+    { cjson_u64(0xC1D72B7C, 0x6B426019), cjson_u64(0x80D2AE83, 0xE9CE78F3) }, /* 1e233 */
+    { cjson_u64(0xB24CF65B, 0x8612F81F), cjson_u64(0xA1075A24, 0xE4421730) }, /* 1e234 */
+    { cjson_u64(0xDEE033F2, 0x6797B627), cjson_u64(0xC94930AE, 0x1D529CFC) }, /* 1e235 */
+    { cjson_u64(0x169840EF, 0x017DA3B1), cjson_u64(0xFB9B7CD9, 0xA4A7443C) }, /* 1e236 */
+    { cjson_u64(0x8E1F2895, 0x60EE864E), cjson_u64(0x9D412E08, 0x06E88AA5) }, /* 1e237 */
+    { cjson_u64(0xF1A6F2BA, 0xB92A27E2), cjson_u64(0xC491798A, 0x08A2AD4E) }, /* 1e238 */
+    { cjson_u64(0xAE10AF69, 0x6774B1DB), cjson_u64(0xF5B5D7EC, 0x8ACB58A2) }, /* 1e239 */
+    { cjson_u64(0xACCA6DA1, 0xE0A8EF29), cjson_u64(0x9991A6F3, 0xD6BF1765) }, /* 1e240 */
+    { cjson_u64(0x17FD090A, 0x58D32AF3), cjson_u64(0xBFF610B0, 0xCC6EDD3F) }, /* 1e241 */
+    { cjson_u64(0xDDFC4B4C, 0xEF07F5B0), cjson_u64(0xEFF394DC, 0xFF8A948E) }, /* 1e242 */
+    { cjson_u64(0x4ABDAF10, 0x1564F98E), cjson_u64(0x95F83D0A, 0x1FB69CD9) }, /* 1e243 */
+    { cjson_u64(0x9D6D1AD4, 0x1ABE37F1), cjson_u64(0xBB764C4C, 0xA7A4440F) }, /* 1e244 */
+    { cjson_u64(0x84C86189, 0x216DC5ED), cjson_u64(0xEA53DF5F, 0xD18D5513) }, /* 1e245 */
+    { cjson_u64(0x32FD3CF5, 0xB4E49BB4), cjson_u64(0x92746B9B, 0xE2F8552C) }, /* 1e246 */
+    { cjson_u64(0x3FBC8C33, 0x221DC2A1), cjson_u64(0xB7118682, 0xDBB66A77) }, /* 1e247 */
+    { cjson_u64(0x0FABAF3F, 0xEAA5334A), cjson_u64(0xE4D5E823, 0x92A40515) }, /* 1e248 */
+    { cjson_u64(0x29CB4D87, 0xF2A7400E), cjson_u64(0x8F05B116, 0x3BA6832D) }, /* 1e249 */
+    { cjson_u64(0x743E20E9, 0xEF511012), cjson_u64(0xB2C71D5B, 0xCA9023F8) }, /* 1e250 */
+    { cjson_u64(0x914DA924, 0x6B255416), cjson_u64(0xDF78E4B2, 0xBD342CF6) }, /* 1e251 */
+    { cjson_u64(0x1AD089B6, 0xC2F7548E), cjson_u64(0x8BAB8EEF, 0xB6409C1A) }, /* 1e252 */
+    { cjson_u64(0xA184AC24, 0x73B529B1), cjson_u64(0xAE9672AB, 0xA3D0C320) }, /* 1e253 */
+    { cjson_u64(0xC9E5D72D, 0x90A2741E), cjson_u64(0xDA3C0F56, 0x8CC4F3E8) }, /* 1e254 */
+    { cjson_u64(0x7E2FA67C, 0x7A658892), cjson_u64(0x88658996, 0x17FB1871) }, /* 1e255 */
+    { cjson_u64(0xDDBB901B, 0x98FEEAB7), cjson_u64(0xAA7EEBFB, 0x9DF9DE8D) }, /* 1e256 */
+    { cjson_u64(0x552A7422, 0x7F3EA565), cjson_u64(0xD51EA6FA, 0x85785631) }, /* 1e257 */
+    { cjson_u64(0xD53A8895, 0x8F87275F), cjson_u64(0x8533285C, 0x936B35DE) }, /* 1e258 */
+    { cjson_u64(0x8A892ABA, 0xF368F137), cjson_u64(0xA67FF273, 0xB8460356) }, /* 1e259 */
+    { cjson_u64(0x2D2B7569, 0xB0432D85), cjson_u64(0xD01FEF10, 0xA657842C) }, /* 1e260 */
+    { cjson_u64(0x9C3B2962, 0x0E29FC73), cjson_u64(0x8213F56A, 0x67F6B29B) }, /* 1e261 */
+    { cjson_u64(0x8349F3BA, 0x91B47B8F), cjson_u64(0xA298F2C5, 0x01F45F42) }, /* 1e262 */
+    { cjson_u64(0x241C70A9, 0x36219A73), cjson_u64(0xCB3F2F76, 0x42717713) }, /* 1e263 */
+    { cjson_u64(0xED238CD3, 0x83AA0110), cjson_u64(0xFE0EFB53, 0xD30DD4D7) }, /* 1e264 */
+    { cjson_u64(0xF4363804, 0x324A40AA), cjson_u64(0x9EC95D14, 0x63E8A506) }, /* 1e265 */
+    { cjson_u64(0xB143C605, 0x3EDCD0D5), cjson_u64(0xC67BB459, 0x7CE2CE48) }, /* 1e266 */
+    { cjson_u64(0xDD94B786, 0x8E94050A), cjson_u64(0xF81AA16F, 0xDC1B81DA) }, /* 1e267 */
+    { cjson_u64(0xCA7CF2B4, 0x191C8326), cjson_u64(0x9B10A4E5, 0xE9913128) }, /* 1e268 */
+    { cjson_u64(0xFD1C2F61, 0x1F63A3F0), cjson_u64(0xC1D4CE1F, 0x63F57D72) }, /* 1e269 */
+    { cjson_u64(0xBC633B39, 0x673C8CEC), cjson_u64(0xF24A01A7, 0x3CF2DCCF) }, /* 1e270 */
+    { cjson_u64(0xD5BE0503, 0xE085D813), cjson_u64(0x976E4108, 0x8617CA01) }, /* 1e271 */
+    { cjson_u64(0x4B2D8644, 0xD8A74E18), cjson_u64(0xBD49D14A, 0xA79DBC82) }, /* 1e272 */
+    { cjson_u64(0xDDF8E7D6, 0x0ED1219E), cjson_u64(0xEC9C459D, 0x51852BA2) }, /* 1e273 */
+    { cjson_u64(0xCABB90E5, 0xC942B503), cjson_u64(0x93E1AB82, 0x52F33B45) }, /* 1e274 */
+    { cjson_u64(0x3D6A751F, 0x3B936243), cjson_u64(0xB8DA1662, 0xE7B00A17) }, /* 1e275 */
+    { cjson_u64(0x0CC51267, 0x0A783AD4), cjson_u64(0xE7109BFB, 0xA19C0C9D) }, /* 1e276 */
+    { cjson_u64(0x27FB2B80, 0x668B24C5), cjson_u64(0x906A617D, 0x450187E2) }, /* 1e277 */
+    { cjson_u64(0xB1F9F660, 0x802DEDF6), cjson_u64(0xB484F9DC, 0x9641E9DA) }, /* 1e278 */
+    { cjson_u64(0x5E7873F8, 0xA0396973), cjson_u64(0xE1A63853, 0xBBD26451) }, /* 1e279 */
+    { cjson_u64(0xDB0B487B, 0x6423E1E8), cjson_u64(0x8D07E334, 0x55637EB2) }, /* 1e280 */
+    { cjson_u64(0x91CE1A9A, 0x3D2CDA62), cjson_u64(0xB049DC01, 0x6ABC5E5F) }, /* 1e281 */
+    { cjson_u64(0x7641A140, 0xCC7810FB), cjson_u64(0xDC5C5301, 0xC56B75F7) }, /* 1e282 */
+    { cjson_u64(0xA9E904C8, 0x7FCB0A9D), cjson_u64(0x89B9B3E1, 0x1B6329BA) }, /* 1e283 */
+    { cjson_u64(0x546345FA, 0x9FBDCD44), cjson_u64(0xAC2820D9, 0x623BF429) }, /* 1e284 */
+    { cjson_u64(0xA97C1779, 0x47AD4095), cjson_u64(0xD732290F, 0xBACAF133) }, /* 1e285 */
+    { cjson_u64(0x49ED8EAB, 0xCCCC485D), cjson_u64(0x867F59A9, 0xD4BED6C0) }, /* 1e286 */
+    { cjson_u64(0x5C68F256, 0xBFFF5A74), cjson_u64(0xA81F3014, 0x49EE8C70) }, /* 1e287 */
+    { cjson_u64(0x73832EEC, 0x6FFF3111), cjson_u64(0xD226FC19, 0x5C6A2F8C) }, /* 1e288 */
+    { cjson_u64(0xC831FD53, 0xC5FF7EAB), cjson_u64(0x83585D8F, 0xD9C25DB7) }, /* 1e289 */
+    { cjson_u64(0xBA3E7CA8, 0xB77F5E55), cjson_u64(0xA42E74F3, 0xD032F525) }, /* 1e290 */
+    { cjson_u64(0x28CE1BD2, 0xE55F35EB), cjson_u64(0xCD3A1230, 0xC43FB26F) }, /* 1e291 */
+    { cjson_u64(0x7980D163, 0xCF5B81B3), cjson_u64(0x80444B5E, 0x7AA7CF85) }, /* 1e292 */
+    { cjson_u64(0xD7E105BC, 0xC332621F), cjson_u64(0xA0555E36, 0x1951C366) }, /* 1e293 */
+    { cjson_u64(0x8DD9472B, 0xF3FEFAA7), cjson_u64(0xC86AB5C3, 0x9FA63440) }, /* 1e294 */
+    { cjson_u64(0xB14F98F6, 0xF0FEB951), cjson_u64(0xFA856334, 0x878FC150) }, /* 1e295 */
+    { cjson_u64(0x6ED1BF9A, 0x569F33D3), cjson_u64(0x9C935E00, 0xD4B9D8D2) }, /* 1e296 */
+    { cjson_u64(0x0A862F80, 0xEC4700C8), cjson_u64(0xC3B83581, 0x09E84F07) }, /* 1e297 */
+    { cjson_u64(0xCD27BB61, 0x2758C0FA), cjson_u64(0xF4A642E1, 0x4C6262C8) }, /* 1e298 */
+    { cjson_u64(0x8038D51C, 0xB897789C), cjson_u64(0x98E7E9CC, 0xCFBD7DBD) }, /* 1e299 */
+    { cjson_u64(0xE0470A63, 0xE6BD56C3), cjson_u64(0xBF21E440, 0x03ACDD2C) }, /* 1e300 */
+    { cjson_u64(0x1858CCFC, 0xE06CAC74), cjson_u64(0xEEEA5D50, 0x04981478) }, /* 1e301 */
+    { cjson_u64(0x0F37801E, 0x0C43EBC8), cjson_u64(0x95527A52, 0x02DF0CCB) }, /* 1e302 */
+    { cjson_u64(0xD3056025, 0x8F54E6BA), cjson_u64(0xBAA718E6, 0x8396CFFD) }, /* 1e303 */
+    { cjson_u64(0x47C6B82E, 0xF32A2069), cjson_u64(0xE950DF20, 0x247C83FD) }, /* 1e304 */
+    { cjson_u64(0x4CDC331D, 0x57FA5441), cjson_u64(0x91D28B74, 0x16CDD27E) }, /* 1e305 */
+    { cjson_u64(0xE0133FE4, 0xADF8E952), cjson_u64(0xB6472E51, 0x1C81471D) }, /* 1e306 */
+    { cjson_u64(0x58180FDD, 0xD97723A6), cjson_u64(0xE3D8F9E5, 0x63A198E5) }, /* 1e307 */
+    { cjson_u64(0x570F09EA, 0xA7EA7648), cjson_u64(0x8E679C2F, 0x5E44FF8F) }, /* 1e308 */
+    { cjson_u64(0x2CD2CC65, 0x51E513DA), cjson_u64(0xB201833B, 0x35D63F73) }, /* 1e309 */
+    { cjson_u64(0xF8077F7E, 0xA65E58D1), cjson_u64(0xDE81E40A, 0x034BCF4F) }, /* 1e310 */
+    { cjson_u64(0xFB04AFAF, 0x27FAF782), cjson_u64(0x8B112E86, 0x420F6191) }, /* 1e311 */
+    { cjson_u64(0x79C5DB9A, 0xF1F9B563), cjson_u64(0xADD57A27, 0xD29339F6) }, /* 1e312 */
+    { cjson_u64(0x18375281, 0xAE7822BC), cjson_u64(0xD94AD8B1, 0xC7380874) }, /* 1e313 */
+    { cjson_u64(0x8F229391, 0x0D0B15B5), cjson_u64(0x87CEC76F, 0x1C830548) }, /* 1e314 */
+    { cjson_u64(0xB2EB3875, 0x504DDB22), cjson_u64(0xA9C2794A, 0xE3A3C69A) }, /* 1e315 */
+    { cjson_u64(0x5FA60692, 0xA46151EB), cjson_u64(0xD433179D, 0x9C8CB841) }, /* 1e316 */
+    { cjson_u64(0xDBC7C41B, 0xA6BCD333), cjson_u64(0x849FEEC2, 0x81D7F328) }, /* 1e317 */
+    { cjson_u64(0x12B9B522, 0x906C0800), cjson_u64(0xA5C7EA73, 0x224DEFF3) }, /* 1e318 */
+    { cjson_u64(0xD768226B, 0x34870A00), cjson_u64(0xCF39E50F, 0xEAE16BEF) }, /* 1e319 */
+    { cjson_u64(0xE6A11583, 0x00D46640), cjson_u64(0x81842F29, 0xF2CCE375) }, /* 1e320 */
+    { cjson_u64(0x60495AE3, 0xC1097FD0), cjson_u64(0xA1E53AF4, 0x6F801C53) }, /* 1e321 */
+    { cjson_u64(0x385BB19C, 0xB14BDFC4), cjson_u64(0xCA5E89B1, 0x8B602368) }, /* 1e322 */
+    { cjson_u64(0x46729E03, 0xDD9ED7B5), cjson_u64(0xFCF62C1D, 0xEE382C42) }, /* 1e323 */
+    { cjson_u64(0x6C07A2C2, 0x6A8346D1), cjson_u64(0x9E19DB92, 0xB4E31BA9) }, /* 1e324 */
+    { cjson_u64(0xC7098B73, 0x05241885), cjson_u64(0xC5A05277, 0x621BE293) }, /* 1e325 */
+    { cjson_u64(0xB8CBEE4F, 0xC66D1EA7), cjson_u64(0xF7086715, 0x3AA2DB38) }, /* 1e326 */
+    { cjson_u64(0x737F74F1, 0xDC043328), cjson_u64(0x9A65406D, 0x44A5C903) }, /* 1e327 */
+    { cjson_u64(0x505F522E, 0x53053FF2), cjson_u64(0xC0FE9088, 0x95CF3B44) }, /* 1e328 */
+    { cjson_u64(0x647726B9, 0xE7C68FEF), cjson_u64(0xF13E34AA, 0xBB430A15) }, /* 1e329 */
+    { cjson_u64(0x5ECA7834, 0x30DC19F5), cjson_u64(0x96C6E0EA, 0xB509E64D) }, /* 1e330 */
+    { cjson_u64(0xB67D1641, 0x3D132072), cjson_u64(0xBC789925, 0x624C5FE0) }, /* 1e331 */
+    { cjson_u64(0xE41C5BD1, 0x8C57E88F), cjson_u64(0xEB96BF6E, 0xBADF77D8) }, /* 1e332 */
+    { cjson_u64(0x8E91B962, 0xF7B6F159), cjson_u64(0x933E37A5, 0x34CBAAE7) }, /* 1e333 */
+    { cjson_u64(0x723627BB, 0xB5A4ADB0), cjson_u64(0xB80DC58E, 0x81FE95A1) }, /* 1e334 */
+    { cjson_u64(0xCEC3B1AA, 0xA30DD91C), cjson_u64(0xE61136F2, 0x227E3B09) }, /* 1e335 */
+    { cjson_u64(0x213A4F0A, 0xA5E8A7B1), cjson_u64(0x8FCAC257, 0x558EE4E6) }, /* 1e336 */
+    { cjson_u64(0xA988E2CD, 0x4F62D19D), cjson_u64(0xB3BD72ED, 0x2AF29E1F) }, /* 1e337 */
+    { cjson_u64(0x93EB1B80, 0xA33B8605), cjson_u64(0xE0ACCFA8, 0x75AF45A7) }, /* 1e338 */
+    { cjson_u64(0xBC72F130, 0x660533C3), cjson_u64(0x8C6C01C9, 0x498D8B88) }, /* 1e339 */
+    { cjson_u64(0xEB8FAD7C, 0x7F8680B4), cjson_u64(0xAF87023B, 0x9BF0EE6A) }, /* 1e340 */
+    { cjson_u64(0xA67398DB, 0x9F6820E1), cjson_u64(0xDB68C2CA, 0x82ED2A05) }, /* 1e341 */
+    { cjson_u64(0x88083F89, 0x43A1148C), cjson_u64(0x892179BE, 0x91D43A43) }, /* 1e342 */
+    { cjson_u64(0x6A0A4F6B, 0x948959B0), cjson_u64(0xAB69D82E, 0x364948D4) }, /* 1e343 */
+    { cjson_u64(0x848CE346, 0x79ABB01C), cjson_u64(0xD6444E39, 0xC3DB9B09) }, /* 1e344 */
+    { cjson_u64(0xF2D80E0C, 0x0C0B4E11), cjson_u64(0x85EAB0E4, 0x1A6940E5) }, /* 1e345 */
+    { cjson_u64(0x6F8E118F, 0x0F0E2195), cjson_u64(0xA7655D1D, 0x2103911F) }, /* 1e346 */
+    { cjson_u64(0x4B7195F2, 0xD2D1A9FB), cjson_u64(0xD13EB464, 0x69447567) }  /* 1e347 */
+};
+
+/* Eisel-Lemire: convert mantissa * 10^exponent to a double, returns false if the
+ * result can't be decided this way, the caller then has to take the slow path. */
+static cJSON_bool eisel_lemire(cjson_uint64 mantissa, const int exponent, const cJSON_bool negative, double * const number)
+{
+    const cjson_uint64 *power = NULL;
+    cjson_uint64 high = 0;
+    cjson_uint64 low = 0;
+    cjson_uint64 result_mantissa = 0;
+    cjson_uint64 result_exponent = 0;
+    cjson_uint64 most_significant_bit = 0;
+    unsigned int leading_zeros = 0;
+    long binary_exponent = 0;
+
+    if (mantissa == 0)
+    {
+        *number = negative ? -0.0 : 0.0;
+        return true;
+    }
+    if ((exponent < POWERS_OF_TEN_MIN_EXPONENT) || (exponent > POWERS_OF_TEN_MAX_EXPONENT))
     {
-        const unsigned char *second_sequence = first_sequence + 6;
-        unsigned int second_code = 0;
-        sequence_length = 12; /* \uXXXX\uXXXX */
+        return false;
+    }
+    power = powers_of_ten[exponent - POWERS_OF_TEN_MIN_EXPONENT];
 
-        if ((input_end - second_sequence) < 6)
+    /* normalization */
+    leading_zeros = leading_zeros_64(mantissa);
+    mantissa <<= leading_zeros;
+    /* floor(exponent * log2(10)) + 64 + bias, written to avoid shifting a negative number */
+    binary_exponent = 217706L * exponent;
+    binary_exponent = (binary_exponent >= 0) ? (binary_exponent >> 16) : -((-binary_exponent + 65535L) >> 16);
+    result_exponent = (cjson_uint64)(binary_exponent + 64 + 1023) - leading_zeros;
+
+    /* multiplication */
+    low = multiply_64x64(mantissa, power[1], &high);
+
+    /* wider approximation */
+    if (((high & 0x1FF) == 0x1FF) && ((low + mantissa) < mantissa))
+    {
+        cjson_uint64 wider_high = 0;
+        const cjson_uint64 wider_low = multiply_64x64(mantissa, power[0], &wider_high);
+        cjson_uint64 merged_high = high;
+        const cjson_uint64 merged_low = low + wider_high;
+        if (merged_low < low)
         {
-            /* input ends unexpectedly */
-            goto fail;
+            merged_high++;
         }
-
-        if ((second_sequence[0] != '\\') || (second_sequence[1] != 'u'))
+        if (((merged_high & 0x1FF) == 0x1FF) && ((merged_low + 1) == 0) && ((wider_low + mantissa) < mantissa))
         {
-            /* missing second half of the surrogate pair */
-            goto fail;
+            return false;
         }
+        high = merged_high;
+        low = merged_low;
+    }
 
-        /* get the second utf16 sequence */
-        second_code = parse_hex4(second_sequence + 2);
-        /* check that the code is valid */
-        if ((second_code < 0xDC00) || (second_code > 0xDFFF))
-        {
-            /* invalid second half of the surrogate pair */
-            goto fail;
-        }
+    /* shift to 54 bits */
+    most_significant_bit = high >> 63;
+    result_mantissa = high >> (most_significant_bit + 9);
+    result_exponent -= 1 ^ most_significant_bit;
 
-
-        /* calculate the unicode codepoint from the surrogate pair */
-        codepoint = 0x10000 + (((first_code & 0x3FF) << 10) | (second_code & 0x3FF));
+    /* halfway ambiguity */
+    if ((low == 0) && ((high & 0x1FF) == 0) && ((result_mantissa & 3) == 1))
+    {
+        return false;
     }
-    else
+
+    /* from 54 to 53 bits */
+    result_mantissa += result_mantissa & 1;
+    result_mantissa >>= 1;
+    if ((result_mantissa >> 53) > 0)
     {
-        sequence_length = 6; /* \uXXXX */
-        codepoint = first_code;
+        result_mantissa >>= 1;
+        result_exponent++;
     }
 
-    /* encode as UTF-8
-     * takes at maximum 4 bytes to encode:
-     * 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx */
-    if (codepoint < 0x80)
+    /* subnormal, infinite or NaN results are left to the slow path */
+    if ((result_exponent - 1) >= (0x7FF - 1))
     {
-        /* normal ascii, encoding 0xxxxxxx */
-        utf8_length = 1;
+        return false;
     }
-    else if (codepoint < 0x800)
+
+    *number = double_from_bits((result_exponent << 52) | (result_mantissa & cjson_u64(0x000FFFFF, 0xFFFFFFFF)) | (negative ? cjson_u64(0x80000000, 0) : 0));
+    return true;
+}
+
+/* Arbitrary precision decimal for the cases Eisel-Lemire can't decide.
+ * The value is 0.digits * 10^decimal_point, 800 digits are enough to round every double exactly. */
+#define DECIMAL_MAX_DIGITS 800
+typedef struct
+{
+    unsigned char digits[DECIMAL_MAX_DIGITS]; /* 0 to 9, not ASCII */
+    int count;
+    int decimal_point;
+    cJSON_bool truncated; /* nonzero digits were dropped */
+} decimal;
+
+static void decimal_trim(decimal * const number)
+{
+    while ((number->count > 0) && (number->digits[number->count - 1] == 0))
     {
-        /* two bytes, encoding 110xxxxx 10xxxxxx */
-        utf8_length = 2;
-        first_byte_mark = 0xC0; /* 11000000 */
+        number->count--;
     }
-    else if (codepoint < 0x10000)
+    if (number->count == 0)
     {
-        /* three bytes, encoding 1110xxxx 10xxxxxx 10xxxxxx */
-        utf8_length = 3;
-        first_byte_mark = 0xE0; /* 11100000 */
+        number->decimal_point = 0;
     }
-    else if (codepoint <= 0x10FFFF)
+}
+
+/* multiply by 2^shift, shift must be at most 60 */
+static void decimal_left_shift(decimal * const number, const unsigned int shift)
+{
+    cjson_uint64 carry = 0;
+    int read = 0;
+    int write = 0;
+    int new_digits = 0;
+
+    /* dry run to find out how many digits the result has */
+    for (read = number->count - 1; read >= 0; read--)
     {
-        /* four bytes, encoding 1110xxxx 10xxxxxx 10xxxxxx 10xxxxxx */
-        utf8_length = 4;
-        first_byte_mark = 0xF0; /* 11110000 */
+        carry = (carry + ((cjson_uint64)number->digits[read] << shift)) / 10;
     }
-    else
+    for (; carry > 0; carry /= 10)
     {
-        /* invalid unicode codepoint */
-        goto fail;
+        new_digits++;
     }
 
-    /* encode as utf8 */
-    for (utf8_position = (unsigned char)(utf8_length - 1); utf8_position > 0; utf8_position--)
+    write = number->count + new_digits;
+    for (read = number->count - 1; read >= 0; read--)
     {
-        /* 10xxxxxx */
-        (*output_pointer)[utf8_position] = (unsigned char)((codepoint | 0x80) & 0xBF);
-        codepoint >>= 6;
+        const cjson_uint64 value = carry + ((cjson_uint64)number->digits[read] << shift);
+        const cjson_uint64 quotient = value / 10;
+        const unsigned char remainder = (unsigned char)(value - (10 * quotient));
+        write--;
+        if (write < DECIMAL_MAX_DIGITS)
+        {
+            number->digits[write] = remainder;
+        }
+        else if (remainder != 0)
+        {
+            number->truncated = true;
+        }
+        carry = quotient;
     }
-    /* encode first byte */
-    if (utf8_length > 1)
+    while (carry > 0)
     {
-        (*output_pointer)[0] = (unsigned char)((codepoint | first_byte_mark) & 0xFF);
+        const cjson_uint64 quotient = carry / 10;
+        write--;
+        number->digits[write] = (unsigned char)(carry - (10 * quotient));
+        carry = quotient;
     }
-    else
+
+    number->count += new_digits;
+    if (number->count > DECIMAL_MAX_DIGITS)
     {
-        (*output_pointer)[0] = (unsigned char)(codepoint & 0x7F);
+        number->count = DECIMAL_MAX_DIGITS;
     }
-
-    *output_pointer += utf8_length;
-
-    return sequence_length;
-
-fail:
-    return 0;
+    number->decimal_point += new_digits;
+    decimal_trim(number);
 }
 
-/* Parse the input text into an unescaped cinput, and populate item. */
-static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_buffer)
+/* divide by 2^shift, shift must be at most 60 */
+static void decimal_right_shift(decimal * const number, const unsigned int shift)
 {
-    const unsigned char *input_pointer = buffer_at_offset(input_buffer) + 1;
-    const unsigned char *input_end = buffer_at_offset(input_buffer) + 1;
-    unsigned char *output_pointer = NULL;
-    unsigned char *output = NULL;
-
-    /* not a string */
-    if (buffer_at_offset(input_buffer)[0] != '\"')
-    {
-        goto fail;
-    }
+    const cjson_uint64 mask = (((cjson_uint64)1) << shift) - 1;
+    cjson_uint64 value = 0;
+    int read = 0;
+    int write = 0;
 
+    /* skip the leading digits that become zero */
+    for (; (value >> shift) == 0; read++)
     {
-        /* calculate approximate size of the output (overestimate) */
-        size_t allocation_length = 0;
-        size_t skipped_bytes = 0;
-        while (((size_t)(input_end - input_buffer->content) < input_buffer->length) && (*input_end != '\"'))
+        if (read >= number->count)
         {
-            /* is escape sequence */
-            if (input_end[0] == '\\')
+            if (value == 0)
             {
-                if ((size_t)(input_end + 1 - input_buffer->content) >= input_buffer->length)
-                {
-                    /* prevent buffer overflow when last input character is a backslash */
-                    goto fail;
-                }
-                skipped_bytes++;
-                input_end++;
+                number->count = 0;
+                return;
             }
-            input_end++;
-        }
-        if (((size_t)(input_end - input_buffer->content) >= input_buffer->length) || (*input_end != '\"'))
-        {
-            goto fail; /* string ended unexpectedly */
-        }
-
-        /* This is at most how much we need for the output */
-        allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
-        if (output == NULL)
-        {
-            goto fail; /* allocation failure */
+            while ((value >> shift) == 0)
+            {
+                value *= 10;
+                read++;
+            }
+            break;
         }
+        value = (value * 10) + number->digits[read];
     }
+    number->decimal_point -= read - 1;
 
-    output_pointer = output;
-    /* loop through the string literal */
-    while (input_pointer < input_end)
+    for (; read < number->count; read++)
     {
-        if (*input_pointer != '\\')
+        const unsigned char digit = (unsigned char)(value >> shift);
+        value &= mask;
+        number->digits[write++] = digit;
+        value = (value * 10) + number->digits[read];
+    }
+    while (value > 0)
+    {
+        const unsigned char digit = (unsigned char)(value >> shift);
+        value &= mask;
+        if (write < DECIMAL_MAX_DIGITS)
         {
-            *output_pointer++ = *input_pointer++;
+            number->digits[write++] = digit;
         }
-        /* escape sequence */
-        else
+        else if (digit > 0)
         {
-            unsigned char sequence_length = 2;
-            if ((input_end - input_pointer) < 1)
-            {
-                goto fail;
-            }
-
-            switch (input_pointer[1])
-            {
-                case 'b':
-                    *output_pointer++ = '\b';
-                    break;
-                case 'f':
-                    *output_pointer++ = '\f';
-                    break;
-                case 'n':
-                    *output_pointer++ = '\n';
-                    break;
-                case 'r':
-                    *output_pointer++ = '\r';
-                    break;
-                case 't':
-                    *output_pointer++ = '\t';
-                    break;
-                case '\"':
-                case '\\':
-                case '/':
-                    *output_pointer++ = input_pointer[1];
-                    break;
-
-                /* UTF-16 literal */
-                case 'u':
-                    sequence_length = utf16_literal_to_utf8(input_pointer, input_end, &output_pointer);
-                    if (sequence_length == 0)
-                    {
-                        /* failed to convert UTF16-literal to UTF-8 */
-                        goto fail;
-                    }
-                    break;
-
-                default:
-                    goto fail;
-            }
-            input_pointer += sequence_length;
+            number->truncated = true;
         }
+        value *= 10;
     }
 
-    /* zero terminate the output */
-    *output_pointer = '\0';
-
-    item->type = cJSON_String;
-    item->valuestring = (char*)output;
-
-    input_buffer->offset = (size_t) (input_end - input_buffer->content);
-    input_buffer->offset++;
-
-    return true;
+    number->count = write;
+    decimal_trim(number);
+}
 
-fail:
-    if (output != NULL)
+static void decimal_shift(decimal * const number, int shift)
+{
+    if (number->count == 0)
     {
-        input_buffer->hooks.deallocate(output);
-        output = NULL;
+        return;
     }
-
-    if (input_pointer != NULL)
+    for (; shift > 60; shift -= 60)
     {
-        input_buffer->offset = (size_t)(input_pointer - input_buffer->content);
+        decimal_left_shift(number, 60);
+    }
+    if (shift > 0)
+    {
+        decimal_left_shift(number, (unsigned int)shift);
+    }
+    for (; shift < -60; shift += 60)
+    {
+        decimal_right_shift(number, 60);
+    }
+    if (shift < 0)
+    {
+        decimal_right_shift(number, (unsigned int)-shift);
     }
-
-    return false;
 }
 
-/* Render the cstring provided to an escaped version that can be printed. */
-static cJSON_bool print_string_ptr(const unsigned char * const input, printbuffer * const output_buffer)
+/* integer part of the number, rounded half to even */
+static cjson_uint64 decimal_rounded_integer(const decimal * const number)
 {
-    const unsigned char *input_pointer = NULL;
-    unsigned char *output = NULL;
-    unsigned char *output_pointer = NULL;
-    size_t output_length = 0;
-    /* numbers of additional characters needed for escaping */
-    size_t escape_characters = 0;
+    cjson_uint64 value = 0;
+    cJSON_bool round_up = false;
+    int i = 0;
 
-    if (output_buffer == NULL)
+    if (number->decimal_point > 20)
     {
-        return false;
+        return ~((cjson_uint64)0);
     }
-
-    /* empty string */
-    if (input == NULL)
+    for (i = 0; (i < number->decimal_point) && (i < number->count); i++)
     {
-        output = ensure(output_buffer, sizeof("\"\""));
-        if (output == NULL)
-        {
-            return false;
-        }
-        strcpy((char*)output, "\"\"");
-
-        return true;
+        value = (value * 10) + number->digits[i];
+    }
+    for (; i < number->decimal_point; i++)
+    {
+        value *= 10;
     }
 
-    /* set "flag" to 1 if something needs to be escaped */
-    for (input_pointer = input; *input_pointer; input_pointer++)
+    if ((number->decimal_point >= 0) && (number->decimal_point < number->count))
     {
-        switch (*input_pointer)
+        const int position = number->decimal_point;
+        if ((number->digits[position] == 5) && ((position + 1) == number->count))
         {
-            case '\"':
-            case '\\':
-            case '\b':
-            case '\f':
-            case '\n':
-            case '\r':
-            case '\t':
-                /* one character escape sequence */
-                escape_characters++;
-                break;
-            default:
-                if (*input_pointer < 32)
-                {
-                    /* UTF-16 escape sequence uXXXX */
-                    escape_characters += 5;
-                }
-                break;
+            /* exactly halfway */
+            round_up = number->truncated || ((position > 0) && (number->digits[position - 1] & 1));
+        }
+        else
+        {
+            round_up = number->digits[position] >= 5;
         }
     }
-    output_length = (size_t)(input_pointer - input) + escape_characters;
 
-    output = ensure(output_buffer, output_length + sizeof("\"\""));
-    if (output == NULL)
+    return round_up ? (value + 1) : value;
+}
+
+/* exact, but slow conversion of a decimal to a double */
+static double decimal_to_double(decimal * const number, const cJSON_bool negative)
+{
+    /* number of bits that can be shifted at once for a given decimal point */
+    static const int shifts[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    const int max_shift_index = (int)(sizeof(shifts) / sizeof(shifts[0])) - 1;
+    const cjson_uint64 sign = negative ? cjson_u64(0x80000000, 0) : 0;
+    cjson_uint64 mantissa = 0;
+    int exponent = 0;
+
+    if ((number->count == 0) || (number->decimal_point < -330))
     {
-        return false;
+        return double_from_bits(sign);
+    }
+    if (number->decimal_point > 310)
+    {
+        goto overflow;
     }
 
-    /* no characters have to be escaped */
-    if (escape_characters == 0)
+    /* scale into [1/2, 1) */
+    while (number->decimal_point > 0)
     {
-        output[0] = '\"';
-        memcpy(output + 1, input, output_length);
-        output[output_length + 1] = '\"';
-        output[output_length + 2] = '\0';
+        const int shift = (number->decimal_point > max_shift_index) ? 27 : shifts[number->decimal_point];
+        decimal_shift(number, -shift);
+        exponent += shift;
+    }
+    while ((number->decimal_point < 0) || ((number->decimal_point == 0) && (number->digits[0] < 5)))
+    {
+        const int shift = (-number->decimal_point > max_shift_index) ? 27 : shifts[-number->decimal_point];
+        decimal_shift(number, shift);
+        exponent -= shift;
+    }
 
-        return true;
+    /* [1/2, 1) to [1, 2) */
+    exponent--;
+
+    /* subnormal */
+    if (exponent < -1022)
+    {
+        decimal_shift(number, exponent + 1022);
+        exponent = -1022;
+    }
+    if ((exponent + 1023) >= 0x7FF)
+    {
+        goto overflow;
     }
 
-    output[0] = '\"';
-    output_pointer = output + 1;
-    /* copy the string */
-    for (input_pointer = input; *input_pointer != '\0'; (void)input_pointer++, output_pointer++)
+    decimal_shift(number, 53);
+    mantissa = decimal_rounded_integer(number);
+    /* rounding might have added a bit */
+    if (mantissa == (((cjson_uint64)2) << 52))
     {
-        if ((*input_pointer > 31) && (*input_pointer != '\"') && (*input_pointer != '\\'))
+        mantissa >>= 1;
+        exponent++;
+        if ((exponent + 1023) >= 0x7FF)
         {
-            /* normal character, copy */
-            *output_pointer = *input_pointer;
+            goto overflow;
         }
-        else
-        {
-            /* character needs to be escaped */
-            *output_pointer++ = '\\';
+    }
+    if (!(mantissa & (((cjson_uint64)1) << 52)))
+    {
+        exponent = -1023;
+    }
+
+    return double_from_bits(sign | ((cjson_uint64)(exponent + 1023) << 52) | (mantissa & cjson_u64(0x000FFFFF, 0xFFFFFFFF)));
+
+overflow:
+    return double_from_bits(sign | cjson_u64(0x7FF00000, 0));
+}
+
+/* exactly representable powers of ten for the fast path */
+static const double exact_powers_of_ten[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* The fast path relies on every operation being rounded to double, which isn't the case with x87 */
+#if (defined(__i386__) || defined(_M_IX86)) && !defined(__SSE2_MATH__) && !(defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CJSON_NO_EXACT_FAST_PATH
+#endif
+
+/* Locale independent, correctly rounded conversion of the number at the start of input.
+ * Reads exactly the prefix that strtod would read from the characters of a JSON number
+ * (which is a bit more than JSON allows, e.g. "01" or "1."), returns its length or 0 if there is no number. */
+static size_t parse_decimal(const unsigned char * const input, const size_t length, double * const number)
+{
+    const unsigned char *const end = input + length;
+    const unsigned char *pointer = input;
+    const unsigned char *mantissa_start = NULL;
+    const unsigned char *mantissa_end = NULL;
+    cJSON_bool negative = false;
+    cjson_uint64 mantissa = 0;
+    int significant_digits = 0;
+    int digits = 0;
+    int exponent = 0;
+    long explicit_exponent = 0;
+    cJSON_bool truncated = false;
+
+    if ((pointer < end) && (*pointer == '-'))
+    {
+        negative = true;
+        pointer++;
+    }
+
+    /* mantissa, leading zeros don't count towards the 19 digits that fit */
+    mantissa_start = pointer;
+    for (; (pointer < end) && (*pointer >= '0') && (*pointer <= '9'); pointer++)
+    {
+        digits++;
+        if ((mantissa == 0) && (*pointer == '0'))
+        {
+            continue;
+        }
+        if (significant_digits < 19)
+        {
+            mantissa = (mantissa * 10) + (cjson_uint64)(*pointer - '0');
+            significant_digits++;
+        }
+        else
+        {
+            exponent++;
+            truncated |= (*pointer != '0');
+        }
+    }
+    if ((pointer < end) && (*pointer == '.'))
+    {
+        for (pointer++; (pointer < end) && (*pointer >= '0') && (*pointer <= '9'); pointer++)
+        {
+            digits++;
+            if ((mantissa == 0) && (*pointer == '0'))
+            {
+                exponent--;
+                continue;
+            }
+            if (significant_digits < 19)
+            {
+                mantissa = (mantissa * 10) + (cjson_uint64)(*pointer - '0');
+                significant_digits++;
+                exponent--;
+            }
+            else
+            {
+                truncated |= (*pointer != '0');
+            }
+        }
+    }
+    if (digits == 0)
+    {
+        return 0;
+    }
+    mantissa_end = pointer;
+
+    /* exponent, only consumed if there are digits */
+    if ((pointer < end) && ((*pointer == 'e') || (*pointer == 'E')))
+    {
+        const unsigned char *exponent_pointer = pointer + 1;
+        cJSON_bool negative_exponent = false;
+        if ((exponent_pointer < end) && ((*exponent_pointer == '+') || (*exponent_pointer == '-')))
+        {
+            negative_exponent = (*exponent_pointer == '-');
+            exponent_pointer++;
+        }
+        if ((exponent_pointer < end) && (*exponent_pointer >= '0') && (*exponent_pointer <= '9'))
+        {
+            for (; (exponent_pointer < end) && (*exponent_pointer >= '0') && (*exponent_pointer <= '9'); exponent_pointer++)
+            {
+                /* anything beyond this over- or underflows anyway */
+                if (explicit_exponent < 100000)
+                {
+                    explicit_exponent = (explicit_exponent * 10) + (*exponent_pointer - '0');
+                }
+            }
+            if (negative_exponent)
+            {
+                explicit_exponent = -explicit_exponent;
+            }
+            pointer = exponent_pointer;
+        }
+    }
+    exponent += (int)explicit_exponent;
+
+    if (!truncated)
+    {
+#if !defined(CJSON_NO_EXACT_FAST_PATH)
+        /* both operands are exact, so a single rounding gives the correct result */
+        if ((mantissa >> 53) == 0)
+        {
+            double value = (double)mantissa;
+            if (negative)
+            {
+                value = -value;
+            }
+            if ((exponent >= 0) && (exponent <= 22))
+            {
+                *number = value * exact_powers_of_ten[exponent];
+                return (size_t)(pointer - input);
+            }
+            if ((exponent < 0) && (exponent >= -22))
+            {
+                *number = value / exact_powers_of_ten[-exponent];
+                return (size_t)(pointer - input);
+            }
+        }
+#endif
+        if (eisel_lemire(mantissa, exponent, negative, number))
+        {
+            return (size_t)(pointer - input);
+        }
+    }
+
+    /* slow path, parse the digits again into an arbitrary precision decimal */
+    {
+        decimal big = { { 0 }, 0, 0, false };
+        cJSON_bool seen_decimal_point = false;
+        const unsigned char *digit = mantissa_start;
+        for (; digit < mantissa_end; digit++)
+        {
+            if (*digit == '.')
+            {
+                seen_decimal_point = true;
+                big.decimal_point = big.count;
+                continue;
+            }
+            if ((big.count == 0) && (*digit == '0'))
+            {
+                /* leading zeros */
+                big.decimal_point--;
+                continue;
+            }
+            if (big.count < DECIMAL_MAX_DIGITS)
+            {
+                big.digits[big.count++] = (unsigned char)(*digit - '0');
+            }
+            else if (*digit != '0')
+            {
+                big.truncated = true;
+            }
+        }
+        if (!seen_decimal_point)
+        {
+            big.decimal_point = big.count;
+        }
+        big.decimal_point += (int)explicit_exponent;
+        decimal_trim(&big);
+
+        *number = decimal_to_double(&big, negative);
+    }
+
+    return (size_t)(pointer - input);
+}
+
+/* Parse the input text to generate a number, and populate the result into item. */
+static cJSON_bool parse_number(cJSON * const item, parse_buffer * const input_buffer)
+{
+    double number = 0;
+    size_t number_length = 0;
+
+    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    {
+        return false;
+    }
+
+    number_length = parse_decimal(buffer_at_offset(input_buffer), input_buffer->length - input_buffer->offset, &number);
+    if (number_length == 0)
+    {
+        return false; /* parse_error */
+    }
+
+    item->valuedouble = number;
+
+    /* use saturation in case of overflow */
+    if (number >= INT_MAX)
+    {
+        item->valueint = INT_MAX;
+    }
+    else if (number <= (double)INT_MIN)
+    {
+        item->valueint = INT_MIN;
+    }
+    else
+    {
+        item->valueint = (int)number;
+    }
+
+    item->type = cJSON_Number;
+
+    input_buffer->offset += number_length;
+    return true;
+}
+
+/* don't ask me, but the original cJSON_SetNumberValue returns an integer or double */
+CJSON_PUBLIC(double) cJSON_SetNumberHelper(cJSON *object, double number)
+{
+    if (number >= INT_MAX)
+    {
+        object->valueint = INT_MAX;
+    }
+    else if (number <= (double)INT_MIN)
+    {
+        object->valueint = INT_MIN;
+    }
+    else
+    {
+        object->valueint = (int)number;
+    }
+
+    return object->valuedouble = number;
+}
+
+/* Note: when passing a NULL valuestring, cJSON_SetValuestring treats this as an error and return NULL */
+CJSON_PUBLIC(char*) cJSON_SetValuestring(cJSON *object, const char *valuestring)
+{
+    char *copy = NULL;
+    size_t v1_len;
+    size_t v2_len;
+    /* if object's type is not cJSON_String or is cJSON_IsReference, it should not set valuestring */
+    if ((object == NULL) || !(object->type & cJSON_String) || (object->type & cJSON_IsReference))
+    {
+        return NULL;
+    }
+    /* return NULL if the object is corrupted or valuestring is NULL */
+    if (object->valuestring == NULL || valuestring == NULL)
+    {
+        return NULL;
+    }
+
+    v1_len = strlen(valuestring);
+    v2_len = strlen(object->valuestring);
+
+    if (v1_len <= v2_len)
+    {
+        /* strcpy does not handle overlapping string: [X1, X2] [Y1, Y2] => X2 < Y1 or Y2 < X1 */
+        if (!( valuestring + v1_len < object->valuestring || object->valuestring + v2_len < valuestring ))
+        {
+            return NULL;
+        }
+        strcpy(object->valuestring, valuestring);
+        return object->valuestring;
+    }
+    copy = (char*) cJSON_strdup((const unsigned char*)valuestring, &global_hooks);
+    if (copy == NULL)
+    {
+        return NULL;
+    }
+    if (object->valuestring != NULL)
+    {
+        cJSON_free(object->valuestring);
+    }
+    object->valuestring = copy;
+
+    return copy;
+}
+
+typedef struct
+{
+    unsigned char *buffer;
+    size_t length;
+    size_t offset;
+    size_t depth; /* current nesting depth (for formatted printing) */
+    cJSON_bool noalloc;
+    cJSON_bool format; /* is this print a formatted print */
+    internal_hooks hooks;
+    cJSON_WriteCallback writer; /* when set, full buffers are handed to it instead of growing */
+    void *writer_data;
+} printbuffer;
+
+/* hand everything printed so far to the writer and start over at the beginning of the buffer */
+static cJSON_bool flush_printbuffer(printbuffer * const p)
+{
+    if ((p->offset > 0) && !p->writer(p->writer_data, (const char*)p->buffer, p->offset))
+    {
+        return false;
+    }
+    p->offset = 0;
+    p->buffer[0] = '\0';
+
+    return true;
+}
+
+/* realloc printbuffer if necessary to have at least "needed" bytes more */
+static unsigned char* ensure(printbuffer * const p, size_t needed)
+{
+    unsigned char *newbuffer = NULL;
+    size_t newsize = 0;
+
+    if ((p == NULL) || (p->buffer == NULL))
+    {
+        return NULL;
+    }
+
+    if ((p->length > 0) && (p->offset >= p->length))
+    {
+        /* make sure that offset is valid */
+        return NULL;
+    }
+
+    if (needed > INT_MAX)
+    {
+        /* sizes bigger than INT_MAX are currently not supported */
+        return NULL;
+    }
+
+    /* everything before offset is complete, so a streaming print can flush it instead of growing */
+    if ((p->writer != NULL) && ((needed + p->offset + 1) > p->length) && !flush_printbuffer(p))
+    {
+        return NULL;
+    }
+
+    needed += p->offset + 1;
+    if (needed <= p->length)
+    {
+        return p->buffer + p->offset;
+    }
+
+    if (p->noalloc) {
+        return NULL;
+    }
+
+    /* calculate new buffer size */
+    if (needed > (INT_MAX / 2))
+    {
+        /* overflow of int, use INT_MAX if possible */
+        if (needed <= INT_MAX)
+        {
+            newsize = INT_MAX;
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+    else if (p->writer != NULL)
+    {
+        /* only grows for a single token that doesn't fit a chunk */
+        newsize = needed;
+    }
+    else
+    {
+        newsize = needed * 2;
+    }
+
+    if (p->hooks.reallocate != NULL)
+    {
+        /* reallocate with realloc if available */
+        newbuffer = (unsigned char*)p->hooks.reallocate(p->buffer, newsize);
+        if (newbuffer == NULL)
+        {
+            p->hooks.deallocate(p->buffer);
+            p->length = 0;
+            p->buffer = NULL;
+
+            return NULL;
+        }
+    }
+    else
+    {
+        /* otherwise reallocate manually */
+        newbuffer = (unsigned char*)p->hooks.allocate(newsize);
+        if (!newbuffer)
+        {
+            p->hooks.deallocate(p->buffer);
+            p->length = 0;
+            p->buffer = NULL;
+
+            return NULL;
+        }
+
+        memcpy(newbuffer, p->buffer, p->offset + 1);
+        p->hooks.deallocate(p->buffer);
+    }
+    p->length = newsize;
+    p->buffer = newbuffer;
+
+    return newbuffer + p->offset;
+}
+
+/* calculate the new length of the string in a printbuffer and update the offset */
+static void update_offset(printbuffer * const buffer)
+{
+    const unsigned char *buffer_pointer = NULL;
+    if ((buffer == NULL) || (buffer->buffer == NULL))
+    {
+        return;
+    }
+    buffer_pointer = buffer->buffer + buffer->offset;
+
+    buffer->offset += strlen((const char*)buffer_pointer);
+}
+
+/* securely comparison of floating-point variables */
+static cJSON_bool compare_double(double a, double b)
+{
+    double maxVal = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+    return (fabs(a - b) <= maxVal * DBL_EPSILON);
+}
+
+/* Ryu: shortest decimal representation that rounds back to the same double.
+ * Tables of 125 bit approximations of 5^-i (rounded up) and 5^i (rounded down), stored as { low, high } */
+#define POW5_INV_BITCOUNT 125
+#define POW5_BITCOUNT 125
+static const cjson_uint64 pow5_inverse_split[][2] =
+{
+    { cjson_u64(0x00000000, 0x00000001), cjson_u64(0x20000000, 0x00000000) }, /* 5^-0 */
+    { cjson_u64(0x99999999, 0x9999999A), cjson_u64(0x19999999, 0x99999999) }, /* 5^-1 */
+    { cjson_u64(0x47AE147A, 0xE147AE15), cjson_u64(0x147AE147, 0xAE147AE1) }, /* 5^-2 */
+    { cjson_u64(0x6C8B4395, 0x810624DE), cjson_u64(0x10624DD2, 0xF1A9FBE7) }, /* 5^-3 */
+    { cjson_u64(0x7A786C22, 0x6809D496), cjson_u64(0x1A36E2EB, 0x1C432CA5) }, /* 5^-4 */
+    { cjson_u64(0x61F9F01B, 0x866E43AB), cjson_u64(0x14F8B588, 0xE368F084) }, /* 5^-5 */
+    { cjson_u64(0xB4C7F349, 0x38583622), cjson_u64(0x10C6F7A0, 0xB5ED8D36) }, /* 5^-6 */
+    { cjson_u64(0x87A6520E, 0xC08D236A), cjson_u64(0x1AD7F29A, 0xBCAF4857) }, /* 5^-7 */
+    { cjson_u64(0x9FB841A5, 0x66D74F88), cjson_u64(0x15798EE2, 0x308C39DF) }, /* 5^-8 */
+    { cjson_u64(0xE62D0151, 0x1F12A607), cjson_u64(0x112E0BE8, 0x26D694B2) }, /* 5^-9 */
+    { cjson_u64(0xD6AE6881, 0xCB5109A4), cjson_u64(0x1B7CDFD9, 0xD7BDBAB7) }, /* 5^-10 */
+    { cjson_u64(0xDEF1ED34, 0xA2A73AEA), cjson_u64(0x15FD7FE1, 0x7964955F) }, /* 5^-11 */
+    { cjson_u64(0x7F27F0F6, 0xE885C8BB), cjson_u64(0x11979981, 0x2DEA1119) }, /* 5^-12 */
+    { cjson_u64(0x650CB4BE, 0x40D60DF8), cjson_u64(0x1C25C268, 0x497681C2) }, /* 5^-13 */
+    { cjson_u64(0xEA709098, 0x33DE7193), cjson_u64(0x16849B86, 0xA12B9B01) }, /* 5^-14 */
+    { cjson_u64(0x21F3A6E0, 0x297EC143), cjson_u64(0x1203AF9E, 0xE756159B) }, /* 5^-15 */
+    { cjson_u64(0x6985D7CD, 0x0F313537), cjson_u64(0x1CD2B297, 0xD889BC2B) }, /* 5^-16 */
+    { cjson_u64(0x2137DFD7, 0x3F5A90F9), cjson_u64(0x170EF546, 0x46D49689) }, /* 5^-17 */
+    { cjson_u64(0xE75FE645, 0xCC4873FA), cjson_u64(0x12725DD1, 0xD243ABA0) }, /* 5^-18 */
+    { cjson_u64(0xA5663D3C, 0x7A0D865D), cjson_u64(0x1D83C94F, 0xB6D2AC34) }, /* 5^-19 */
+    { cjson_u64(0x511E9763, 0x94D79EB1), cjson_u64(0x179CA10C, 0x9242235D) }, /* 5^-20 */
+    { cjson_u64(0xDA7EDF82, 0xDD794BC1), cjson_u64(0x12E3B40A, 0x0E9B4F7D) }, /* 5^-21 */
+    { cjson_u64(0x2A6498D1, 0x625BAC68), cjson_u64(0x1E392010, 0x175EE596) }, /* 5^-22 */
+    { cjson_u64(0xEEB6E0A7, 0x81E2F053), cjson_u64(0x182DB340, 0x12B25144) }, /* 5^-23 */
+    { cjson_u64(0x58924D52, 0xCE4F26A9), cjson_u64(0x1357C299, 0xA88EA76A) }, /* 5^-24 */
+    { cjson_u64(0x27507BB7, 0xB07EA441), cjson_u64(0x1EF2D0F5, 0xDA7DD8AA) }, /* 5^-25 */
+    { cjson_u64(0x52A6C95F, 0xC0655034), cjson_u64(0x18C240C4, 0xAECB13BB) }, /* 5^-26 */
+    { cjson_u64(0x0EEBD44C, 0x99EAA690), cjson_u64(0x13CE9A36, 0xF23C0FC9) }, /* 5^-27 */
+    { cjson_u64(0xB17953AD, 0xC3110A80), cjson_u64(0x1FB0F6BE, 0x50601941) }, /* 5^-28 */
+    { cjson_u64(0xC12DDC8B, 0x02740867), cjson_u64(0x195A5EFE, 0xA6B34767) }, /* 5^-29 */
+    { cjson_u64(0x3424B06F, 0x3529A052), cjson_u64(0x14484BFE, 0xEBC29F86) }, /* 5^-30 */
+    { cjson_u64(0x901D59F2, 0x90EE19DB), cjson_u64(0x1039D665, 0x89687F9E) }, /* 5^-31 */
+    { cjson_u64(0x4CFBC31D, 0xB4B0295F), cjson_u64(0x19F623D5, 0xA8A73297) }, /* 5^-32 */
+    { cjson_u64(0x3D9635B1, 0x5D59BAB2), cjson_u64(0x14C4E977, 0xBA1F5BAC) }, /* 5^-33 */
+    { cjson_u64(0x97AB5E27, 0x7DE16228), cjson_u64(0x109D8792, 0xFB4C4956) }, /* 5^-34 */
+    { cjson_u64(0xF2ABC9D8, 0xC9689D0D), cjson_u64(0x1A95A5B7, 0xF87A0EF0) }, /* 5^-35 */
+    { cjson_u64(0x5BBCA17A, 0x3ABA173E), cjson_u64(0x15448493, 0x2D2E725A) }, /* 5^-36 */
+    { cjson_u64(0xAFCA1AC8, 0x2EFB45CB), cjson_u64(0x11039D42, 0x8A8B8EAE) }, /* 5^-37 */
+    { cjson_u64(0xB2DCF7A6, 0xB1920945), cjson_u64(0x1B38FB9D, 0xAA78E44A) }, /* 5^-38 */
+    { cjson_u64(0xF57D92EB, 0xC141A104), cjson_u64(0x15C72FB1, 0x552D836E) }, /* 5^-39 */
+    { cjson_u64(0xC4647589, 0x6767B403), cjson_u64(0x116C2627, 0x77579C58) }, /* 5^-40 */
+    { cjson_u64(0x6D6D88DB, 0xD8A5ECD2), cjson_u64(0x1BE03D0B, 0xF225C6F4) }, /* 5^-41 */
+    { cjson_u64(0x8ABE0716, 0x46EB23DB), cjson_u64(0x164CFDA3, 0x281E38C3) }, /* 5^-42 */
+    { cjson_u64(0x6EFE6C11, 0xD255B649), cjson_u64(0x11D7314F, 0x534B609C) }, /* 5^-43 */
+    { cjson_u64(0xB197134F, 0xB6EF8A0E), cjson_u64(0x1C8B8218, 0x85456760) }, /* 5^-44 */
+    { cjson_u64(0x27AC0F72, 0xF8BFA1A5), cjson_u64(0x16D601AD, 0x376AB91A) }, /* 5^-45 */
+    { cjson_u64(0xB95672C2, 0x60994E1E), cjson_u64(0x1244CE24, 0x2C5560E1) }, /* 5^-46 */
+    { cjson_u64(0xF5571E03, 0xCDC21695), cjson_u64(0x1D3AE36D, 0x13BBCE35) }, /* 5^-47 */
+    { cjson_u64(0x2AAC1803, 0x0B01ABAB), cjson_u64(0x17624F8A, 0x762FD82B) }, /* 5^-48 */
+    { cjson_u64(0xBBBCE002, 0x6F348956), cjson_u64(0x12B50C6E, 0xC4F31355) }, /* 5^-49 */
+    { cjson_u64(0x92C7CCD0, 0xB1EDA889), cjson_u64(0x1DEE7A4A, 0xD4B81EEF) }, /* 5^-50 */
+    { cjson_u64(0xDBD30A40, 0x8E57BA07), cjson_u64(0x17F1FB6F, 0x10934BF2) }, /* 5^-51 */
+    { cjson_u64(0x7CA8D500, 0x71DFC806), cjson_u64(0x1327FC58, 0xDA0F6FF5) }, /* 5^-52 */
+    { cjson_u64(0xFAA7BB33, 0xE9660CD6), cjson_u64(0x1EA6608E, 0x29B24CBB) }, /* 5^-53 */
+    { cjson_u64(0x9552FC29, 0x8784D711), cjson_u64(0x18851A0B, 0x548EA3C9) }, /* 5^-54 */
+    { cjson_u64(0xAAA8C9BA, 0xD2D0AC0E), cjson_u64(0x139DAE6F, 0x76D88307) }, /* 5^-55 */
+    { cjson_u64(0xDDDADC5E, 0x1E1AACE3), cjson_u64(0x1F62B0B2, 0x57C0D1A5) }, /* 5^-56 */
+    { cjson_u64(0x7E48B04B, 0x4B488A4F), cjson_u64(0x191BC08E, 0xAC9A4151) }, /* 5^-57 */
+    { cjson_u64(0xCB6D59D5, 0xD5D3A1D9), cjson_u64(0x141633A5, 0x56E1CDDA) }, /* 5^-58 */
+    { cjson_u64(0x3C577B11, 0x77DC817B), cjson_u64(0x1011C2EA, 0xABE7D7E2) }, /* 5^-59 */
+    { cjson_u64(0xC6F25E82, 0x5960CF2A), cjson_u64(0x19B604AA, 0xACA62636) }, /* 5^-60 */
+    { cjson_u64(0x6BF51868, 0x4780A5BB), cjson_u64(0x14919D55, 0x56EB51C5) }, /* 5^-61 */
+    { cjson_u64(0x232A79ED, 0x06008496), cjson_u64(0x10747DDD, 0xDF22A7D1) }, /* 5^-62 */
+    { cjson_u64(0xD1DD8FE1, 0xA3340756), cjson_u64(0x1A53FC96, 0x31D10C81) }, /* 5^-63 */
+    { cjson_u64(0xA7E4731A, 0xE8F66C45), cjson_u64(0x150FFD44, 0xF4A73D34) }, /* 5^-64 */
+    { cjson_u64(0x531D28E2, 0x53F8569E), cjson_u64(0x10D9976A, 0x5D52975D) }, /* 5^-65 */
+    { cjson_u64(0xEB61DB03, 0xB98D5762), cjson_u64(0x1AF5BF10, 0x9550F22E) }, /* 5^-66 */
+    { cjson_u64(0xBC4E48CF, 0xC7A445E8), cjson_u64(0x159165A6, 0xDDDA5B58) }, /* 5^-67 */
+    { cjson_u64(0x6371D3D9, 0x6C836B20), cjson_u64(0x11411E1F, 0x17E1E2AD) }, /* 5^-68 */
+    { cjson_u64(0x9F1C8628, 0xAD9F11CD), cjson_u64(0x1B9B6364, 0xF3030448) }, /* 5^-69 */
+    { cjson_u64(0xE5B06B53, 0xBE18DB0B), cjson_u64(0x1615E91D, 0x8F359D06) }, /* 5^-70 */
+    { cjson_u64(0xEAF3890F, 0xCB4715A2), cjson_u64(0x11AB20E4, 0x72914A6B) }, /* 5^-71 */
+    { cjson_u64(0x44B8DB4C, 0x7871BC37), cjson_u64(0x1C45016D, 0x841BAA46) }, /* 5^-72 */
+    { cjson_u64(0x03C715D6, 0xC6C1635F), cjson_u64(0x169D9ABE, 0x03495505) }, /* 5^-73 */
+    { cjson_u64(0x3638DE45, 0x6BCDE919), cjson_u64(0x1217AEFE, 0x69077737) }, /* 5^-74 */
+    { cjson_u64(0x56C163A2, 0x461641C1), cjson_u64(0x1CF2B197, 0x0E725858) }, /* 5^-75 */
+    { cjson_u64(0xDF011C81, 0xD1AB67CE), cjson_u64(0x17288E12, 0x71F51379) }, /* 5^-76 */
+    { cjson_u64(0x7F3416CE, 0x4155ECA5), cjson_u64(0x1286D80E, 0xC190DC61) }, /* 5^-77 */
+    { cjson_u64(0x6520247D, 0x3556476E), cjson_u64(0x1DA48CE4, 0x68E7C702) }, /* 5^-78 */
+    { cjson_u64(0xEA801D30, 0xF7783925), cjson_u64(0x17B6D71D, 0x20B96C01) }, /* 5^-79 */
+    { cjson_u64(0xBB99B0F3, 0xF92CFA84), cjson_u64(0x12F8AC17, 0x4D612334) }, /* 5^-80 */
+    { cjson_u64(0x5F5C4E53, 0x2847F739), cjson_u64(0x1E5AACF2, 0x15683854) }, /* 5^-81 */
+    { cjson_u64(0x7F7D0B75, 0xB9D32C2E), cjson_u64(0x18488A5B, 0x44536043) }, /* 5^-82 */
+    { cjson_u64(0x9930D5F7, 0xC7DC2358), cjson_u64(0x136D3B7C, 0x36A919CF) }, /* 5^-83 */
+    { cjson_u64(0x8EB4898C, 0x72F9D226), cjson_u64(0x1F152BF9, 0xF10E8FB2) }, /* 5^-84 */
+    { cjson_u64(0x722A07A3, 0x8F2E41B8), cjson_u64(0x18DDBCC7, 0xF40BA628) }, /* 5^-85 */
+    { cjson_u64(0xC1BB394F, 0xA5BE9AFA), cjson_u64(0x13E49706, 0x5CD61E86) }, /* 5^-86 */
+    { cjson_u64(0x9C5EC219, 0x0930F7F6), cjson_u64(0x1FD424D6, 0xFAF030D7) }, /* 5^-87 */
+    { cjson_u64(0x49E56814, 0x075A5FF8), cjson_u64(0x197683DF, 0x2F268D79) }, /* 5^-88 */
+    { cjson_u64(0x6E512010, 0x05E1E660), cjson_u64(0x145ECFE5, 0xBF520AC7) }, /* 5^-89 */
+    { cjson_u64(0xF1DA800C, 0xD181851A), cjson_u64(0x104BD984, 0x990E6F05) }, /* 5^-90 */
+    { cjson_u64(0x4FC40014, 0x8268D4F5), cjson_u64(0x1A12F5A0, 0xF4E3E4D6) }, /* 5^-91 */
+    { cjson_u64(0xD96999AA, 0x01ED772B), cjson_u64(0x14DBF7B3, 0xF71CB711) }, /* 5^-92 */
+    { cjson_u64(0xADEE1488, 0x018AC5BC), cjson_u64(0x10AFF95C, 0xC5B09274) }, /* 5^-93 */
+    { cjson_u64(0x497CEDA6, 0x68DE092C), cjson_u64(0x1AB32894, 0x6F80EA54) }, /* 5^-94 */
+    { cjson_u64(0x3ACA57B8, 0x53E4D424), cjson_u64(0x155C2076, 0xBF9A5510) }, /* 5^-95 */
+    { cjson_u64(0x623B7960, 0x431D7683), cjson_u64(0x1116805E, 0xFFAEAA73) }, /* 5^-96 */
+    { cjson_u64(0x9D2BF566, 0xD1C8BD9E), cjson_u64(0x1B5733CB, 0x32B110B8) }, /* 5^-97 */
+    { cjson_u64(0x7DBCC452, 0x416D647F), cjson_u64(0x15DF5CA2, 0x8EF40D60) }, /* 5^-98 */
+    { cjson_u64(0xCAFD69DB, 0x678AB6CC), cjson_u64(0x117F7D4E, 0xD8C33DE6) }, /* 5^-99 */
+    { cjson_u64(0xAB2F0FC5, 0x72778ADF), cjson_u64(0x1BFF2EE4, 0x8E052FD7) }, /* 5^-100 */
+    { cjson_u64(0x88F27304, 0x5B92D580), cjson_u64(0x1665BF1D, 0x3E6A8CAC) }, /* 5^-101 */
+    { cjson_u64(0xD3F528D0, 0x49424466), cjson_u64(0x11EAFF4A, 0x98553D56) }, /* 5^-102 */
+    { cjson_u64(0xB988414D, 0x4203A0A3), cjson_u64(0x1CAB3210, 0xF3BB9557) }, /* 5^-103 */
+    { cjson_u64(0x6139CDD7, 0x6802E6E9), cjson_u64(0x16EF5B40, 0xC2FC7779) }, /* 5^-104 */
+    { cjson_u64(0xE7617179, 0x20025254), cjson_u64(0x125915CD, 0x68C9F92D) }, /* 5^-105 */
+    { cjson_u64(0xA568B58E, 0x999D5086), cjson_u64(0x1D5B5615, 0x74765B7C) }, /* 5^-106 */
+    { cjson_u64(0x5120913E, 0xE14AA6D2), cjson_u64(0x177C44DD, 0xF6C515FD) }, /* 5^-107 */
+    { cjson_u64(0xA74D40FF, 0x1AA21F0E), cjson_u64(0x12C9D0B1, 0x923744CA) }, /* 5^-108 */
+    { cjson_u64(0x0BAECE64, 0xF769CB4A), cjson_u64(0x1E0FB44F, 0x50586E11) }, /* 5^-109 */
+    { cjson_u64(0x3C8BD850, 0xC5EE3C3B), cjson_u64(0x180C903F, 0x7379F1A7) }, /* 5^-110 */
+    { cjson_u64(0xCA0979DA, 0x37F1C9C9), cjson_u64(0x133D4032, 0xC2C7F485) }, /* 5^-111 */
+    { cjson_u64(0xA9A8C2F6, 0xBFE942DB), cjson_u64(0x1EC866B7, 0x9E0CBA6F) }, /* 5^-112 */
+    { cjson_u64(0x2153CF2B, 0xCCBA9BE3), cjson_u64(0x18A0522C, 0x7E709526) }, /* 5^-113 */
+    { cjson_u64(0x1AA97289, 0x70954982), cjson_u64(0x13B374F0, 0x6526DDB8) }, /* 5^-114 */
+    { cjson_u64(0xF775840F, 0x1A88759D), cjson_u64(0x1F8587E7, 0x083E2F8C) }, /* 5^-115 */
+    { cjson_u64(0x5F913672, 0x7BA05E17), cjson_u64(0x19379FEC, 0x0698260A) }, /* 5^-116 */
+    { cjson_u64(0x1940F85B, 0x9619E4DF), cjson_u64(0x142C7FF0, 0x054684D5) }, /* 5^-117 */
+    { cjson_u64(0xE100C6AF, 0xAB47EA4C), cjson_u64(0x1023998C, 0xD1053710) }, /* 5^-118 */
+    { cjson_u64(0xCE67A44C, 0x453FDD47), cjson_u64(0x19D28F47, 0xB4D524E7) }, /* 5^-119 */
+    { cjson_u64(0xD852E9D6, 0x9DCCB106), cjson_u64(0x14A8729F, 0xC3DDB71F) }, /* 5^-120 */
+    { cjson_u64(0x79DBEE45, 0x4B0A2738), cjson_u64(0x1086C219, 0x697E2C19) }, /* 5^-121 */
+    { cjson_u64(0x295FE3A2, 0x11A9D859), cjson_u64(0x1A71368F, 0x0F30468F) }, /* 5^-122 */
+    { cjson_u64(0xBAB31C81, 0xA7BB137A), cjson_u64(0x15275ED8, 0xD8F36BA5) }, /* 5^-123 */
+    { cjson_u64(0x6228E39A, 0xEC95A92F), cjson_u64(0x10EC4BE0, 0xAD8F8951) }, /* 5^-124 */
+    { cjson_u64(0x9D0E38F7, 0xE0EF7517), cjson_u64(0x1B13AC9A, 0xAF4C0EE8) }, /* 5^-125 */
+    { cjson_u64(0xB0D82D93, 0x1A592A79), cjson_u64(0x15A956E2, 0x25D67253) }, /* 5^-126 */
+    { cjson_u64(0x8D79BE0F, 0x4847552E), cjson_u64(0x11544581, 0xB7DEC1DC) }, /* 5^-127 */
+    { cjson_u64(0x158F967E, 0xDA0BBB7C), cjson_u64(0x1BBA08CF, 0x8C979C94) }, /* 5^-128 */
+    { cjson_u64(0x77A611FF, 0x14D62F97), cjson_u64(0x162E6D72, 0xD6DFB076) }, /* 5^-129 */
+    { cjson_u64(0xF951A7FF, 0x43DE8C79), cjson_u64(0x11BEBDF5, 0x78B2F391) }, /* 5^-130 */
+    { cjson_u64(0xC21C3FFE, 0xD2FDAD8E), cjson_u64(0x1C646322, 0x5AB7EC1C) }, /* 5^-131 */
+    { cjson_u64(0x01B03332, 0x42648AD8), cjson_u64(0x16B6B5B5, 0x155FF017) }, /* 5^-132 */
+    { cjson_u64(0x0159C28E, 0x9B83A246), cjson_u64(0x122BC490, 0xDDE659AC) }, /* 5^-133 */
+    { cjson_u64(0xCEF60417, 0x5F3903A3), cjson_u64(0x1D12D41A, 0xFCA3C2AC) }, /* 5^-134 */
+    { cjson_u64(0x725E69AC, 0x4C2D9C83), cjson_u64(0x17424348, 0xCA1C9BBD) }, /* 5^-135 */
+    { cjson_u64(0xF5185489, 0xD68AE39C), cjson_u64(0x129B6907, 0x0816E2FD) }, /* 5^-136 */
+    { cjson_u64(0xEE8D540F, 0xBDAB05C6), cjson_u64(0x1DC574D8, 0x0CF16B2F) }, /* 5^-137 */
+    { cjson_u64(0xBED77672, 0xFE226B05), cjson_u64(0x17D12A46, 0x70C1228C) }, /* 5^-138 */
+    { cjson_u64(0xFF12C528, 0xCB4EBC04), cjson_u64(0x130DBB6B, 0x8D674ED6) }, /* 5^-139 */
+    { cjson_u64(0xCB513B74, 0x787DF9A0), cjson_u64(0x1E7C5F12, 0x7BD87E24) }, /* 5^-140 */
+    { cjson_u64(0x090DC929, 0xF9FE614D), cjson_u64(0x18637F41, 0xFCAD31B7) }, /* 5^-141 */
+    { cjson_u64(0xA0D7D421, 0x94CB810A), cjson_u64(0x1382CC34, 0xCA2427C5) }, /* 5^-142 */
+    { cjson_u64(0x67BFB9CF, 0x5478CE77), cjson_u64(0x1F37AD21, 0x436D0C6F) }, /* 5^-143 */
+    { cjson_u64(0x1FCC94A5, 0xDD2D71F9), cjson_u64(0x18F9574D, 0xCF8A7059) }, /* 5^-144 */
+    { cjson_u64(0x7FD6DD51, 0x7DBDF4C7), cjson_u64(0x13FAAC3E, 0x3FA1F37A) }, /* 5^-145 */
+    { cjson_u64(0xFFBE2EE8, 0xC92FEE0B), cjson_u64(0x1FF779FD, 0x329CB8C3) }, /* 5^-146 */
+    { cjson_u64(0x6631BF20, 0xA0F324D6), cjson_u64(0x1992C7FD, 0xC216FA36) }, /* 5^-147 */
+    { cjson_u64(0xB827CC1A, 0x1A5C1D78), cjson_u64(0x14756CCB, 0x01ABFB5E) }, /* 5^-148 */
+    { cjson_u64(0x935309AE, 0x7B7CE460), cjson_u64(0x105DF0A2, 0x67BCC918) }, /* 5^-149 */
+    { cjson_u64(0x1EEB42B0, 0xC594A099), cjson_u64(0x1A2FE76A, 0x3F9474F4) }, /* 5^-150 */
+    { cjson_u64(0xE5890227, 0x0476E6E1), cjson_u64(0x14F31F88, 0x32DD2A5C) }, /* 5^-151 */
+    { cjson_u64(0xB7A0CE85, 0x9D2BEBE7), cjson_u64(0x10C27FA0, 0x28B0EEB0) }, /* 5^-152 */
+    { cjson_u64(0x59014A6F, 0x61DFDFD8), cjson_u64(0x1AD0CC33, 0x744E4AB4) }, /* 5^-153 */
+    { cjson_u64(0xE0CDD525, 0xE7E64CAD), cjson_u64(0x1573D68F, 0x903EA229) }, /* 5^-154 */
+    { cjson_u64(0x4D717751, 0x8651D6F1), cjson_u64(0x11297872, 0xD9CBB4EE) }, /* 5^-155 */
+    { cjson_u64(0x7BE8BEE8, 0xD6E957E8), cjson_u64(0x1B758D84, 0x8FAC54B0) }, /* 5^-156 */
+    { cjson_u64(0xFCBA3253, 0xDF211320), cjson_u64(0x15F7A46A, 0x0C89DD59) }, /* 5^-157 */
+    { cjson_u64(0x63C82843, 0x18E74280), cjson_u64(0x1192E9EE, 0x706E4AAE) }, /* 5^-158 */
+    { cjson_u64(0x060D0D38, 0x27D86A66), cjson_u64(0x1C1E4317, 0x1A4A1117) }, /* 5^-159 */
+    { cjson_u64(0x6B3DA42C, 0xECAD21EB), cjson_u64(0x167E9C12, 0x7B6E7412) }, /* 5^-160 */
+    { cjson_u64(0x88FE1CF0, 0xBD574E56), cjson_u64(0x11FEE341, 0xFC585CDB) }, /* 5^-161 */
+    { cjson_u64(0x419694B4, 0x62254A23), cjson_u64(0x1CCB0536, 0x608D615F) }, /* 5^-162 */
+    { cjson_u64(0x67ABAA29, 0xE81DD4E9), cjson_u64(0x1708D0F8, 0x4D3DE77F) }, /* 5^-163 */
+    { cjson_u64(0xB95621BB, 0x2017DD87), cjson_u64(0x126D73F9, 0xD764B932) }, /* 5^-164 */
+    { cjson_u64(0xC223692B, 0x668C95A5), cjson_u64(0x1D7BECC2, 0xF23AC1EA) }, /* 5^-165 */
+    { cjson_u64(0xCE82BA89, 0x1ED6DE1D), cjson_u64(0x17965702, 0x5B6234BB) }, /* 5^-166 */
+    { cjson_u64(0xA5356207, 0x4BDF1818), cjson_u64(0x12DEAC01, 0xE2B4F6FC) }, /* 5^-167 */
+    { cjson_u64(0x3B889CD8, 0x7964F359), cjson_u64(0x1E311336, 0x3787F194) }, /* 5^-168 */
+    { cjson_u64(0xFC6D4A46, 0xC783F5E1), cjson_u64(0x18274291, 0xC6065ADC) }, /* 5^-169 */
+    { cjson_u64(0x30576E9F, 0x06032B1A), cjson_u64(0x13529BA7, 0xD19EAF17) }, /* 5^-170 */
+    { cjson_u64(0x1A257DCB, 0x3CD1DE90), cjson_u64(0x1EEA92A6, 0x1C311825) }, /* 5^-171 */
+    { cjson_u64(0x481DFE3C, 0x30A7E540), cjson_u64(0x18BBA884, 0xE35A79B7) }, /* 5^-172 */
+    { cjson_u64(0xD34B31C9, 0xC0865100), cjson_u64(0x13C9539D, 0x82AEC7C5) }, /* 5^-173 */
+    { cjson_u64(0x5211E942, 0xCDA3B4CD), cjson_u64(0x1FA885C8, 0xD117A609) }, /* 5^-174 */
+    { cjson_u64(0x74DB2102, 0x3E1C90A4), cjson_u64(0x19539E3A, 0x40DFB807) }, /* 5^-175 */
+    { cjson_u64(0xF715B401, 0xCB4A0D50), cjson_u64(0x1442E4FB, 0x67196005) }, /* 5^-176 */
+    { cjson_u64(0xF8DE299B, 0x09080AA7), cjson_u64(0x103583FC, 0x527AB337) }, /* 5^-177 */
+    { cjson_u64(0x8E304291, 0xA80CDDD7), cjson_u64(0x19EF3993, 0xB72AB859) }, /* 5^-178 */
+    { cjson_u64(0x3E8D020E, 0x200A4B13), cjson_u64(0x14BF6142, 0xF8EEF9E1) }, /* 5^-179 */
+    { cjson_u64(0x653D9B3E, 0x80083C0F), cjson_u64(0x10991A9B, 0xFA58C7E7) }, /* 5^-180 */
+    { cjson_u64(0x6EC8F864, 0x000D2CE4), cjson_u64(0x1A8E90F9, 0x908E0CA5) }, /* 5^-181 */
+    { cjson_u64(0x8BD3F9E9, 0x99A423EA), cjson_u64(0x153EDA61, 0x4071A3B7) }, /* 5^-182 */
+    { cjson_u64(0x3CA994BA, 0xE1501CBB), cjson_u64(0x10FF151A, 0x99F482F9) }, /* 5^-183 */
+    { cjson_u64(0xC775BAC4, 0x9BB3612B), cjson_u64(0x1B31BB5D, 0xC320D18E) }, /* 5^-184 */
+    { cjson_u64(0xD2C4956A, 0x16291A89), cjson_u64(0x15C162B1, 0x68E70E0B) }, /* 5^-185 */
+    { cjson_u64(0xDBD07788, 0x11BA7BA1), cjson_u64(0x11678227, 0x871F3E6F) }, /* 5^-186 */
+    { cjson_u64(0x2C80BF40, 0x1C5D929B), cjson_u64(0x1BD8D03F, 0x3E9863E6) }, /* 5^-187 */
+    { cjson_u64(0xBD33CC33, 0x49E47549), cjson_u64(0x16470CFF, 0x6546B651) }, /* 5^-188 */
+    { cjson_u64(0xCA8FD68F, 0x6E505DD4), cjson_u64(0x11D270CC, 0x51055EA7) }, /* 5^-189 */
+    { cjson_u64(0x4419574B, 0xE3B3C953), cjson_u64(0x1C83E7AD, 0x4E6EFDD9) }, /* 5^-190 */
+    { cjson_u64(0x03477909, 0x82F63AA9), cjson_u64(0x16CFEC8A, 0xA52597E1) }, /* 5^-191 */
+    { cjson_u64(0xCF6C60D4, 0x68C4FBBA), cjson_u64(0x123FF06E, 0xEA847980) }, /* 5^-192 */
+    { cjson_u64(0xE57A3487, 0x0E07F92A), cjson_u64(0x1D331A4B, 0x10D3F59A) }, /* 5^-193 */
+    { cjson_u64(0x512E906C, 0x0B399422), cjson_u64(0x175C1508, 0xDA432AE2) }, /* 5^-194 */
+    { cjson_u64(0xDA8BA6BC, 0xD5C7A9B5), cjson_u64(0x12B010D3, 0xE1CF5581) }, /* 5^-195 */
+    { cjson_u64(0x90DF712E, 0x22D90F87), cjson_u64(0x1DE68153, 0x02E5559C) }, /* 5^-196 */
+    { cjson_u64(0xDA4C5A8B, 0x4F140C6C), cjson_u64(0x17EB9AA8, 0xCF1DDE16) }, /* 5^-197 */
+    { cjson_u64(0xAEA37BA2, 0xA5A9A38A), cjson_u64(0x1322E220, 0xA5B17E78) }, /* 5^-198 */
+    { cjson_u64(0x7DD25F6A, 0xA2A905A9), cjson_u64(0x1E9E369A, 0xA2B59727) }, /* 5^-199 */
+    { cjson_u64(0x97DB7F88, 0x8220D154), cjson_u64(0x187E9215, 0x4EF7AC1F) }, /* 5^-200 */
+    { cjson_u64(0x797C6606, 0xCE80A777), cjson_u64(0x139874DD, 0xD8C6234C) }, /* 5^-201 */
+    { cjson_u64(0x8F2D700A, 0xE4010BF1), cjson_u64(0x1F5A5496, 0x27A36BAD) }, /* 5^-202 */
+    { cjson_u64(0x0C2459A2, 0x5000D65A), cjson_u64(0x19151078, 0x1FB5EFBE) }, /* 5^-203 */
+    { cjson_u64(0x701D1481, 0xD99A4515), cjson_u64(0x1410D9F9, 0xB2F7F2FE) }, /* 5^-204 */
+    { cjson_u64(0xC017439B, 0x147B6A77), cjson_u64(0x100D7B2E, 0x28C65BFE) }, /* 5^-205 */
+    { cjson_u64(0xCCF205C4, 0xED9243F2), cjson_u64(0x19AF2B7D, 0x0E0A2CCA) }, /* 5^-206 */
+    { cjson_u64(0x0A5B37D0, 0xBE0E9CC2), cjson_u64(0x148C22CA, 0x71A1BD6F) }, /* 5^-207 */
+    { cjson_u64(0x0848F973, 0xCB3EE3CE), cjson_u64(0x10701BD5, 0x27B4978C) }, /* 5^-208 */
+    { cjson_u64(0xDA0E5BEC, 0x78649FB0), cjson_u64(0x1A4CF955, 0x0C5425AC) }, /* 5^-209 */
+    { cjson_u64(0x7B3EAFF0, 0x60507FC0), cjson_u64(0x150A6110, 0xD6A9B7BD) }, /* 5^-210 */
+    { cjson_u64(0x95CBBFF3, 0x80406633), cjson_u64(0x10D51A73, 0xDEEE2C97) }, /* 5^-211 */
+    { cjson_u64(0xEFAC6652, 0x66CD7052), cjson_u64(0x1AEE90B9, 0x64B04758) }, /* 5^-212 */
+    { cjson_u64(0x2623850E, 0xB8A459DB), cjson_u64(0x158BA6FA, 0xB6F36C47) }, /* 5^-213 */
+    { cjson_u64(0x1E82D0D8, 0x93B6AE49), cjson_u64(0x113C8595, 0x5F29236C) }, /* 5^-214 */
+    { cjson_u64(0xFD9E1AF4, 0x1F8AB075), cjson_u64(0x1B9408EE, 0xFEA838AC) }, /* 5^-215 */
+    { cjson_u64(0x97B1AF29, 0xB2D559F7), cjson_u64(0x16100725, 0x988693BD) }, /* 5^-216 */
+    { cjson_u64(0xAC8E25BA, 0xF5777B2C), cjson_u64(0x11A66C1E, 0x139EDC97) }, /* 5^-217 */
+    { cjson_u64(0x7A7D092B, 0x2258C513), cjson_u64(0x1C3D79C9, 0xB8FE2DBF) }, /* 5^-218 */
+    { cjson_u64(0x61FDA0EF, 0x4EAD6A76), cjson_u64(0x169794A1, 0x60CB57CC) }, /* 5^-219 */
+    { cjson_u64(0xE7FE1A59, 0x0BBDEEC5), cjson_u64(0x1212DD4D, 0xE7091309) }, /* 5^-220 */
+    { cjson_u64(0xA6635D5B, 0x45FCB13A), cjson_u64(0x1CEAFBAF, 0xD80E84DC) }, /* 5^-221 */
+    { cjson_u64(0x851C4AAF, 0x6B308DC8), cjson_u64(0x172262F3, 0x133ED0B0) }, /* 5^-222 */
+    { cjson_u64(0xD0E36EF2, 0xBC26D7D4), cjson_u64(0x1281E8C2, 0x75CBDA26) }, /* 5^-223 */
+    { cjson_u64(0xB49F17EA, 0xC6A48C86), cjson_u64(0x1D9CA79D, 0x894629D7) }, /* 5^-224 */
+    { cjson_u64(0x2A18DFEF, 0x0550706B), cjson_u64(0x17B08617, 0xA104EE46) }, /* 5^-225 */
+    { cjson_u64(0x54E0B325, 0x9DD9F389), cjson_u64(0x12F39E79, 0x4D9D8B6B) }, /* 5^-226 */
+    { cjson_u64(0x87CDEB6F, 0x62F65274), cjson_u64(0x1E529728, 0x7C2F4578) }, /* 5^-227 */
+    { cjson_u64(0xD30B22BF, 0x825EA85D), cjson_u64(0x18421286, 0xC9BF6AC6) }, /* 5^-228 */
+    { cjson_u64(0x0F3C1BCC, 0x684BB9E4), cjson_u64(0x13680ED2, 0x3AFF889F) }, /* 5^-229 */
+    { cjson_u64(0x18602C7A, 0x4079296D), cjson_u64(0x1F0CE483, 0x9198DA98) }, /* 5^-230 */
+    { cjson_u64(0x46B356C8, 0x33942124), cjson_u64(0x18D71D36, 0x0E13E213) }, /* 5^-231 */
+    { cjson_u64(0x388F78A0, 0x29434DB6), cjson_u64(0x13DF4A91, 0xA4DCB4DC) }, /* 5^-232 */
+    { cjson_u64(0x5A7F2766, 0xA86BAF8A), cjson_u64(0x1FCBAA82, 0xA1612160) }, /* 5^-233 */
+    { cjson_u64(0x153285EB, 0xB9EFBFA2), cjson_u64(0x196FBB9B, 0xB44DB44D) }, /* 5^-234 */
+    { cjson_u64(0xAA8ED189, 0x618C994E), cjson_u64(0x145962E2, 0xF6A4903D) }, /* 5^-235 */
+    { cjson_u64(0xEED8A7A1, 0x1AD6E10C), cjson_u64(0x1047824F, 0x2BB6D9CA) }, /* 5^-236 */
+    { cjson_u64(0x7E27729B, 0x5E249B45), cjson_u64(0x1A0C03B1, 0xDF8AF611) }, /* 5^-237 */
+    { cjson_u64(0xFE85F549, 0x181D4904), cjson_u64(0x14D6695B, 0x193BF80D) }, /* 5^-238 */
+    { cjson_u64(0xCB9E5DD4, 0x134AA0D0), cjson_u64(0x10AB877C, 0x142FF9A4) }, /* 5^-239 */
+    { cjson_u64(0xDF63C953, 0x5211014D), cjson_u64(0x1AAC0BF9, 0xB9E65C3A) }, /* 5^-240 */
+    { cjson_u64(0x191CA10F, 0x74DA6771), cjson_u64(0x15566FFA, 0xFB1EB02F) }, /* 5^-241 */
+    { cjson_u64(0xADB080D9, 0x2A4852C1), cjson_u64(0x1111F32F, 0x2F4BC025) }, /* 5^-242 */
+    { cjson_u64(0x15E7348E, 0xAA0D5134), cjson_u64(0x1B4FEB7E, 0xB212CD09) }, /* 5^-243 */
+    { cjson_u64(0xAB1F5D3E, 0xEE710DC4), cjson_u64(0x15D98932, 0x280F0A6D) }, /* 5^-244 */
+    { cjson_u64(0xBC191765, 0x8B8DA49D), cjson_u64(0x117AD428, 0x200C0857) }, /* 5^-245 */
+    { cjson_u64(0x2CF4F23C, 0x127C3A94), cjson_u64(0x1BF7B9D9, 0xCCE00D59) }, /* 5^-246 */
+    { cjson_u64(0xF0C3F4FC, 0xDB969543), cjson_u64(0x165FC7E1, 0x70B33DE0) }, /* 5^-247 */
+    { cjson_u64(0x5A365D97, 0x16121103), cjson_u64(0x11E63981, 0x26F5CB1A) }, /* 5^-248 */
+    { cjson_u64(0x9056FC24, 0xF01CE804), cjson_u64(0x1CA38F35, 0x0B22DE90) }, /* 5^-249 */
+    { cjson_u64(0xD9DF301D, 0x8CE3ECD0), cjson_u64(0x16E93F5D, 0xA2824BA6) }, /* 5^-250 */
+    { cjson_u64(0xE17F59B1, 0x3D8323DA), cjson_u64(0x125432B1, 0x4ECEA2EB) }, /* 5^-251 */
+    { cjson_u64(0x68CBC2B5, 0x2F38395C), cjson_u64(0x1D53844E, 0xE47DD179) }, /* 5^-252 */
+    { cjson_u64(0x53D6355D, 0xBF602DE3), cjson_u64(0x17760372, 0x5064A794) }, /* 5^-253 */
+    { cjson_u64(0xA9782AB1, 0x65E68B1C), cjson_u64(0x12C4CF8E, 0xA6B6EC76) }, /* 5^-254 */
+    { cjson_u64(0x0F26AAB5, 0x6FD744FA), cjson_u64(0x1E07B27D, 0xD78B13F1) }, /* 5^-255 */
+    { cjson_u64(0x3F52222A, 0xBFDF6A62), cjson_u64(0x18062864, 0xAC6F4327) }, /* 5^-256 */
+    { cjson_u64(0x65DB4E88, 0x997F884E), cjson_u64(0x13382050, 0x89F29C1F) }, /* 5^-257 */
+    { cjson_u64(0x6FC54A74, 0x28CC0D4A), cjson_u64(0x1EC033B4, 0x0FEA9365) }, /* 5^-258 */
+    { cjson_u64(0x596AA1F6, 0x8709A43B), cjson_u64(0x1899C2F6, 0x73220F84) }, /* 5^-259 */
+    { cjson_u64(0xADEEE7F8, 0x6C07B696), cjson_u64(0x13AE3591, 0xF5B4D936) }, /* 5^-260 */
+    { cjson_u64(0x497E3FF3, 0xE00C5756), cjson_u64(0x1F7D2283, 0x22BAF524) }, /* 5^-261 */
+    { cjson_u64(0xD464FFF6, 0x4CD6AC45), cjson_u64(0x1930E868, 0xE89590E9) }, /* 5^-262 */
+    { cjson_u64(0x4383FFF8, 0x3D7889D1), cjson_u64(0x14272053, 0xED4473EE) }, /* 5^-263 */
+    { cjson_u64(0xCF9CCCC6, 0x9793A174), cjson_u64(0x101F4D0F, 0xF1038FF1) }, /* 5^-264 */
+    { cjson_u64(0x7F6147A4, 0x25B90252), cjson_u64(0x19CBAE7F, 0xE805B31C) }, /* 5^-265 */
+    { cjson_u64(0xCC4DD2E9, 0xB7C7350F), cjson_u64(0x14A2F1FF, 0xECD15C16) }, /* 5^-266 */
+    { cjson_u64(0x3D0B0F21, 0x5FD290D9), cjson_u64(0x10825B33, 0x23DAB012) }, /* 5^-267 */
+    { cjson_u64(0x61AB4B68, 0x9950E7C1), cjson_u64(0x1A6A2B85, 0x062AB350) }, /* 5^-268 */
+    { cjson_u64(0x4E22A2BA, 0x1440B967), cjson_u64(0x1521BC6A, 0x6B555C40) }, /* 5^-269 */
+    { cjson_u64(0x0B4EE894, 0xDD009453), cjson_u64(0x10E7C9EE, 0xBC4449CD) }, /* 5^-270 */
+    { cjson_u64(0x1217DA87, 0xC800ED51), cjson_u64(0x1B0C764A, 0xC6D3A948) }, /* 5^-271 */
+    { cjson_u64(0xDB46486C, 0xA000BDDA), cjson_u64(0x15A391D5, 0x6BDC876C) }, /* 5^-272 */
+    { cjson_u64(0x490506BD, 0x4CCD64AF), cjson_u64(0x114FA7DD, 0xEFE39F8A) }, /* 5^-273 */
+    { cjson_u64(0xA8080AC8, 0x7AE23AB1), cjson_u64(0x1BB2A62F, 0xE638FF43) }, /* 5^-274 */
+    { cjson_u64(0x5339A239, 0xFBE82EF4), cjson_u64(0x162884F3, 0x1E93FF69) }, /* 5^-275 */
+    { cjson_u64(0x75C7B4FB, 0x2FECF25D), cjson_u64(0x11BA03F5, 0xB20FFF87) }, /* 5^-276 */
+    { cjson_u64(0x22D92191, 0xE647EA2E), cjson_u64(0x1C5CD322, 0xB67FFF3F) }, /* 5^-277 */
+    { cjson_u64(0xB57A8141, 0x850654F2), cjson_u64(0x16B0A8E8, 0x91FFFF65) }, /* 5^-278 */
+    { cjson_u64(0xC4620101, 0x373843F5), cjson_u64(0x1226ED86, 0xDB3332B7) }, /* 5^-279 */
+    { cjson_u64(0x3A366801, 0xF1F39FEE), cjson_u64(0x1D0B15A4, 0x91EB8459) }, /* 5^-280 */
+    { cjson_u64(0xFB5EB99B, 0x27F6198B), cjson_u64(0x173C1150, 0x74BC69E0) }, /* 5^-281 */
+    { cjson_u64(0x2F7EFAE2, 0x865E7AD6), cjson_u64(0x12967440, 0x5D6387E7) }, /* 5^-282 */
+    { cjson_u64(0xE597F7D0, 0xD6FD9156), cjson_u64(0x1DBD86CD, 0x6238D971) }, /* 5^-283 */
+    { cjson_u64(0x8479930D, 0x78CADAAB), cjson_u64(0x17CAD23D, 0xE82D7AC1) }, /* 5^-284 */
+    { cjson_u64(0xD0614271, 0x2D6F1556), cjson_u64(0x1308A831, 0x868AC89A) }, /* 5^-285 */
+    { cjson_u64(0x4D686A4E, 0xAF182222), cjson_u64(0x1E74404F, 0x3DAADA91) }, /* 5^-286 */
+    { cjson_u64(0xA453883E, 0xF279B4E8), cjson_u64(0x185D003F, 0x6488AEDA) }, /* 5^-287 */
+    { cjson_u64(0xE9DC6CFF, 0x28615D87), cjson_u64(0x137D99CC, 0x506D58AE) }, /* 5^-288 */
+    { cjson_u64(0xA960AE65, 0x0D6895A4), cjson_u64(0x1F2F5C7A, 0x1A488DE4) }, /* 5^-289 */
+    { cjson_u64(0xBAB3BEB7, 0x3DED4483), cjson_u64(0x18F2B061, 0xAEA07183) }, /* 5^-290 */
+    { cjson_u64(0x2EF6322C, 0x318A9D36), cjson_u64(0x13F559E7, 0xBEE6C136) }, /* 5^-291 */
+    { cjson_u64(0xE4BD1D13, 0x827761F0), cjson_u64(0x1FEEF63F, 0x97D79B89) }, /* 5^-292 */
+    { cjson_u64(0x83CA7DA9, 0x352C4E5A), cjson_u64(0x198BF832, 0xDFDFAFA1) }, /* 5^-293 */
+    { cjson_u64(0x9CA1FE20, 0xF756A515), cjson_u64(0x146FF9C2, 0x4CB2F2E7) }, /* 5^-294 */
+    { cjson_u64(0x4A1B31B3, 0xF9121DAA), cjson_u64(0x1059949B, 0x708F28B9) }, /* 5^-295 */
+    { cjson_u64(0x435EB5EC, 0xC1B695DD), cjson_u64(0x1A28EDC5, 0x80E50DF5) }, /* 5^-296 */
+    { cjson_u64(0x35E55E57, 0x015EDE4A), cjson_u64(0x14ED8B04, 0x671DA4C4) }, /* 5^-297 */
+    { cjson_u64(0xC4B77EAC, 0x0118B1D5), cjson_u64(0x10BE08D0, 0x527E1D69) }, /* 5^-298 */
+    { cjson_u64(0xA1259779, 0x9B5AB622), cjson_u64(0x1AC9A7B3, 0xB7302F0F) }, /* 5^-299 */
+    { cjson_u64(0x4DB7AC61, 0x49155E81), cjson_u64(0x156E1FC2, 0xF8F358D9) }, /* 5^-300 */
+    { cjson_u64(0xD7C62381, 0x07444B9B), cjson_u64(0x1124E635, 0x93F5E0AD) }, /* 5^-301 */
+    { cjson_u64(0x593D059B, 0x3ED3AC2B), cjson_u64(0x1B6E3D22, 0x86563449) }, /* 5^-302 */
+    { cjson_u64(0xE0FD9E15, 0xCBDC89BC), cjson_u64(0x15F1CA82, 0x0511C36D) }, /* 5^-303 */
+    { cjson_u64(0xB3FE1811, 0x6FE3A163), cjson_u64(0x118E3B9B, 0x37416924) }, /* 5^-304 */
+    { cjson_u64(0x866359B5, 0x7FD29BD1), cjson_u64(0x1C16C5C5, 0x25357507) }, /* 5^-305 */
+    { cjson_u64(0xD1E91491, 0x330EE30E), cjson_u64(0x16789E37, 0x50F790D2) }, /* 5^-306 */
+    { cjson_u64(0x74BA76DA, 0x8F3F1C0B), cjson_u64(0x11FA182C, 0x40C60D75) }, /* 5^-307 */
+    { cjson_u64(0xEDF72490, 0xE531C678), cjson_u64(0x1CC359E0, 0x67A348BB) }, /* 5^-308 */
+    { cjson_u64(0x8B2C1D40, 0xB75B052D), cjson_u64(0x1702AE4D, 0x1FB5D3C9) }, /* 5^-309 */
+    { cjson_u64(0x6F567DCD, 0x5F7C0424), cjson_u64(0x12688B70, 0xE62B0FD4) }, /* 5^-310 */
+    { cjson_u64(0x7EF0C948, 0x98C66D06), cjson_u64(0x1D74124E, 0x3D11B2ED) }, /* 5^-311 */
+    { cjson_u64(0x98C0A106, 0xE09EBD9F), cjson_u64(0x17900EA4, 0xFDA7C257) }, /* 5^-312 */
+    { cjson_u64(0x470080D2, 0x4D4BCAE6), cjson_u64(0x12D9A550, 0xCAEC9B79) }, /* 5^-313 */
+    { cjson_u64(0xD800CE1D, 0x487944A2), cjson_u64(0x1E290881, 0x44ADC58E) }, /* 5^-314 */
+    { cjson_u64(0x1333D817, 0x6D2DD082), cjson_u64(0x1820D39A, 0x9D57D13F) }, /* 5^-315 */
+    { cjson_u64(0xA8F64679, 0x2424A6CE), cjson_u64(0x134D7615, 0x4AACA765) }, /* 5^-316 */
+    { cjson_u64(0x74BD3D8E, 0xA03AA47D), cjson_u64(0x1EE25688, 0x777AA56F) }, /* 5^-317 */
+    { cjson_u64(0x5D64313E, 0xE6955064), cjson_u64(0x18B51206, 0xC5FBB78C) }, /* 5^-318 */
+    { cjson_u64(0x4AB68DCB, 0xEBAAA6B7), cjson_u64(0x13C40E6B, 0xD1962C70) }, /* 5^-319 */
+    { cjson_u64(0x11241613, 0x12AAA457), cjson_u64(0x1FA01712, 0xE8F0471A) }, /* 5^-320 */
+    { cjson_u64(0xDA8344DC, 0x0EEEE9DF), cjson_u64(0x194CDF42, 0x53F36C14) }, /* 5^-321 */
+    { cjson_u64(0xE2029D7C, 0xD8BF2180), cjson_u64(0x143D7F68, 0x43292343) }, /* 5^-322 */
+    { cjson_u64(0x4E687DFD, 0x7A328133), cjson_u64(0x103132B9, 0xCF541C36) }, /* 5^-323 */
+    { cjson_u64(0x4A40C995, 0x9050CEB8), cjson_u64(0x19E85129, 0x4BB9C6BD) }, /* 5^-324 */
+    { cjson_u64(0x0833D477, 0xA6A70BC6), cjson_u64(0x14B9DA87, 0x6FC7D231) }, /* 5^-325 */
+    { cjson_u64(0xA02976C6, 0x1EEC096B), cjson_u64(0x1094AED2, 0xBFD30E8D) }, /* 5^-326 */
+    { cjson_u64(0x004257A3, 0x64ACDBDF), cjson_u64(0x1A877E1D, 0xFFB81749) }, /* 5^-327 */
+    { cjson_u64(0xCD01DFB5, 0xEA23E319), cjson_u64(0x153931B1, 0x996012A0) }, /* 5^-328 */
+    { cjson_u64(0x70CE4C91, 0x881CB5AE), cjson_u64(0x10FA8E27, 0xADE6754D) }, /* 5^-329 */
+    { cjson_u64(0x1AE3ADB5, 0xA69455E2), cjson_u64(0x1B2A7D0C, 0x4970BBAF) }, /* 5^-330 */
+    { cjson_u64(0x7BE957C4, 0x854377E8), cjson_u64(0x15BB973D, 0x078D62F2) }, /* 5^-331 */
+    { cjson_u64(0xC987796A, 0x0435F987), cjson_u64(0x1162DF64, 0x060AB58E) }, /* 5^-332 */
+    { cjson_u64(0x75A58F10, 0x06BCC271), cjson_u64(0x1BD1656C, 0xD67788E4) }, /* 5^-333 */
+    { cjson_u64(0xF7B7A5A6, 0x6BCA3527), cjson_u64(0x16411DF0, 0xAB92D3E9) }, /* 5^-334 */
+    { cjson_u64(0x5FC61E1E, 0xBCA1C41F), cjson_u64(0x11CDB18D, 0x560F0FEE) }, /* 5^-335 */
+    { cjson_u64(0xFFA36364, 0x6102D365), cjson_u64(0x1C7C4F48, 0x89B1B316) }, /* 5^-336 */
+    { cjson_u64(0x32E91C50, 0x4D9BDC51), cjson_u64(0x16C9D906, 0xD48E28DF) }, /* 5^-337 */
+    { cjson_u64(0x8F20E373, 0x71497D0E), cjson_u64(0x123B1405, 0x76D820B2) }, /* 5^-338 */
+    { cjson_u64(0x7E9B0585, 0x820F2E7C), cjson_u64(0x1D2B533B, 0xF159CDEA) }, /* 5^-339 */
+    { cjson_u64(0xCBAF379E, 0x01A5BECA), cjson_u64(0x1755DC2F, 0xF447D7EE) }, /* 5^-340 */
+    { cjson_u64(0x0958F94B, 0x348498A1), cjson_u64(0x12AB168C, 0xC36CACBF) }  /* 5^-341 */
+};
+
+static const cjson_uint64 pow5_split[][2] =
+{
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x10000000, 0x00000000) }, /* 5^0 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x14000000, 0x00000000) }, /* 5^1 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x19000000, 0x00000000) }, /* 5^2 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1F400000, 0x00000000) }, /* 5^3 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x13880000, 0x00000000) }, /* 5^4 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x186A0000, 0x00000000) }, /* 5^5 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1E848000, 0x00000000) }, /* 5^6 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1312D000, 0x00000000) }, /* 5^7 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x17D78400, 0x00000000) }, /* 5^8 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1DCD6500, 0x00000000) }, /* 5^9 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x12A05F20, 0x00000000) }, /* 5^10 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x174876E8, 0x00000000) }, /* 5^11 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1D1A94A2, 0x00000000) }, /* 5^12 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x12309CE5, 0x40000000) }, /* 5^13 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x16BCC41E, 0x90000000) }, /* 5^14 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1C6BF526, 0x34000000) }, /* 5^15 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x11C37937, 0xE0800000) }, /* 5^16 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x16345785, 0xD8A00000) }, /* 5^17 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1BC16D67, 0x4EC80000) }, /* 5^18 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1158E460, 0x913D0000) }, /* 5^19 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x15AF1D78, 0xB58C4000) }, /* 5^20 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1B1AE4D6, 0xE2EF5000) }, /* 5^21 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x10F0CF06, 0x4DD59200) }, /* 5^22 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x152D02C7, 0xE14AF680) }, /* 5^23 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x1A784379, 0xD99DB420) }, /* 5^24 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x108B2A2C, 0x28029094) }, /* 5^25 */
+    { cjson_u64(0x00000000, 0x00000000), cjson_u64(0x14ADF4B7, 0x320334B9) }, /* 5^26 */
+    { cjson_u64(0x40000000, 0x00000000), cjson_u64(0x19D971E4, 0xFE8401E7) }, /* 5^27 */
+    { cjson_u64(0x88000000, 0x00000000), cjson_u64(0x1027E72F, 0x1F128130) }, /* 5^28 */
+    { cjson_u64(0xAA000000, 0x00000000), cjson_u64(0x1431E0FA, 0xE6D7217C) }, /* 5^29 */
+    { cjson_u64(0xD4800000, 0x00000000), cjson_u64(0x193E5939, 0xA08CE9DB) }, /* 5^30 */
+    { cjson_u64(0xC9A00000, 0x00000000), cjson_u64(0x1F8DEF88, 0x08B02452) }, /* 5^31 */
+    { cjson_u64(0xBE040000, 0x00000000), cjson_u64(0x13B8B5B5, 0x056E16B3) }, /* 5^32 */
+    { cjson_u64(0xAD850000, 0x00000000), cjson_u64(0x18A6E322, 0x46C99C60) }, /* 5^33 */
+    { cjson_u64(0xD8E64000, 0x00000000), cjson_u64(0x1ED09BEA, 0xD87C0378) }, /* 5^34 */
+    { cjson_u64(0x878FE800, 0x00000000), cjson_u64(0x13426172, 0xC74D822B) }, /* 5^35 */
+    { cjson_u64(0x6973E200, 0x00000000), cjson_u64(0x1812F9CF, 0x7920E2B6) }, /* 5^36 */
+    { cjson_u64(0x03D0DA80, 0x00000000), cjson_u64(0x1E17B843, 0x57691B64) }, /* 5^37 */
+    { cjson_u64(0x82628890, 0x00000000), cjson_u64(0x12CED32A, 0x16A1B11E) }, /* 5^38 */
+    { cjson_u64(0x22FB2AB4, 0x00000000), cjson_u64(0x178287F4, 0x9C4A1D66) }, /* 5^39 */
+    { cjson_u64(0xABB9F561, 0x00000000), cjson_u64(0x1D6329F1, 0xC35CA4BF) }, /* 5^40 */
+    { cjson_u64(0xCB54395C, 0xA0000000), cjson_u64(0x125DFA37, 0x1A19E6F7) }, /* 5^41 */
+    { cjson_u64(0xBE2947B3, 0xC8000000), cjson_u64(0x16F578C4, 0xE0A060B5) }, /* 5^42 */
+    { cjson_u64(0x2DB399A0, 0xBA000000), cjson_u64(0x1CB2D6F6, 0x18C878E3) }, /* 5^43 */
+    { cjson_u64(0xFC904004, 0x74400000), cjson_u64(0x11EFC659, 0xCF7D4B8D) }, /* 5^44 */
+    { cjson_u64(0x7BB45005, 0x91500000), cjson_u64(0x166BB7F0, 0x435C9E71) }, /* 5^45 */
+    { cjson_u64(0xDAA16406, 0xF5A40000), cjson_u64(0x1C06A5EC, 0x5433C60D) }, /* 5^46 */
+    { cjson_u64(0xA8A4DE84, 0x59868000), cjson_u64(0x118427B3, 0xB4A05BC8) }, /* 5^47 */
+    { cjson_u64(0xD2CE1625, 0x6FE82000), cjson_u64(0x15E531A0, 0xA1C872BA) }, /* 5^48 */
+    { cjson_u64(0x87819BAE, 0xCBE22800), cjson_u64(0x1B5E7E08, 0xCA3A8F69) }, /* 5^49 */
+    { cjson_u64(0xF4B1014D, 0x3F6D5900), cjson_u64(0x111B0EC5, 0x7E6499A1) }, /* 5^50 */
+    { cjson_u64(0x71DD41A0, 0x8F48AF40), cjson_u64(0x1561D276, 0xDDFDC00A) }, /* 5^51 */
+    { cjson_u64(0x0E549208, 0xB31ADB10), cjson_u64(0x1ABA4714, 0x957D300D) }, /* 5^52 */
+    { cjson_u64(0x28F4DB45, 0x6FF0C8EA), cjson_u64(0x10B46C6C, 0xDD6E3E08) }, /* 5^53 */
+    { cjson_u64(0x33321216, 0xCBECFB24), cjson_u64(0x14E18788, 0x14C9CD8A) }, /* 5^54 */
+    { cjson_u64(0xBFFE969C, 0x7EE839ED), cjson_u64(0x1A19E96A, 0x19FC40EC) }, /* 5^55 */
+    { cjson_u64(0xF7FF1E21, 0xCF512434), cjson_u64(0x105031E2, 0x503DA893) }, /* 5^56 */
+    { cjson_u64(0xF5FEE5AA, 0x43256D41), cjson_u64(0x14643E5A, 0xE44D12B8) }, /* 5^57 */
+    { cjson_u64(0x337E9F14, 0xD3EEC892), cjson_u64(0x197D4DF1, 0x9D605767) }, /* 5^58 */
+    { cjson_u64(0x005E46DA, 0x08EA7AB6), cjson_u64(0x1FDCA16E, 0x04B86D41) }, /* 5^59 */
+    { cjson_u64(0xA03AEC48, 0x45928CB2), cjson_u64(0x13E9E4E4, 0xC2F34448) }, /* 5^60 */
+    { cjson_u64(0xC849A75A, 0x56F72FDE), cjson_u64(0x18E45E1D, 0xF3B0155A) }, /* 5^61 */
+    { cjson_u64(0x7A5C1130, 0xECB4FBD6), cjson_u64(0x1F1D75A5, 0x709C1AB1) }, /* 5^62 */
+    { cjson_u64(0xEC798ABE, 0x93F11D65), cjson_u64(0x13726987, 0x666190AE) }, /* 5^63 */
+    { cjson_u64(0xA797ED6E, 0x38ED64BF), cjson_u64(0x184F03E9, 0x3FF9F4DA) }, /* 5^64 */
+    { cjson_u64(0x517DE8C9, 0xC728BDEF), cjson_u64(0x1E62C4E3, 0x8FF87211) }, /* 5^65 */
+    { cjson_u64(0xD2EEB17E, 0x1C7976B5), cjson_u64(0x12FDBB0E, 0x39FB474A) }, /* 5^66 */
+    { cjson_u64(0x87AA5DDD, 0xA397D462), cjson_u64(0x17BD29D1, 0xC87A191D) }, /* 5^67 */
+    { cjson_u64(0xE994F555, 0x0C7DC97B), cjson_u64(0x1DAC7446, 0x3A989F64) }, /* 5^68 */
+    { cjson_u64(0x11FD1955, 0x27CE9DED), cjson_u64(0x128BC8AB, 0xE49F639F) }, /* 5^69 */
+    { cjson_u64(0xD67C5FAA, 0x71C24568), cjson_u64(0x172EBAD6, 0xDDC73C86) }, /* 5^70 */
+    { cjson_u64(0x8C1B7795, 0x0E32D6C2), cjson_u64(0x1CFA698C, 0x95390BA8) }, /* 5^71 */
+    { cjson_u64(0x57912ABD, 0x28DFC639), cjson_u64(0x121C81F7, 0xDD43A749) }, /* 5^72 */
+    { cjson_u64(0xAD75756C, 0x7317B7C8), cjson_u64(0x16A3A275, 0xD494911B) }, /* 5^73 */
+    { cjson_u64(0x98D2D2C7, 0x8FDDA5BA), cjson_u64(0x1C4C8B13, 0x49B9B562) }, /* 5^74 */
+    { cjson_u64(0x9F83C3BC, 0xB9EA8794), cjson_u64(0x11AFD6EC, 0x0E14115D) }, /* 5^75 */
+    { cjson_u64(0x0764B4AB, 0xE8652979), cjson_u64(0x161BCCA7, 0x119915B5) }, /* 5^76 */
+    { cjson_u64(0x493DE1D6, 0xE27E73D7), cjson_u64(0x1BA2BFD0, 0xD5FF5B22) }, /* 5^77 */
+    { cjson_u64(0x6DC6AD26, 0x4D8F0866), cjson_u64(0x1145B7E2, 0x85BF98F5) }, /* 5^78 */
+    { cjson_u64(0xC938586F, 0xE0F2CA80), cjson_u64(0x159725DB, 0x272F7F32) }, /* 5^79 */
+    { cjson_u64(0x7B866E8B, 0xD92F7D20), cjson_u64(0x1AFCEF51, 0xF0FB5EFF) }, /* 5^80 */
+    { cjson_u64(0xAD340517, 0x67BDAE34), cjson_u64(0x10DE1593, 0x369D1B5F) }, /* 5^81 */
+    { cjson_u64(0x9881065D, 0x41AD19C1), cjson_u64(0x15159AF8, 0x04446237) }, /* 5^82 */
+    { cjson_u64(0x7EA147F4, 0x92186032), cjson_u64(0x1A5B01B6, 0x05557AC5) }, /* 5^83 */
+    { cjson_u64(0x6F24CCF8, 0xDB4F3C1F), cjson_u64(0x1078E111, 0xC3556CBB) }, /* 5^84 */
+    { cjson_u64(0x4AEE0037, 0x12230B27), cjson_u64(0x14971956, 0x342AC7EA) }, /* 5^85 */
+    { cjson_u64(0xDDA98044, 0xD6ABCDF0), cjson_u64(0x19BCDFAB, 0xC13579E4) }, /* 5^86 */
+    { cjson_u64(0x0A89F02B, 0x062B60B6), cjson_u64(0x10160BCB, 0x58C16C2F) }, /* 5^87 */
+    { cjson_u64(0xCD2C6C35, 0xC7B638E4), cjson_u64(0x141B8EBE, 0x2EF1C73A) }, /* 5^88 */
+    { cjson_u64(0x80778743, 0x39A3C71D), cjson_u64(0x1922726D, 0xBAAE3909) }, /* 5^89 */
+    { cjson_u64(0xE0956914, 0x080CB8E4), cjson_u64(0x1F6B0F09, 0x2959C74B) }, /* 5^90 */
+    { cjson_u64(0x6C5D61AC, 0x8507F38E), cjson_u64(0x13A2E965, 0xB9D81C8F) }, /* 5^91 */
+    { cjson_u64(0x4774BA17, 0xA649F072), cjson_u64(0x188BA3BF, 0x284E23B3) }, /* 5^92 */
+    { cjson_u64(0x1951E89D, 0x8FDC6C8F), cjson_u64(0x1EAE8CAE, 0xF261ACA0) }, /* 5^93 */
+    { cjson_u64(0x0FD33162, 0x79E9C3D9), cjson_u64(0x132D17ED, 0x577D0BE4) }, /* 5^94 */
+    { cjson_u64(0x13C7FDBB, 0x186434CF), cjson_u64(0x17F85DE8, 0xAD5C4EDD) }, /* 5^95 */
+    { cjson_u64(0x58B9FD29, 0xDE7D4203), cjson_u64(0x1DF67562, 0xD8B36294) }, /* 5^96 */
+    { cjson_u64(0xB7743E3A, 0x2B0E4942), cjson_u64(0x12BA095D, 0xC7701D9C) }, /* 5^97 */
+    { cjson_u64(0xE5514DC8, 0xB5D1DB92), cjson_u64(0x17688BB5, 0x394C2503) }, /* 5^98 */
+    { cjson_u64(0xDEA5A13A, 0xE3465277), cjson_u64(0x1D42AEA2, 0x879F2E44) }, /* 5^99 */
+    { cjson_u64(0x0B2784C4, 0xCE0BF38A), cjson_u64(0x1249AD25, 0x94C37CEB) }, /* 5^100 */
+    { cjson_u64(0xCDF165F6, 0x018EF06D), cjson_u64(0x16DC186E, 0xF9F45C25) }, /* 5^101 */
+    { cjson_u64(0x416DBF73, 0x81F2AC88), cjson_u64(0x1C931E8A, 0xB871732F) }, /* 5^102 */
+    { cjson_u64(0x88E497A8, 0x3137ABD5), cjson_u64(0x11DBF316, 0xB346E7FD) }, /* 5^103 */
+    { cjson_u64(0xEB1DBD92, 0x3D8596CA), cjson_u64(0x1652EFDC, 0x6018A1FC) }, /* 5^104 */
+    { cjson_u64(0x25E52CF6, 0xCCE6FC7D), cjson_u64(0x1BE7ABD3, 0x781ECA7C) }, /* 5^105 */
+    { cjson_u64(0x97AF3C1A, 0x40105DCE), cjson_u64(0x1170CB64, 0x2B133E8D) }, /* 5^106 */
+    { cjson_u64(0xFD9B0B20, 0xD0147542), cjson_u64(0x15CCFE3D, 0x35D80E30) }, /* 5^107 */
+    { cjson_u64(0x3D01CDE9, 0x04199292), cjson_u64(0x1B403DCC, 0x834E11BD) }, /* 5^108 */
+    { cjson_u64(0x462120B1, 0xA28FFB9B), cjson_u64(0x1108269F, 0xD210CB16) }, /* 5^109 */
+    { cjson_u64(0xD7A968DE, 0x0B33FA82), cjson_u64(0x154A3047, 0xC694FDDB) }, /* 5^110 */
+    { cjson_u64(0xCD93C315, 0x8E00F923), cjson_u64(0x1A9CBC59, 0xB83A3D52) }, /* 5^111 */
+    { cjson_u64(0xC07C59ED, 0x78C09BB6), cjson_u64(0x10A1F5B8, 0x13246653) }, /* 5^112 */
+    { cjson_u64(0xB09B7068, 0xD6F0C2A3), cjson_u64(0x14CA7326, 0x17ED7FE8) }, /* 5^113 */
+    { cjson_u64(0xDCC24C83, 0x0CACF34C), cjson_u64(0x19FD0FEF, 0x9DE8DFE2) }, /* 5^114 */
+    { cjson_u64(0xC9F96FD1, 0xE7EC180F), cjson_u64(0x103E29F5, 0xC2B18BED) }, /* 5^115 */
+    { cjson_u64(0x3C77CBC6, 0x61E71E13), cjson_u64(0x144DB473, 0x335DEEE9) }, /* 5^116 */
+    { cjson_u64(0x8B95BEB7, 0xFA60E598), cjson_u64(0x19612190, 0x00356AA3) }, /* 5^117 */
+    { cjson_u64(0x6E7B2E65, 0xF8F91EFE), cjson_u64(0x1FB969F4, 0x0042C54C) }, /* 5^118 */
+    { cjson_u64(0xC50CFCFF, 0xBB9BB35F), cjson_u64(0x13D3E238, 0x8029BB4F) }, /* 5^119 */
+    { cjson_u64(0xB6503C3F, 0xAA82A037), cjson_u64(0x18C8DAC6, 0xA0342A23) }, /* 5^120 */
+    { cjson_u64(0xA3E44B4F, 0x95234844), cjson_u64(0x1EFB1178, 0x484134AC) }, /* 5^121 */
+    { cjson_u64(0xE66EAF11, 0xBD360D2B), cjson_u64(0x135CEAEB, 0x2D28C0EB) }, /* 5^122 */
+    { cjson_u64(0xE00A5AD6, 0x2C839075), cjson_u64(0x183425A5, 0xF872F126) }, /* 5^123 */
+    { cjson_u64(0x980CF18B, 0xB7A47493), cjson_u64(0x1E412F0F, 0x768FAD70) }, /* 5^124 */
+    { cjson_u64(0x5F0816F7, 0x52C6C8DC), cjson_u64(0x12E8BD69, 0xAA19CC66) }, /* 5^125 */
+    { cjson_u64(0xF6CA1CB5, 0x27787B13), cjson_u64(0x17A2ECC4, 0x14A03F7F) }, /* 5^126 */
+    { cjson_u64(0xF47CA3E2, 0x715699D7), cjson_u64(0x1D8BA7F5, 0x19C84F5F) }, /* 5^127 */
+    { cjson_u64(0xF8CDE66D, 0x86D62026), cjson_u64(0x127748F9, 0x301D319B) }, /* 5^128 */
+    { cjson_u64(0xF7016008, 0xE88BA830), cjson_u64(0x17151B37, 0x7C247E02) }, /* 5^129 */
+    { cjson_u64(0xB4C1B80B, 0x22AE923C), cjson_u64(0x1CDA6205, 0x5B2D9D83) }, /* 5^130 */
+    { cjson_u64(0x50F91306, 0xF5AD1B65), cjson_u64(0x12087D43, 0x58FC8272) }, /* 5^131 */
+    { cjson_u64(0xE53757C8, 0xB318623F), cjson_u64(0x168A9C94, 0x2F3BA30E) }, /* 5^132 */
+    { cjson_u64(0x9E852DBA, 0xDFDE7ACF), cjson_u64(0x1C2D43B9, 0x3B0A8BD2) }, /* 5^133 */
+    { cjson_u64(0xA3133C94, 0xCBEB0CC1), cjson_u64(0x119C4A53, 0xC4E69763) }, /* 5^134 */
+    { cjson_u64(0x8BD80BB9, 0xFEE5CFF1), cjson_u64(0x16035CE8, 0xB6203D3C) }, /* 5^135 */
+    { cjson_u64(0xAECE0EA8, 0x7E9F43EE), cjson_u64(0x1B843422, 0xE3A84C8B) }, /* 5^136 */
+    { cjson_u64(0x4D40C929, 0x4F238A75), cjson_u64(0x1132A095, 0xCE492FD7) }, /* 5^137 */
+    { cjson_u64(0x2090FB73, 0xA2EC6D12), cjson_u64(0x157F48BB, 0x41DB7BCD) }, /* 5^138 */
+    { cjson_u64(0x68B53A50, 0x8BA78856), cjson_u64(0x1ADF1AEA, 0x12525AC0) }, /* 5^139 */
+    { cjson_u64(0x41714472, 0x5748B536), cjson_u64(0x10CB70D2, 0x4B7378B8) }, /* 5^140 */
+    { cjson_u64(0x51CD958E, 0xED1AE283), cjson_u64(0x14FE4D06, 0xDE5056E6) }, /* 5^141 */
+    { cjson_u64(0xE640FAF2, 0xA8619B24), cjson_u64(0x1A3DE048, 0x95E46C9F) }, /* 5^142 */
+    { cjson_u64(0xEFE89CD7, 0xA93D00F7), cjson_u64(0x1066AC2D, 0x5DAEC3E3) }, /* 5^143 */
+    { cjson_u64(0xEBE2C40D, 0x938C4134), cjson_u64(0x14805738, 0xB51A74DC) }, /* 5^144 */
+    { cjson_u64(0x26DB7510, 0xF86F5181), cjson_u64(0x19A06D06, 0xE2611214) }, /* 5^145 */
+    { cjson_u64(0x9849292A, 0x9B4592F1), cjson_u64(0x10044424, 0x4D7CAB4C) }, /* 5^146 */
+    { cjson_u64(0xBE5B7375, 0x4216F7AD), cjson_u64(0x1405552D, 0x60DBD61F) }, /* 5^147 */
+    { cjson_u64(0xADF25052, 0x929CB598), cjson_u64(0x1906AA78, 0xB912CBA7) }, /* 5^148 */
+    { cjson_u64(0x996EE467, 0x3743E2FF), cjson_u64(0x1F485516, 0xE7577E91) }, /* 5^149 */
+    { cjson_u64(0xFFE54EC0, 0x828A6DDF), cjson_u64(0x138D352E, 0x5096AF1A) }, /* 5^150 */
+    { cjson_u64(0xBFDEA270, 0xA32D0957), cjson_u64(0x18708279, 0xE4BC5AE1) }, /* 5^151 */
+    { cjson_u64(0x2FD64B0C, 0xCBF84BAD), cjson_u64(0x1E8CA318, 0x5DEB719A) }, /* 5^152 */
+    { cjson_u64(0x5DE5EEE7, 0xFF7B2F4C), cjson_u64(0x1317E5EF, 0x3AB32700) }, /* 5^153 */
+    { cjson_u64(0x755F6AA1, 0xFF59FB1F), cjson_u64(0x17DDDF6B, 0x095FF0C0) }, /* 5^154 */
+    { cjson_u64(0x92B7454A, 0x7F3079E7), cjson_u64(0x1DD55745, 0xCBB7ECF0) }, /* 5^155 */
+    { cjson_u64(0x5BB28B4E, 0x8F7E4C30), cjson_u64(0x12A5568B, 0x9F52F416) }, /* 5^156 */
+    { cjson_u64(0xF29F2E22, 0x335DDF3C), cjson_u64(0x174EAC2E, 0x8727B11B) }, /* 5^157 */
+    { cjson_u64(0xEF46F9AA, 0xC035570B), cjson_u64(0x1D22573A, 0x28F19D62) }, /* 5^158 */
+    { cjson_u64(0xD58C5C0A, 0xB8215667), cjson_u64(0x12357684, 0x5997025D) }, /* 5^159 */
+    { cjson_u64(0x4AEF730D, 0x6629AC01), cjson_u64(0x16C2D425, 0x6FFCC2F5) }, /* 5^160 */
+    { cjson_u64(0x9DAB4FD0, 0xBFB41701), cjson_u64(0x1C73892E, 0xCBFBF3B2) }, /* 5^161 */
+    { cjson_u64(0xA28B11E2, 0x77D08E60), cjson_u64(0x11C835BD, 0x3F7D784F) }, /* 5^162 */
+    { cjson_u64(0x8B2DD65B, 0x15C4B1F9), cjson_u64(0x163A432C, 0x8F5CD663) }, /* 5^163 */
+    { cjson_u64(0x6DF94BF1, 0xDB35DE77), cjson_u64(0x1BC8D3F7, 0xB3340BFC) }, /* 5^164 */
+    { cjson_u64(0xC4BBCF77, 0x2901AB0A), cjson_u64(0x115D847A, 0xD000877D) }, /* 5^165 */
+    { cjson_u64(0x35EAC354, 0xF34215CD), cjson_u64(0x15B4E599, 0x8400A95D) }, /* 5^166 */
+    { cjson_u64(0x8365742A, 0x30129B40), cjson_u64(0x1B221EFF, 0xE500D3B4) }, /* 5^167 */
+    { cjson_u64(0xD21F689A, 0x5E0BA108), cjson_u64(0x10F5535F, 0xEF208450) }, /* 5^168 */
+    { cjson_u64(0x06A742C0, 0xF58E894A), cjson_u64(0x1532A837, 0xEAE8A565) }, /* 5^169 */
+    { cjson_u64(0x48511371, 0x32F22B9D), cjson_u64(0x1A7F5245, 0xE5A2CEBE) }, /* 5^170 */
+    { cjson_u64(0xED32AC26, 0xBFD75B42), cjson_u64(0x108F936B, 0xAF85C136) }, /* 5^171 */
+    { cjson_u64(0xA87F5730, 0x6FCD3212), cjson_u64(0x14B37846, 0x9B673184) }, /* 5^172 */
+    { cjson_u64(0xD29F2CFC, 0x8BC07E97), cjson_u64(0x19E05658, 0x4240FDE5) }, /* 5^173 */
+    { cjson_u64(0xA3A37C1D, 0xD7584F1E), cjson_u64(0x102C35F7, 0x29689EAF) }, /* 5^174 */
+    { cjson_u64(0x8C8C5B25, 0x4D2E62E6), cjson_u64(0x14374374, 0xF3C2C65B) }, /* 5^175 */
+    { cjson_u64(0x6FAF71EE, 0xA079FB9F), cjson_u64(0x19451452, 0x30B377F2) }, /* 5^176 */
+    { cjson_u64(0x0B9B4E6A, 0x48987A87), cjson_u64(0x1F965966, 0xBCE055EF) }, /* 5^177 */
+    { cjson_u64(0x67411102, 0x6D5F4C94), cjson_u64(0x13BDF7E0, 0x360C35B5) }, /* 5^178 */
+    { cjson_u64(0xC1115543, 0x08B71FBA), cjson_u64(0x18AD75D8, 0x438F4322) }, /* 5^179 */
+    { cjson_u64(0x7155AA93, 0xCAE4E7A8), cjson_u64(0x1ED8D34E, 0x547313EB) }, /* 5^180 */
+    { cjson_u64(0x26D58A9C, 0x5ECF10C9), cjson_u64(0x13478410, 0xF4C7EC73) }, /* 5^181 */
+    { cjson_u64(0xF08AED43, 0x7682D4FB), cjson_u64(0x18196515, 0x31F9E78F) }, /* 5^182 */
+    { cjson_u64(0xECADA894, 0x54238A3A), cjson_u64(0x1E1FBE5A, 0x7E786173) }, /* 5^183 */
+    { cjson_u64(0x73EC895C, 0xB4963664), cjson_u64(0x12D3D6F8, 0x8F0B3CE8) }, /* 5^184 */
+    { cjson_u64(0x90E7ABB3, 0xE1BBC3FD), cjson_u64(0x1788CCB6, 0xB2CE0C22) }, /* 5^185 */
+    { cjson_u64(0x352196A0, 0xDA2AB4FD), cjson_u64(0x1D6AFFE4, 0x5F818F2B) }, /* 5^186 */
+    { cjson_u64(0x0134FE24, 0x885AB11E), cjson_u64(0x1262DFEE, 0xBBB0F97B) }, /* 5^187 */
+    { cjson_u64(0xC1823DAD, 0xAA715D65), cjson_u64(0x16FB97EA, 0x6A9D37D9) }, /* 5^188 */
+    { cjson_u64(0x31E2CD19, 0x150DB4BF), cjson_u64(0x1CBA7DE5, 0x054485D0) }, /* 5^189 */
+    { cjson_u64(0x1F2DC02F, 0xAD2890F7), cjson_u64(0x11F48EAF, 0x234AD3A2) }, /* 5^190 */
+    { cjson_u64(0xA6F9303B, 0x9872B535), cjson_u64(0x1671B25A, 0xEC1D888A) }, /* 5^191 */
+    { cjson_u64(0x50B77C4A, 0x7E8F6282), cjson_u64(0x1C0E1EF1, 0xA724EAAD) }, /* 5^192 */
+    { cjson_u64(0x5272ADAE, 0x8F199D91), cjson_u64(0x1188D357, 0x087712AC) }, /* 5^193 */
+    { cjson_u64(0x670F591A, 0x32E004F6), cjson_u64(0x15EB082C, 0xCA94D757) }, /* 5^194 */
+    { cjson_u64(0x40D32F60, 0xBF980633), cjson_u64(0x1B65CA37, 0xFD3A0D2D) }, /* 5^195 */
+    { cjson_u64(0x4883FD9C, 0x77BF03E0), cjson_u64(0x111F9E62, 0xFE44483C) }, /* 5^196 */
+    { cjson_u64(0x5AA4FD03, 0x95AEC4D8), cjson_u64(0x156785FB, 0xBDD55A4B) }, /* 5^197 */
+    { cjson_u64(0x314E3C44, 0x7B1A760E), cjson_u64(0x1AC1677A, 0xAD4AB0DE) }, /* 5^198 */
+    { cjson_u64(0xDED0E5AA, 0xCCF089C9), cjson_u64(0x10B8E0AC, 0xAC4EAE8A) }, /* 5^199 */
+    { cjson_u64(0x96851F15, 0x802CAC3B), cjson_u64(0x14E718D7, 0xD7625A2D) }, /* 5^200 */
+    { cjson_u64(0xFC2666DA, 0xE037D74A), cjson_u64(0x1A20DF0D, 0xCD3AF0B8) }, /* 5^201 */
+    { cjson_u64(0x9D980048, 0xCC22E68E), cjson_u64(0x10548B68, 0xA044D673) }, /* 5^202 */
+    { cjson_u64(0x84FE005A, 0xFF2BA032), cjson_u64(0x1469AE42, 0xC8560C10) }, /* 5^203 */
+    { cjson_u64(0xA63D8071, 0xBEF6883E), cjson_u64(0x198419D3, 0x7A6B8F14) }, /* 5^204 */
+    { cjson_u64(0xCFCCE08E, 0x2EB42A4E), cjson_u64(0x1FE52048, 0x590672D9) }, /* 5^205 */
+    { cjson_u64(0x21E00C58, 0xDD309A70), cjson_u64(0x13EF342D, 0x37A407C8) }, /* 5^206 */
+    { cjson_u64(0x2A580F6F, 0x147CC10D), cjson_u64(0x18EB0138, 0x858D09BA) }, /* 5^207 */
+    { cjson_u64(0xB4EE134A, 0xD99BF150), cjson_u64(0x1F25C186, 0xA6F04C28) }, /* 5^208 */
+    { cjson_u64(0x7114CC0E, 0xC80176D2), cjson_u64(0x137798F4, 0x28562F99) }, /* 5^209 */
+    { cjson_u64(0xCD59FF12, 0x7A01D486), cjson_u64(0x18557F31, 0x326BBB7F) }, /* 5^210 */
+    { cjson_u64(0xC0B07ED7, 0x188249A8), cjson_u64(0x1E6ADEFD, 0x7F06AA5F) }, /* 5^211 */
+    { cjson_u64(0xD86E4F46, 0x6F516E09), cjson_u64(0x1302CB5E, 0x6F642A7B) }, /* 5^212 */
+    { cjson_u64(0xCE89E318, 0x0B25C98B), cjson_u64(0x17C37E36, 0x0B3D351A) }, /* 5^213 */
+    { cjson_u64(0x822C5BDE, 0x0DEF3BEE), cjson_u64(0x1DB45DC3, 0x8E0C8261) }, /* 5^214 */
+    { cjson_u64(0xF15BB96A, 0xC8B58575), cjson_u64(0x1290BA9A, 0x38C7D17C) }, /* 5^215 */
+    { cjson_u64(0x2DB2A7C5, 0x7AE2E6D2), cjson_u64(0x1734E940, 0xC6F9C5DC) }, /* 5^216 */
+    { cjson_u64(0x391F51B6, 0xD99BA086), cjson_u64(0x1D022390, 0xF8B83753) }, /* 5^217 */
+    { cjson_u64(0x03B39312, 0x48014454), cjson_u64(0x1221563A, 0x9B732294) }, /* 5^218 */
+    { cjson_u64(0x04A077D6, 0xDA019569), cjson_u64(0x16A9ABC9, 0x424FEB39) }, /* 5^219 */
+    { cjson_u64(0x45C895CC, 0x9081FAC3), cjson_u64(0x1C5416BB, 0x92E3E607) }, /* 5^220 */
+    { cjson_u64(0x8B9D5D9F, 0xDA513CBA), cjson_u64(0x11B48E35, 0x3BCE6FC4) }, /* 5^221 */
+    { cjson_u64(0xAE84B507, 0xD0E58BE8), cjson_u64(0x1621B1C2, 0x8AC20BB5) }, /* 5^222 */
+    { cjson_u64(0x1A25E249, 0xC51EEEE3), cjson_u64(0x1BAA1E33, 0x2D728EA3) }, /* 5^223 */
+    { cjson_u64(0xF057AD6E, 0x1B33554D), cjson_u64(0x114A52DF, 0xFC679925) }, /* 5^224 */
+    { cjson_u64(0x6C6D98C9, 0xA2002AA1), cjson_u64(0x159CE797, 0xFB817F6F) }, /* 5^225 */
+    { cjson_u64(0x4788FEFC, 0x0A803549), cjson_u64(0x1B04217D, 0xFA61DF4B) }, /* 5^226 */
+    { cjson_u64(0x0CB59F5D, 0x8690214E), cjson_u64(0x10E294EE, 0xBC7D2B8F) }, /* 5^227 */
+    { cjson_u64(0xCFE30734, 0xE83429A1), cjson_u64(0x151B3A2A, 0x6B9C7672) }, /* 5^228 */
+    { cjson_u64(0x83DBC902, 0x2241340A), cjson_u64(0x1A6208B5, 0x0683940F) }, /* 5^229 */
+    { cjson_u64(0xB2695DA1, 0x5568C086), cjson_u64(0x107D4571, 0x24123C89) }, /* 5^230 */
+    { cjson_u64(0x1F03B509, 0xAAC2F0A7), cjson_u64(0x149C96CD, 0x6D16CBAC) }, /* 5^231 */
+    { cjson_u64(0x26C4A24C, 0x1573ACD1), cjson_u64(0x19C3BC80, 0xC85C7E97) }, /* 5^232 */
+    { cjson_u64(0x783AE56F, 0x8D684C03), cjson_u64(0x101A55D0, 0x7D39CF1E) }, /* 5^233 */
+    { cjson_u64(0x16499ECB, 0x70C25F03), cjson_u64(0x1420EB44, 0x9C8842E6) }, /* 5^234 */
+    { cjson_u64(0x9BDC067E, 0x4CF2F6C4), cjson_u64(0x19292615, 0xC3AA539F) }, /* 5^235 */
+    { cjson_u64(0x82D3081D, 0xE02FB476), cjson_u64(0x1F736F9B, 0x3494E887) }, /* 5^236 */
+    { cjson_u64(0xB1C3E512, 0xAC1DD0C9), cjson_u64(0x13A825C1, 0x00DD1154) }, /* 5^237 */
+    { cjson_u64(0xDE34DE57, 0x572544FC), cjson_u64(0x18922F31, 0x411455A9) }, /* 5^238 */
+    { cjson_u64(0x55C215ED, 0x2CEE963B), cjson_u64(0x1EB6BAFD, 0x91596B14) }, /* 5^239 */
+    { cjson_u64(0xB5994DB4, 0x3C151DE5), cjson_u64(0x133234DE, 0x7AD7E2EC) }, /* 5^240 */
+    { cjson_u64(0xE2FFA121, 0x4B1A655E), cjson_u64(0x17FEC216, 0x198DDBA7) }, /* 5^241 */
+    { cjson_u64(0xDBBF8969, 0x9DE0FEB6), cjson_u64(0x1DFE729B, 0x9FF15291) }, /* 5^242 */
+    { cjson_u64(0x2957B5E2, 0x02AC9F31), cjson_u64(0x12BF07A1, 0x43F6D39B) }, /* 5^243 */
+    { cjson_u64(0xF3ADA35A, 0x8357C6FE), cjson_u64(0x176EC989, 0x94F48881) }, /* 5^244 */
+    { cjson_u64(0x70990C31, 0x242DB8BD), cjson_u64(0x1D4A7BEB, 0xFA31AAA2) }, /* 5^245 */
+    { cjson_u64(0x865FA79E, 0xB69C9376), cjson_u64(0x124E8D73, 0x7C5F0AA5) }, /* 5^246 */
+    { cjson_u64(0xE7F79186, 0x6443B854), cjson_u64(0x16E230D0, 0x5B76CD4E) }, /* 5^247 */
+    { cjson_u64(0xA1F575E7, 0xFD54A669), cjson_u64(0x1C9ABD04, 0x725480A2) }, /* 5^248 */
+    { cjson_u64(0xA53969B0, 0xFE54E801), cjson_u64(0x11E0B622, 0xC774D065) }, /* 5^249 */
+    { cjson_u64(0x0E87C41D, 0x3DEA2202), cjson_u64(0x1658E3AB, 0x7952047F) }, /* 5^250 */
+    { cjson_u64(0xD229B524, 0x8D64AA82), cjson_u64(0x1BEF1C96, 0x57A6859E) }, /* 5^251 */
+    { cjson_u64(0x435A1136, 0xD85EEA91), cjson_u64(0x117571DD, 0xF6C81383) }, /* 5^252 */
+    { cjson_u64(0x14309584, 0x8E76A536), cjson_u64(0x15D2CE55, 0x747A1864) }, /* 5^253 */
+    { cjson_u64(0x193CBAE5, 0xB2144E83), cjson_u64(0x1B4781EA, 0xD1989E7D) }, /* 5^254 */
+    { cjson_u64(0x2FC5F4CF, 0x8F4CB112), cjson_u64(0x110CB132, 0xC2FF630E) }, /* 5^255 */
+    { cjson_u64(0xBBB77203, 0x731FDD56), cjson_u64(0x154FDD7F, 0x73BF3BD1) }, /* 5^256 */
+    { cjson_u64(0x2AA54E84, 0x4FE7D4AC), cjson_u64(0x1AA3D4DF, 0x50AF0AC6) }, /* 5^257 */
+    { cjson_u64(0xDAA75112, 0xB1F0E4EB), cjson_u64(0x10A6650B, 0x926D66BB) }, /* 5^258 */
+    { cjson_u64(0xD1512557, 0x5E6D1E26), cjson_u64(0x14CFFE4E, 0x7708C06A) }, /* 5^259 */
+    { cjson_u64(0x85A56EAD, 0x360865B0), cjson_u64(0x1A03FDE2, 0x14CAF085) }, /* 5^260 */
+    { cjson_u64(0x7387652C, 0x41C53F8E), cjson_u64(0x10427EAD, 0x4CFED653) }, /* 5^261 */
+    { cjson_u64(0x50693E77, 0x52368F71), cjson_u64(0x14531E58, 0xA03E8BE8) }, /* 5^262 */
+    { cjson_u64(0x64838E15, 0x26C4334E), cjson_u64(0x1967E5EE, 0xC84E2EE2) }, /* 5^263 */
+    { cjson_u64(0xFDA4719A, 0x70754022), cjson_u64(0x1FC1DF6A, 0x7A61BA9A) }, /* 5^264 */
+    { cjson_u64(0xDE86C700, 0x86494815), cjson_u64(0x13D92BA2, 0x8C7D14A0) }, /* 5^265 */
+    { cjson_u64(0x162878C0, 0xA7DB9A1A), cjson_u64(0x18CF768B, 0x2F9C59C9) }, /* 5^266 */
+    { cjson_u64(0x5BB296F0, 0xD1D280A1), cjson_u64(0x1F03542D, 0xFB83703B) }, /* 5^267 */
+    { cjson_u64(0x194F9E56, 0x83239064), cjson_u64(0x1362149C, 0xBD322625) }, /* 5^268 */
+    { cjson_u64(0x5FA385EC, 0x23EC747E), cjson_u64(0x183A99C3, 0xEC7EAFAE) }, /* 5^269 */
+    { cjson_u64(0xF78C6767, 0x2CE7919D), cjson_u64(0x1E494034, 0xE79E5B99) }, /* 5^270 */
+    { cjson_u64(0x3AB7C0A0, 0x7C10BB02), cjson_u64(0x12EDC821, 0x10C2F940) }, /* 5^271 */
+    { cjson_u64(0x4965B0C8, 0x9B14E9C3), cjson_u64(0x17A93A29, 0x54F3B790) }, /* 5^272 */
+    { cjson_u64(0x5BBF1CFA, 0xC1DA2433), cjson_u64(0x1D9388B3, 0xAA30A574) }, /* 5^273 */
+    { cjson_u64(0xB957721C, 0xB92856A0), cjson_u64(0x127C3570, 0x4A5E6768) }, /* 5^274 */
+    { cjson_u64(0xE7AD4EA3, 0xE7726C48), cjson_u64(0x171B42CC, 0x5CF60142) }, /* 5^275 */
+    { cjson_u64(0xA198A24C, 0xE14F075A), cjson_u64(0x1CE2137F, 0x74338193) }, /* 5^276 */
+    { cjson_u64(0x44FF6570, 0x0CD16498), cjson_u64(0x120D4C2F, 0xA8A030FC) }, /* 5^277 */
+    { cjson_u64(0x563F3ECC, 0x1005BDBE), cjson_u64(0x16909F3B, 0x92C83D3B) }, /* 5^278 */
+    { cjson_u64(0x2BCF0E7F, 0x14072D2E), cjson_u64(0x1C34C70A, 0x777A4C8A) }, /* 5^279 */
+    { cjson_u64(0x5B61690F, 0x6C847C3D), cjson_u64(0x11A0FC66, 0x8AAC6FD6) }, /* 5^280 */
+    { cjson_u64(0xF239C353, 0x47A59B4C), cjson_u64(0x16093B80, 0x2D578BCB) }, /* 5^281 */
+    { cjson_u64(0xEEC83428, 0x198F021F), cjson_u64(0x1B8B8A60, 0x38AD6EBE) }, /* 5^282 */
+    { cjson_u64(0x553D2099, 0x0FF96153), cjson_u64(0x1137367C, 0x236C6537) }, /* 5^283 */
+    { cjson_u64(0x2A8C68BF, 0x53F7B9A8), cjson_u64(0x1585041B, 0x2C477E85) }, /* 5^284 */
+    { cjson_u64(0x752F82EF, 0x28F5A812), cjson_u64(0x1AE64521, 0xF7595E26) }, /* 5^285 */
+    { cjson_u64(0x093DB1D5, 0x7999890B), cjson_u64(0x10CFEB35, 0x3A97DAD8) }, /* 5^286 */
+    { cjson_u64(0x0B8D1E4A, 0xD7FFEB4E), cjson_u64(0x1503E602, 0x893DD18E) }, /* 5^287 */
+    { cjson_u64(0x8E7065DD, 0x8DFFE622), cjson_u64(0x1A44DF83, 0x2B8D45F1) }, /* 5^288 */
+    { cjson_u64(0xF9063FAA, 0x78BFEFD5), cjson_u64(0x106B0BB1, 0xFB384BB6) }, /* 5^289 */
+    { cjson_u64(0xB747CF95, 0x16EFEBCA), cjson_u64(0x1485CE9E, 0x7A065EA4) }, /* 5^290 */
+    { cjson_u64(0xE519C37A, 0x5CABE6BD), cjson_u64(0x19A74246, 0x1887F64D) }, /* 5^291 */
+    { cjson_u64(0xAF301A2C, 0x79EB7036), cjson_u64(0x1008896B, 0xCF54F9F0) }, /* 5^292 */
+    { cjson_u64(0xDAFC20B7, 0x98664C43), cjson_u64(0x140AABC6, 0xC32A386C) }, /* 5^293 */
+    { cjson_u64(0x11BB28E5, 0x7E7FDF54), cjson_u64(0x190D56B8, 0x73F4C688) }, /* 5^294 */
+    { cjson_u64(0x1629F31E, 0xDE1FD72A), cjson_u64(0x1F50AC66, 0x90F1F82A) }, /* 5^295 */
+    { cjson_u64(0x4DDA37F3, 0x4AD3E67A), cjson_u64(0x13926BC0, 0x1A973B1A) }, /* 5^296 */
+    { cjson_u64(0xE150C5F0, 0x1D88E019), cjson_u64(0x187706B0, 0x213D09E0) }, /* 5^297 */
+    { cjson_u64(0x19A4F76C, 0x24EB181F), cjson_u64(0x1E94C85C, 0x298C4C59) }, /* 5^298 */
+    { cjson_u64(0xB0071AA3, 0x9712EF13), cjson_u64(0x131CFD39, 0x99F7AFB7) }, /* 5^299 */
+    { cjson_u64(0x9C08E14C, 0x7CD7AAD8), cjson_u64(0x17E43C88, 0x00759BA5) }, /* 5^300 */
+    { cjson_u64(0x030B199F, 0x9C0D958E), cjson_u64(0x1DDD4BAA, 0x0093028F) }, /* 5^301 */
+    { cjson_u64(0x61E6F003, 0xC1887D79), cjson_u64(0x12AA4F4A, 0x405BE199) }, /* 5^302 */
+    { cjson_u64(0xBA60AC04, 0xB1EA9CD7), cjson_u64(0x1754E31C, 0xD072D9FF) }, /* 5^303 */
+    { cjson_u64(0xA8F8D705, 0xDE65440D), cjson_u64(0x1D2A1BE4, 0x048F907F) }, /* 5^304 */
+    { cjson_u64(0xC99B8663, 0xAAFF4A88), cjson_u64(0x123A516E, 0x82D9BA4F) }, /* 5^305 */
+    { cjson_u64(0xBC0267FC, 0x95BF1D2A), cjson_u64(0x16C8E5CA, 0x239028E3) }, /* 5^306 */
+    { cjson_u64(0xAB0301FB, 0xBB2EE474), cjson_u64(0x1C7B1F3C, 0xAC74331C) }, /* 5^307 */
+    { cjson_u64(0xEAE1E13D, 0x54FD4EC9), cjson_u64(0x11CCF385, 0xEBC89FF1) }, /* 5^308 */
+    { cjson_u64(0x659A598C, 0xAA3CA27B), cjson_u64(0x16403067, 0x66BAC7EE) }, /* 5^309 */
+    { cjson_u64(0xFF00EFEF, 0xD4CBCB1A), cjson_u64(0x1BD03C81, 0x406979E9) }, /* 5^310 */
+    { cjson_u64(0x3F6095F5, 0xE4FF5EF0), cjson_u64(0x116225D0, 0xC841EC32) }, /* 5^311 */
+    { cjson_u64(0xCF38BB73, 0x5E3F36AC), cjson_u64(0x15BAAF44, 0xFA52673E) }, /* 5^312 */
+    { cjson_u64(0x8306EA50, 0x35CF0457), cjson_u64(0x1B295B16, 0x38E7010E) }, /* 5^313 */
+    { cjson_u64(0x11E45272, 0x21A162B6), cjson_u64(0x10F9D8ED, 0xE39060A9) }, /* 5^314 */
+    { cjson_u64(0x565D670E, 0xAA09BB64), cjson_u64(0x15384F29, 0x5C7478D3) }, /* 5^315 */
+    { cjson_u64(0x2BF4C0D2, 0x548C2A3D), cjson_u64(0x1A8662F3, 0xB3919708) }, /* 5^316 */
+    { cjson_u64(0x1B78F883, 0x74D79A66), cjson_u64(0x1093FDD8, 0x503AFE65) }, /* 5^317 */
+    { cjson_u64(0x625736A4, 0x520D8100), cjson_u64(0x14B8FD4E, 0x6449BDFE) }, /* 5^318 */
+    { cjson_u64(0xFAED044D, 0x6690E140), cjson_u64(0x19E73CA1, 0xFD5C2D7D) }, /* 5^319 */
+    { cjson_u64(0xBCD422B0, 0x601A8CC8), cjson_u64(0x103085E5, 0x3E599C6E) }, /* 5^320 */
+    { cjson_u64(0x6C092B5C, 0x78212FFA), cjson_u64(0x143CA75E, 0x8DF0038A) }, /* 5^321 */
+    { cjson_u64(0x070B7633, 0x96297BF8), cjson_u64(0x194BD136, 0x316C046D) }, /* 5^322 */
+    { cjson_u64(0x48CE53C0, 0x7BB3DAF6), cjson_u64(0x1F9EC583, 0xBDC70588) }, /* 5^323 */
+    { cjson_u64(0x2D80F458, 0x4D5068DA), cjson_u64(0x13C33B72, 0x569C6375) }, /* 5^324 */
+    { cjson_u64(0x78E1316E, 0x60A48310), cjson_u64(0x18B40A4E, 0xEC437C52) }  /* 5^325 */
+};
+
+/* ceil(log2(5^e)) for 0 < e <= 3528, 1 for e == 0 */
+static int pow5_bits(const int e)
+{
+    return (int)(((unsigned long)e * 1217359UL) >> 19) + 1;
+}
+
+/* floor(log10(2^e)) for 0 <= e <= 1650 */
+static int log10_pow2(const int e)
+{
+    return (int)(((unsigned long)e * 78913UL) >> 18);
+}
+
+/* floor(log10(5^e)) for 0 <= e <= 2620 */
+static int log10_pow5(const int e)
+{
+    return (int)(((unsigned long)e * 732923UL) >> 20);
+}
+
+static cJSON_bool multiple_of_power_of_5(cjson_uint64 value, const int power)
+{
+    int count = 0;
+    while ((value % 5) == 0)
+    {
+        value /= 5;
+        count++;
+    }
+    return count >= power;
+}
+
+static cJSON_bool multiple_of_power_of_2(const cjson_uint64 value, const int power)
+{
+    return (value & ((((cjson_uint64)1) << power) - 1)) == 0;
+}
+
+/* (m * multiplier) >> shift for a 128 bit multiplier and 64 <= shift < 128 */
+static cjson_uint64 multiply_shift_64(const cjson_uint64 m, const cjson_uint64 * const multiplier, const int shift)
+{
+    cjson_uint64 high0 = 0;
+    cjson_uint64 high1 = 0;
+    cjson_uint64 low1 = 0;
+    cjson_uint64 sum = 0;
+
+    multiply_64x64(m, multiplier[0], &high0);
+    low1 = multiply_64x64(m, multiplier[1], &high1);
+    sum = high0 + low1;
+    if (sum < high0)
+    {
+        high1++;
+    }
+
+    return (high1 << (128 - shift)) | (sum >> (shift - 64));
+}
+
+/* Find the shortest digits (as an integer) and the decimal exponent of a finite, positive double */
+static cjson_uint64 shortest_decimal(const cjson_uint64 bits, int * const decimal_exponent)
+{
+    const cjson_uint64 ieee_mantissa = bits & cjson_u64(0x000FFFFF, 0xFFFFFFFF);
+    const int ieee_exponent = (int)((bits >> 52) & 0x7FF);
+    cjson_uint64 m2 = 0;
+    int e2 = 0;
+    cJSON_bool accept_bounds = false;
+    cjson_uint64 mv = 0;
+    int mm_shift = 0;
+    cjson_uint64 vr = 0;
+    cjson_uint64 vp = 0;
+    cjson_uint64 vm = 0;
+    int e10 = 0;
+    cJSON_bool vm_is_trailing_zeros = false;
+    cJSON_bool vr_is_trailing_zeros = false;
+    int removed = 0;
+    unsigned int last_removed_digit = 0;
+    cjson_uint64 output = 0;
+
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = ieee_exponent - 1023 - 52 - 2;
+        m2 = (((cjson_uint64)1) << 52) | ieee_mantissa;
+    }
+    accept_bounds = (m2 & 1) == 0;
+
+    /* interval of valid decimal representations, mp = mv + 2, mm = mv - 1 - mm_shift */
+    mv = 4 * m2;
+    mm_shift = (ieee_mantissa != 0) || (ieee_exponent <= 1);
+
+    /* convert to a decimal power base */
+    if (e2 >= 0)
+    {
+        const int q = log10_pow2(e2) - (e2 > 3);
+        const int shift = -e2 + q + POW5_INV_BITCOUNT + pow5_bits(q) - 1;
+        e10 = q;
+        vr = multiply_shift_64(4 * m2, pow5_inverse_split[q], shift);
+        vp = multiply_shift_64((4 * m2) + 2, pow5_inverse_split[q], shift);
+        vm = multiply_shift_64((4 * m2) - 1 - (cjson_uint64)mm_shift, pow5_inverse_split[q], shift);
+        if (q <= 21)
+        {
+            /* only one of mp, mv, and mm can be a multiple of 5, if any */
+            if ((mv % 5) == 0)
+            {
+                vr_is_trailing_zeros = multiple_of_power_of_5(mv, q);
+            }
+            else if (accept_bounds)
+            {
+                vm_is_trailing_zeros = multiple_of_power_of_5(mv - 1 - (cjson_uint64)mm_shift, q);
+            }
+            else
+            {
+                vp -= multiple_of_power_of_5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    }
+    else
+    {
+        const int q = log10_pow5(-e2) - (-e2 > 1);
+        const int i = -e2 - q;
+        const int shift = q - (pow5_bits(i) - POW5_BITCOUNT);
+        e10 = q + e2;
+        vr = multiply_shift_64(4 * m2, pow5_split[i], shift);
+        vp = multiply_shift_64((4 * m2) + 2, pow5_split[i], shift);
+        vm = multiply_shift_64((4 * m2) - 1 - (cjson_uint64)mm_shift, pow5_split[i], shift);
+        if (q <= 1)
+        {
+            /* mv = 4 * m2 always has at least two trailing 0 bits */
+            vr_is_trailing_zeros = true;
+            if (accept_bounds)
+            {
+                /* mm = mv - 1 - mm_shift has 1 trailing 0 bit iff mm_shift == 1 */
+                vm_is_trailing_zeros = mm_shift == 1;
+            }
+            else
+            {
+                /* mp = mv + 2 always has at least one trailing 0 bit */
+                vp--;
+            }
+        }
+        else if (q < 63)
+        {
+            vr_is_trailing_zeros = multiple_of_power_of_2(mv, q);
+        }
+    }
+
+    /* find the shortest representation in the interval */
+    if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+    {
+        /* general case, which happens rarely */
+        while ((vp / 10) > (vm / 10))
+        {
+            vm_is_trailing_zeros &= (vm % 10) == 0;
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (unsigned int)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_is_trailing_zeros)
+        {
+            while ((vm % 10) == 0)
+            {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (unsigned int)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_is_trailing_zeros && (last_removed_digit == 5) && ((vr % 2) == 0))
+        {
+            /* round to even if the exact number is .....50..0 */
+            last_removed_digit = 4;
+        }
+        /* take vr + 1 if vr is outside the bounds or needs rounding up */
+        output = vr + ((((vr == vm) && (!accept_bounds || !vm_is_trailing_zeros)) || (last_removed_digit >= 5)) ? 1 : 0);
+    }
+    else
+    {
+        cJSON_bool round_up = false;
+        /* remove two digits at a time while possible */
+        if ((vp / 100) > (vm / 100))
+        {
+            round_up = (vr % 100) >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while ((vp / 10) > (vm / 10))
+        {
+            round_up = (vr % 10) >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (((vr == vm) || round_up) ? 1 : 0);
+    }
+
+    *decimal_exponent = e10 + removed;
+    return output;
+}
+
+/* Print a finite double the way "%1.15g" would, but with the shortest digits that round trip
+ * (switching to the "%1.17g" layout when more than 15 digits are needed). Returns the length. */
+static int print_shortest_double(const double number, unsigned char * const output)
+{
+    cjson_uint64 bits = 0;
+    cjson_uint64 digits = 0;
+    unsigned char digit_buffer[17];
+    int digit_count = 0;
+    int exponent = 0;
+    int precision = 0;
+    int length = 0;
+    int i = 0;
+
+    memcpy(&bits, &number, sizeof(bits));
+    if (bits >> 63)
+    {
+        output[length++] = '-';
+        bits &= ~cjson_u64(0x80000000, 0);
+    }
+    if (bits == 0)
+    {
+        output[length++] = '0';
+        output[length] = '\0';
+        return length;
+    }
+
+    digits = shortest_decimal(bits, &exponent);
+    for (; digits > 0; digits /= 10)
+    {
+        digit_buffer[16 - digit_count++] = (unsigned char)('0' + (digits % 10));
+    }
+    /* exponent of the first digit */
+    exponent += digit_count - 1;
+    precision = (digit_count <= 15) ? 15 : 17;
+
+    if ((exponent < -4) || (exponent >= precision))
+    {
+        /* d.ddde+XX */
+        output[length++] = digit_buffer[17 - digit_count];
+        if (digit_count > 1)
+        {
+            output[length++] = '.';
+            memcpy(output + length, digit_buffer + 17 - digit_count + 1, (size_t)(digit_count - 1));
+            length += digit_count - 1;
+        }
+        output[length++] = 'e';
+        output[length++] = (exponent < 0) ? '-' : '+';
+        if (exponent < 0)
+        {
+            exponent = -exponent;
+        }
+        if (exponent >= 100)
+        {
+            output[length++] = (unsigned char)('0' + (exponent / 100));
+        }
+        output[length++] = (unsigned char)('0' + ((exponent / 10) % 10));
+        output[length++] = (unsigned char)('0' + (exponent % 10));
+    }
+    else if (exponent < 0)
+    {
+        /* 0.000ddd */
+        output[length++] = '0';
+        output[length++] = '.';
+        for (i = -1; i > exponent; i--)
+        {
+            output[length++] = '0';
+        }
+        memcpy(output + length, digit_buffer + 17 - digit_count, (size_t)digit_count);
+        length += digit_count;
+    }
+    else
+    {
+        /* ddd.ddd or ddd000 */
+        for (i = 0; i < digit_count; i++)
+        {
+            if (i == (exponent + 1))
+            {
+                output[length++] = '.';
+            }
+            output[length++] = digit_buffer[17 - digit_count + i];
+        }
+        for (; i <= exponent; i++)
+        {
+            output[length++] = '0';
+        }
+    }
+
+    output[length] = '\0';
+    return length;
+}
+
+/* Render the number nicely from the given item into a string. */
+static cJSON_bool print_number(const cJSON * const item, printbuffer * const output_buffer)
+{
+    unsigned char *output_pointer = NULL;
+    double d = item->valuedouble;
+    int length = 0;
+    unsigned char number_buffer[26] = {0}; /* temporary buffer to print the number into */
+
+    if (output_buffer == NULL)
+    {
+        return false;
+    }
+
+    /* This checks for NaN and Infinity */
+    if (isnan(d) || isinf(d))
+    {
+        length = sprintf((char*)number_buffer, "null");
+    }
+    else if(d == (double)item->valueint)
+    {
+        length = sprintf((char*)number_buffer, "%d", item->valueint);
+    }
+    else
+    {
+        /* shortest representation that round trips, independent of the locale */
+        length = print_shortest_double(d, number_buffer);
+    }
+
+    /* sprintf failed or buffer overrun occurred */
+    if ((length < 0) || (length > (int)(sizeof(number_buffer) - 1)))
+    {
+        return false;
+    }
+
+    /* reserve appropriate space in the output */
+    output_pointer = ensure(output_buffer, (size_t)length + sizeof(""));
+    if (output_pointer == NULL)
+    {
+        return false;
+    }
+
+    memcpy(output_pointer, number_buffer, (size_t)length + sizeof(""));
+    output_buffer->offset += (size_t)length;
+
+    return true;
+}
+
+/* parse 4 digit hexadecimal number */
+static unsigned parse_hex4(const unsigned char * const input)
+{
+    unsigned int h = 0;
+    size_t i = 0;
+
+    for (i = 0; i < 4; i++)
+    {
+        /* parse digit */
+        if ((input[i] >= '0') && (input[i] <= '9'))
+        {
+            h += (unsigned int) input[i] - '0';
+        }
+        else if ((input[i] >= 'A') && (input[i] <= 'F'))
+        {
+            h += (unsigned int) 10 + input[i] - 'A';
+        }
+        else if ((input[i] >= 'a') && (input[i] <= 'f'))
+        {
+            h += (unsigned int) 10 + input[i] - 'a';
+        }
+        else /* invalid */
+        {
+            return 0;
+        }
+
+        if (i < 3)
+        {
+            /* shift left to make place for the next nibble */
+            h = h << 4;
+        }
+    }
+
+    return h;
+}
+
+/* converts a UTF-16 literal to UTF-8
+ * A literal can be one or two sequences of the form \uXXXX */
+static unsigned char utf16_literal_to_utf8(const unsigned char * const input_pointer, const unsigned char * const input_end, unsigned char **output_pointer)
+{
+    long unsigned int codepoint = 0;
+    unsigned int first_code = 0;
+    const unsigned char *first_sequence = input_pointer;
+    unsigned char utf8_length = 0;
+    unsigned char utf8_position = 0;
+    unsigned char sequence_length = 0;
+    unsigned char first_byte_mark = 0;
+
+    if ((input_end - first_sequence) < 6)
+    {
+        /* input ends unexpectedly */
+        goto fail;
+    }
+
+    /* get the first utf16 sequence */
+    first_code = parse_hex4(first_sequence + 2);
+
+    /* check that the code is valid */
+    if (((first_code >= 0xDC00) && (first_code <= 0xDFFF)))
+    {
+        goto fail;
+    }
+
+    /* UTF16 surrogate pair */
+    if ((first_code >= 0xD800) && (first_code <= 0xDBFF))
+    {
+        const unsigned char *second_sequence = first_sequence + 6;
+        unsigned int second_code = 0;
+        sequence_length = 12; /* \uXXXX\uXXXX */
+
+        if ((input_end - second_sequence) < 6)
+        {
+            /* input ends unexpectedly */
+            goto fail;
+        }
+
+        if ((second_sequence[0] != '\\') || (second_sequence[1] != 'u'))
+        {
+            /* missing second half of the surrogate pair */
+            goto fail;
+        }
+
+        /* get the second utf16 sequence */
+        second_code = parse_hex4(second_sequence + 2);
+        /* check that the code is valid */
+        if ((second_code < 0xDC00) || (second_code > 0xDFFF))
+        {
+            /* invalid second half of the surrogate pair */
+            goto fail;
+        }
+
+
+        /* calculate the unicode codepoint from the surrogate pair */
+        codepoint = 0x10000 + (((first_code & 0x3FF) << 10) | (second_code & 0x3FF));
+    }
+    else
+    {
+        sequence_length = 6; /* \uXXXX */
+        codepoint = first_code;
+    }
+
+    /* encode as UTF-8
+     * takes at maximum 4 bytes to encode:
+     * 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx */
+    if (codepoint < 0x80)
+    {
+        /* normal ascii, encoding 0xxxxxxx */
+        utf8_length = 1;
+    }
+    else if (codepoint < 0x800)
+    {
+        /* two bytes, encoding 110xxxxx 10xxxxxx */
+        utf8_length = 2;
+        first_byte_mark = 0xC0; /* 11000000 */
+    }
+    else if (codepoint < 0x10000)
+    {
+        /* three bytes, encoding 1110xxxx 10xxxxxx 10xxxxxx */
+        utf8_length = 3;
+        first_byte_mark = 0xE0; /* 11100000 */
+    }
+    else if (codepoint <= 0x10FFFF)
+    {
+        /* four bytes, encoding 1110xxxx 10xxxxxx 10xxxxxx 10xxxxxx */
+        utf8_length = 4;
+        first_byte_mark = 0xF0; /* 11110000 */
+    }
+    else
+    {
+        /* invalid unicode codepoint */
+        goto fail;
+    }
+
+    /* encode as utf8 */
+    for (utf8_position = (unsigned char)(utf8_length - 1); utf8_position > 0; utf8_position--)
+    {
+        /* 10xxxxxx */
+        (*output_pointer)[utf8_position] = (unsigned char)((codepoint | 0x80) & 0xBF);
+        codepoint >>= 6;
+    }
+    /* encode first byte */
+    if (utf8_length > 1)
+    {
+        (*output_pointer)[0] = (unsigned char)((codepoint | first_byte_mark) & 0xFF);
+    }
+    else
+    {
+        (*output_pointer)[0] = (unsigned char)(codepoint & 0x7F);
+    }
+
+    *output_pointer += utf8_length;
+
+    return sequence_length;
+
+fail:
+    return 0;
+}
+
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+/* index of the lowest set bit, mask must not be 0 */
+static unsigned int lowest_set_bit(unsigned int mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long position = 0;
+    _BitScanForward(&position, mask);
+    return (unsigned int)position;
+#else
+    unsigned int position = 0;
+    while (!(mask & 1))
+    {
+        mask >>= 1;
+        position++;
+    }
+    return position;
+#endif
+}
+#endif
+
+#if defined(CJSON_SIMD_NEON)
+/* NEON has no movemask, narrow each 0x00/0xFF byte of the comparison to a nibble instead
+ * and return the byte index of the first match, or 16 if there is none */
+static unsigned int neon_first_match(const uint8x16_t matches)
+{
+    const uint32x2_t nibbles = vreinterpret_u32_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4));
+    const unsigned int low = (unsigned int)vget_lane_u32(nibbles, 0);
+    const unsigned int high = (unsigned int)vget_lane_u32(nibbles, 1);
+
+    if (low != 0)
+    {
+        return lowest_set_bit(low) >> 2;
+    }
+    if (high != 0)
+    {
+        return 8 + (lowest_set_bit(high) >> 2);
+    }
+
+    return 16;
+}
+#endif
+
+/* count the leading bytes of input that buffer_skip_whitespace skips (everything <= 32) */
+static size_t whitespace_length(const unsigned char * const input, const size_t length)
+{
+    size_t position = 0;
+
+    /* tokens mostly follow each other directly or after a single space */
+    if ((length == 0) || (input[0] > 32))
+    {
+        return 0;
+    }
+    if ((length == 1) || (input[1] > 32))
+    {
+        return 1;
+    }
+
+#if defined(CJSON_SIMD_AVX2)
+    for (; (position + 32) <= length; position += 32)
+    {
+        const __m256i limit = _mm256_set1_epi8(32);
+        const __m256i chunk = _mm256_loadu_si256((const __m256i*)(const void*)(input + position));
+        const unsigned int blank = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, limit), limit));
+        if (blank != 0xFFFFFFFFu)
+        {
+            return position + lowest_set_bit(~blank);
+        }
+    }
+#elif defined(CJSON_SIMD_SSE2)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const __m128i limit = _mm_set1_epi8(32);
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)(const void*)(input + position));
+        const unsigned int blank = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(chunk, limit), limit));
+        if (blank != 0xFFFFu)
+        {
+            return position + lowest_set_bit(~blank & 0xFFFFu);
+        }
+    }
+#elif defined(CJSON_SIMD_NEON)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const unsigned int first = neon_first_match(vcgtq_u8(vld1q_u8(input + position), vdupq_n_u8(32)));
+        if (first < 16)
+        {
+            return position + first;
+        }
+    }
+#endif
+
+    while ((position < length) && (input[position] <= 32))
+    {
+        position++;
+    }
+
+    return position;
+}
+
+/* count the leading bytes of input up to the first '\"' or '\\' */
+static size_t string_span_length(const unsigned char * const input, const size_t length)
+{
+    size_t position = 0;
+
+#if defined(CJSON_SIMD_AVX2)
+    for (; (position + 32) <= length; position += 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256((const __m256i*)(const void*)(input + position));
+        const __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\"')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+        const unsigned int matches = (unsigned int)_mm256_movemask_epi8(special);
+        if (matches != 0)
+        {
+            return position + lowest_set_bit(matches);
+        }
+    }
+#elif defined(CJSON_SIMD_SSE2)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)(const void*)(input + position));
+        const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+        const unsigned int matches = (unsigned int)_mm_movemask_epi8(special);
+        if (matches != 0)
+        {
+            return position + lowest_set_bit(matches);
+        }
+    }
+#elif defined(CJSON_SIMD_NEON)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const uint8x16_t chunk = vld1q_u8(input + position);
+        const uint8x16_t special = vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\"')), vceqq_u8(chunk, vdupq_n_u8('\\')));
+        const unsigned int first = neon_first_match(special);
+        if (first < 16)
+        {
+            return position + first;
+        }
+    }
+#endif
+
+    while ((position < length) && (input[position] != '\"') && (input[position] != '\\'))
+    {
+        position++;
+    }
+
+    return position;
+}
+
+/* count the leading bytes of input that are ASCII */
+static size_t ascii_length(const unsigned char * const input, const size_t length)
+{
+    size_t position = 0;
+
+#if defined(CJSON_SIMD_AVX2)
+    for (; (position + 32) <= length; position += 32)
+    {
+        const unsigned int high = (unsigned int)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(input + position)));
+        if (high != 0)
+        {
+            return position + lowest_set_bit(high);
+        }
+    }
+#elif defined(CJSON_SIMD_SSE2)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const unsigned int high = (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(const void*)(input + position)));
+        if (high != 0)
+        {
+            return position + lowest_set_bit(high);
+        }
+    }
+#elif defined(CJSON_SIMD_NEON)
+    for (; (position + 16) <= length; position += 16)
+    {
+        const unsigned int first = neon_first_match(vtstq_u8(vld1q_u8(input + position), vdupq_n_u8(0x80)));
+        if (first < 16)
+        {
+            return position + first;
+        }
+    }
+#endif
+
+    while ((position < length) && (input[position] < 0x80))
+    {
+        position++;
+    }
+
+    return position;
+}
+
+/* length of the UTF-8 sequence input starts with, 0 if it is malformed, truncated, overlong,
+ * a surrogate or above U+10FFFF */
+static size_t utf8_sequence_length(const unsigned char * const input, const size_t length)
+{
+    const unsigned char lead = input[0];
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    size_t sequence_length = 0;
+    size_t i = 0;
+
+    if (lead < 0x80)
+    {
+        return 1;
+    }
+    else if (lead < 0xC2)
+    {
+        /* continuation byte or overlong two byte sequence */
+        return 0;
+    }
+    else if (lead < 0xE0)
+    {
+        sequence_length = 2;
+    }
+    else if (lead < 0xF0)
+    {
+        sequence_length = 3;
+        if (lead == 0xE0)
+        {
+            low = 0xA0; /* overlong */
+        }
+        else if (lead == 0xED)
+        {
+            high = 0x9F; /* surrogates */
+        }
+    }
+    else if (lead < 0xF5)
+    {
+        sequence_length = 4;
+        if (lead == 0xF0)
+        {
+            low = 0x90; /* overlong */
+        }
+        else if (lead == 0xF4)
+        {
+            high = 0x8F; /* above U+10FFFF */
+        }
+    }
+    else
+    {
+        return 0;
+    }
+
+    if ((length < sequence_length) || (input[1] < low) || (input[1] > high))
+    {
+        return 0;
+    }
+    for (i = 2; i < sequence_length; i++)
+    {
+        if ((input[i] & 0xC0) != 0x80)
+        {
+            return 0;
+        }
+    }
+
+    return sequence_length;
+}
+
+/* count the leading bytes of input that are valid UTF-8, runs of ASCII are skipped a vector at a time */
+static size_t utf8_valid_length(const unsigned char * const input, const size_t length)
+{
+    size_t position = 0;
+
+    while (position < length)
+    {
+        size_t sequence_length = 0;
+
+        position += ascii_length(input + position, length - position);
+        if (position == length)
+        {
+            break;
+        }
+
+        sequence_length = utf8_sequence_length(input + position, length - position);
+        if (sequence_length == 0)
+        {
+            break;
+        }
+        position += sequence_length;
+    }
+
+    return position;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_IsValidUTF8(const char *data, size_t length)
+{
+    if ((data == NULL) && (length > 0))
+    {
+        return false;
+    }
+
+    return utf8_valid_length((const unsigned char*)data, length) == length;
+}
+
+/* Parse the input text into an unescaped cinput, and populate item. */
+static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_buffer)
+{
+    const unsigned char *input_pointer = buffer_at_offset(input_buffer) + 1;
+    const unsigned char *input_end = buffer_at_offset(input_buffer) + 1;
+    const unsigned char *const buffer_end = input_buffer->content + input_buffer->length;
+    unsigned char *output_pointer = NULL;
+    unsigned char *output = NULL;
+    size_t skipped_bytes = 0;
+
+    /* not a string */
+    if (buffer_at_offset(input_buffer)[0] != '\"')
+    {
+        goto fail;
+    }
+
+    {
+        /* calculate approximate size of the output (overestimate) */
+        size_t allocation_length = 0;
+        for (;;)
+        {
+            /* jump to the next quote or escape sequence */
+            input_end += string_span_length(input_end, (size_t)(buffer_end - input_end));
+            if (input_end >= buffer_end)
+            {
+                goto fail; /* string ended unexpectedly */
+            }
+            if (*input_end == '\"')
+            {
+                break;
+            }
+
+            /* is escape sequence */
+            if ((input_end + 1) >= buffer_end)
+            {
+                /* prevent buffer overflow when last input character is a backslash */
+                goto fail;
+            }
+            skipped_bytes++;
+            input_end += 2;
+        }
+
+        if (input_buffer->in_place)
+        {
+            /* decoding never makes a string longer, the closing quote is replaced by the terminator */
+            output = (unsigned char*)cast_away_const(input_pointer);
+        }
+        else
+        {
+            /* This is at most how much we need for the output */
+            allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
+            if (input_buffer->temporary_strings)
+            {
+                output = (unsigned char*)allocate_string(allocation_length + sizeof(""), &input_buffer->hooks);
+            }
+            else
+            {
+                output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
+            }
+            if (output == NULL)
+            {
+                goto fail; /* allocation failure */
+            }
+        }
+    }
+
+    output_pointer = output;
+    if (skipped_bytes == 0)
+    {
+        /* no escape sequences, copy the string in one go */
+        if (!input_buffer->in_place)
+        {
+            memcpy(output_pointer, input_pointer, (size_t)(input_end - input_pointer));
+        }
+        output_pointer += input_end - input_pointer;
+        input_pointer = input_end;
+    }
+    /* loop through the string literal */
+    while (input_pointer < input_end)
+    {
+        if (*input_pointer != '\\')
+        {
+            /* copy everything up to the next escape sequence */
+            size_t run_length = 1 + string_span_length(input_pointer + 1, (size_t)(input_end - input_pointer - 1));
+            /* overlaps when decoding in place */
+            memmove(output_pointer, input_pointer, run_length);
+            output_pointer += run_length;
+            input_pointer += run_length;
+        }
+        /* escape sequence */
+        else
+        {
+            unsigned char sequence_length = 2;
+            if ((input_end - input_pointer) < 1)
+            {
+                goto fail;
+            }
+
+            switch (input_pointer[1])
+            {
+                case 'b':
+                    *output_pointer++ = '\b';
+                    break;
+                case 'f':
+                    *output_pointer++ = '\f';
+                    break;
+                case 'n':
+                    *output_pointer++ = '\n';
+                    break;
+                case 'r':
+                    *output_pointer++ = '\r';
+                    break;
+                case 't':
+                    *output_pointer++ = '\t';
+                    break;
+                case '\"':
+                case '\\':
+                case '/':
+                    *output_pointer++ = input_pointer[1];
+                    break;
+
+                /* UTF-16 literal */
+                case 'u':
+                    sequence_length = utf16_literal_to_utf8(input_pointer, input_end, &output_pointer);
+                    if (sequence_length == 0)
+                    {
+                        /* failed to convert UTF16-literal to UTF-8 */
+                        goto fail;
+                    }
+                    break;
+
+                default:
+                    goto fail;
+            }
+            input_pointer += sequence_length;
+        }
+    }
+
+    /* zero terminate the output */
+    *output_pointer = '\0';
+
+    item->type = input_buffer->in_place ? (cJSON_String | cJSON_IsReference) : cJSON_String;
+    item->valuestring = (char*)output;
+
+    input_buffer->offset = (size_t) (input_end - input_buffer->content);
+    input_buffer->offset++;
+
+    return true;
+
+fail:
+    if ((output != NULL) && !input_buffer->in_place)
+    {
+        input_buffer->hooks.deallocate(output);
+        output = NULL;
+    }
+
+    if (input_pointer != NULL)
+    {
+        input_buffer->offset = (size_t)(input_pointer - input_buffer->content);
+    }
+
+    return false;
+}
+
+/* Render the cstring provided to an escaped version that can be printed. */
+static cJSON_bool print_string_ptr(const unsigned char * const input, printbuffer * const output_buffer)
+{
+    const unsigned char *input_pointer = NULL;
+    unsigned char *output = NULL;
+    unsigned char *output_pointer = NULL;
+    size_t output_length = 0;
+    /* numbers of additional characters needed for escaping */
+    size_t escape_characters = 0;
+
+    if (output_buffer == NULL)
+    {
+        return false;
+    }
+
+    /* empty string */
+    if (input == NULL)
+    {
+        output = ensure(output_buffer, sizeof("\"\""));
+        if (output == NULL)
+        {
+            return false;
+        }
+        strcpy((char*)output, "\"\"");
+
+        return true;
+    }
+
+    /* set "flag" to 1 if something needs to be escaped */
+    for (input_pointer = input; *input_pointer; input_pointer++)
+    {
+        switch (*input_pointer)
+        {
+            case '\"':
+            case '\\':
+            case '\b':
+            case '\f':
+            case '\n':
+            case '\r':
+            case '\t':
+                /* one character escape sequence */
+                escape_characters++;
+                break;
+            default:
+                if (*input_pointer < 32)
+                {
+                    /* UTF-16 escape sequence uXXXX */
+                    escape_characters += 5;
+                }
+                break;
+        }
+    }
+    output_length = (size_t)(input_pointer - input) + escape_characters;
+
+    output = ensure(output_buffer, output_length + sizeof("\"\""));
+    if (output == NULL)
+    {
+        return false;
+    }
+
+    /* no characters have to be escaped */
+    if (escape_characters == 0)
+    {
+        output[0] = '\"';
+        memcpy(output + 1, input, output_length);
+        output[output_length + 1] = '\"';
+        output[output_length + 2] = '\0';
+
+        return true;
+    }
+
+    output[0] = '\"';
+    output_pointer = output + 1;
+    /* copy the string */
+    for (input_pointer = input; *input_pointer != '\0'; (void)input_pointer++, output_pointer++)
+    {
+        if ((*input_pointer > 31) && (*input_pointer != '\"') && (*input_pointer != '\\'))
+        {
+            /* normal character, copy */
+            *output_pointer = *input_pointer;
+        }
+        else
+        {
+            /* character needs to be escaped */
+            *output_pointer++ = '\\';
             switch (*input_pointer)
             {
-                case '\\':
-                    *output_pointer = '\\';
-                    break;
-                case '\"':
-                    *output_pointer = '\"';
-                    break;
-                case '\b':
-                    *output_pointer = 'b';
-                    break;
-                case '\f':
-                    *output_pointer = 'f';
-                    break;
-                case '\n':
-                    *output_pointer = 'n';
-                    break;
-                case '\r':
-                    *output_pointer = 'r';
-                    break;
-                case '\t':
-                    *output_pointer = 't';
-                    break;
-                default:
-                    /* escape and print as unicode codepoint */
-                    sprintf((char*)output_pointer, "u%04x", *input_pointer);
-                    output_pointer += 4;
-                    break;
+                case '\\':
+                    *output_pointer = '\\';
+                    break;
+                case '\"':
+                    *output_pointer = '\"';
+                    break;
+                case '\b':
+                    *output_pointer = 'b';
+                    break;
+                case '\f':
+                    *output_pointer = 'f';
+                    break;
+                case '\n':
+                    *output_pointer = 'n';
+                    break;
+                case '\r':
+                    *output_pointer = 'r';
+                    break;
+                case '\t':
+                    *output_pointer = 't';
+                    break;
+                default:
+                    /* escape and print as unicode codepoint */
+                    sprintf((char*)output_pointer, "u%04x", *input_pointer);
+                    output_pointer += 4;
+                    break;
+            }
+        }
+    }
+    output[output_length + 1] = '\"';
+    output[output_length + 2] = '\0';
+
+    return true;
+}
+
+/* Invoke print_string_ptr (which is useful) on an item. */
+static cJSON_bool print_string(const cJSON * const item, printbuffer * const p)
+{
+    return print_string_ptr((unsigned char*)item->valuestring, p);
+}
+
+/* Predeclare these prototypes. */
+static cJSON_bool parse_value(cJSON * const item, parse_buffer * const input_buffer);
+static cJSON_bool print_value(const cJSON * const item, printbuffer * const output_buffer);
+
+/* Utility to jump whitespace and cr/lf */
+static parse_buffer *buffer_skip_whitespace(parse_buffer * const buffer)
+{
+    if ((buffer == NULL) || (buffer->content == NULL))
+    {
+        return NULL;
+    }
+
+    if (cannot_access_at_index(buffer, 0))
+    {
+        return buffer;
+    }
+
+    buffer->offset += whitespace_length(buffer_at_offset(buffer), buffer->length - buffer->offset);
+
+    if (buffer->offset == buffer->length)
+    {
+        buffer->offset--;
+    }
+
+    return buffer;
+}
+
+/* skip the UTF-8 BOM (byte order mark) if it is at the beginning of a buffer */
+static parse_buffer *skip_utf8_bom(parse_buffer * const buffer)
+{
+    if ((buffer == NULL) || (buffer->content == NULL) || (buffer->offset != 0))
+    {
+        return NULL;
+    }
+
+    if (can_access_at_index(buffer, 4) && (strncmp((const char*)buffer_at_offset(buffer), "\xEF\xBB\xBF", 3) == 0))
+    {
+        buffer->offset += 3;
+    }
+
+    return buffer;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    size_t buffer_length;
+
+    if (NULL == value)
+    {
+        return NULL;
+    }
+
+    /* Adding null character size due to require_null_terminated. */
+    buffer_length = strlen(value) + sizeof("");
+
+    return cJSON_ParseWithLengthOpts(value, buffer_length, return_parse_end, require_null_terminated);
+}
+
+/* Parse an object - create a new root, and populate. */
+static cJSON *parse_root(cJSON_Context * const context, const char * const value, const size_t buffer_length, const char ** const return_parse_end, const cJSON_bool require_null_terminated, const cJSON_bool in_place)
+{
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
+    cJSON *item = NULL;
+
+    /* reset error position */
+    context->last_error.json = NULL;
+    context->last_error.position = 0;
+
+    if (value == NULL || 0 == buffer_length)
+    {
+        goto fail;
+    }
+
+    buffer.content = (const unsigned char*)value;
+    buffer.length = buffer_length;
+    buffer.offset = 0;
+    buffer.hooks = context->hooks;
+    buffer.in_place = in_place;
+    buffer.nesting_limit = context->nesting_limit;
+    if ((context->options & cJSON_InternKeys) && (context != &global_context))
+    {
+        buffer.keys = &context->keys;
+    }
+
+    item = cJSON_New_Item(&context->hooks);
+    if (item == NULL) /* memory fail */
+    {
+        goto fail;
+    }
+
+    if (!parse_value(item, buffer_skip_whitespace(skip_utf8_bom(&buffer))))
+    {
+        /* parse failure. ep is set. */
+        goto fail;
+    }
+
+    /* if we require null-terminated JSON without appended garbage, skip and then check for a null terminator */
+    if (require_null_terminated)
+    {
+        buffer_skip_whitespace(&buffer);
+        if ((buffer.offset >= buffer.length) || buffer_at_offset(&buffer)[0] != '\0')
+        {
+            goto fail;
+        }
+    }
+
+    /* escape sequences were checked while parsing, the raw bytes of the text are checked here */
+    if (context->options & cJSON_ValidateUTF8)
+    {
+        const size_t valid_length = utf8_valid_length(buffer.content, buffer.offset);
+        if (valid_length < buffer.offset)
+        {
+            buffer.offset = valid_length;
+            goto fail;
+        }
+    }
+
+    if (return_parse_end)
+    {
+        *return_parse_end = (const char*)buffer_at_offset(&buffer);
+    }
+
+    return item;
+
+fail:
+    if (item != NULL)
+    {
+        delete_item(item, &context->hooks);
+    }
+
+    if (value != NULL)
+    {
+        error local_error;
+        local_error.json = (const unsigned char*)value;
+        local_error.position = 0;
+
+        if (buffer.offset < buffer.length)
+        {
+            local_error.position = buffer.offset;
+        }
+        else if (buffer.length > 0)
+        {
+            local_error.position = buffer.length - 1;
+        }
+
+        if (return_parse_end != NULL)
+        {
+            *return_parse_end = (const char*)local_error.json + local_error.position;
+        }
+
+        context->last_error = local_error;
+    }
+
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    return parse_root(&global_context, value, buffer_length, return_parse_end, require_null_terminated, false);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOptsCtx(cJSON_Context *context, const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    if (context == NULL)
+    {
+        return NULL;
+    }
+
+    return parse_root(context, value, buffer_length, return_parse_end, require_null_terminated, false);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseCtx(cJSON_Context *context, const char *value)
+{
+    if ((context == NULL) || (value == NULL))
+    {
+        return NULL;
+    }
+
+    /* Adding null character size due to require_null_terminated. */
+    return parse_root(context, value, strlen(value) + sizeof(""), NULL, (context->options & cJSON_RequireNullTerminated) != 0, false);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthCtx(cJSON_Context *context, const char *value, size_t buffer_length)
+{
+    if (context == NULL)
+    {
+        return NULL;
+    }
+
+    return parse_root(context, value, buffer_length, NULL, (context->options & cJSON_RequireNullTerminated) != 0, false);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInPlace(char *value)
+{
+    if (value == NULL)
+    {
+        return NULL;
+    }
+
+    return parse_root(&global_context, value, strlen(value) + sizeof(""), NULL, false, true);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInPlaceWithLength(char *value, size_t buffer_length)
+{
+    return parse_root(&global_context, value, buffer_length, NULL, false, true);
+}
+
+/* Default options for cJSON_Parse */
+CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
+{
+    return cJSON_ParseWithOpts(value, 0, 0);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLength(const char *value, size_t buffer_length)
+{
+    return cJSON_ParseWithLengthOpts(value, buffer_length, 0, 0);
+}
+
+#define cjson_min(a, b) (((a) < (b)) ? (a) : (b))
+
+static unsigned char *print(const cJSON * const item, cJSON_bool format, const internal_hooks * const hooks)
+{
+    static const size_t default_buffer_size = 256;
+    printbuffer buffer[1];
+    unsigned char *printed = NULL;
+
+    memset(buffer, 0, sizeof(buffer));
+
+    /* create buffer */
+    buffer->buffer = (unsigned char*) hooks->allocate(default_buffer_size);
+    buffer->length = default_buffer_size;
+    buffer->format = format;
+    buffer->hooks = *hooks;
+    if (buffer->buffer == NULL)
+    {
+        goto fail;
+    }
+
+    /* print the value */
+    if (!print_value(item, buffer))
+    {
+        goto fail;
+    }
+    update_offset(buffer);
+
+    /* check if reallocate is available */
+    if (hooks->reallocate != NULL)
+    {
+        printed = (unsigned char*) hooks->reallocate(buffer->buffer, buffer->offset + 1);
+        if (printed == NULL) {
+            goto fail;
+        }
+        buffer->buffer = NULL;
+    }
+    else /* otherwise copy the JSON over to a new buffer */
+    {
+        printed = (unsigned char*) hooks->allocate(buffer->offset + 1);
+        if (printed == NULL)
+        {
+            goto fail;
+        }
+        memcpy(printed, buffer->buffer, cjson_min(buffer->length, buffer->offset + 1));
+        printed[buffer->offset] = '\0'; /* just to be sure */
+
+        /* free the buffer */
+        hooks->deallocate(buffer->buffer);
+        buffer->buffer = NULL;
+    }
+
+    return printed;
+
+fail:
+    if (buffer->buffer != NULL)
+    {
+        hooks->deallocate(buffer->buffer);
+        buffer->buffer = NULL;
+    }
+
+    if (printed != NULL)
+    {
+        hooks->deallocate(printed);
+        printed = NULL;
+    }
+
+    return NULL;
+}
+
+/* Render a cJSON item/entity/structure to text. */
+CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item)
+{
+    return (char*)print(item, true, &global_hooks);
+}
+
+CJSON_PUBLIC(char *) cJSON_PrintUnformatted(const cJSON *item)
+{
+    return (char*)print(item, false, &global_hooks);
+}
+
+static char *print_buffered(const cJSON * const item, const int prebuffer, const cJSON_bool fmt, const internal_hooks * const hooks)
+{
+    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 }, 0, 0 };
+
+    if (prebuffer < 0)
+    {
+        return NULL;
+    }
+
+    p.buffer = (unsigned char*)hooks->allocate((size_t)prebuffer);
+    if (!p.buffer)
+    {
+        return NULL;
+    }
+
+    p.length = (size_t)prebuffer;
+    p.offset = 0;
+    p.noalloc = false;
+    p.format = fmt;
+    p.hooks = *hooks;
+
+    if (!print_value(item, &p))
+    {
+        hooks->deallocate(p.buffer);
+        p.buffer = NULL;
+        return NULL;
+    }
+
+    return (char*)p.buffer;
+}
+
+CJSON_PUBLIC(char *) cJSON_PrintBuffered(const cJSON *item, int prebuffer, cJSON_bool fmt)
+{
+    return print_buffered(item, prebuffer, fmt, &global_hooks);
+}
+
+CJSON_PUBLIC(char *) cJSON_PrintCtx(cJSON_Context *context, const cJSON *item)
+{
+    return (context != NULL) ? (char*)print(item, true, &context->hooks) : NULL;
+}
+
+CJSON_PUBLIC(char *) cJSON_PrintUnformattedCtx(cJSON_Context *context, const cJSON *item)
+{
+    return (context != NULL) ? (char*)print(item, false, &context->hooks) : NULL;
+}
+
+CJSON_PUBLIC(char *) cJSON_PrintBufferedCtx(cJSON_Context *context, const cJSON *item, int prebuffer, cJSON_bool fmt)
+{
+    return (context != NULL) ? print_buffered(item, prebuffer, fmt, &context->hooks) : NULL;
+}
+
+static cJSON_bool print_streamed(const cJSON * const item, const cJSON_bool format, size_t chunk_size, cJSON_WriteCallback writer, void *user_data, const internal_hooks * const hooks)
+{
+    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 }, 0, 0 };
+    cJSON_bool success = false;
+
+    if ((item == NULL) || (writer == NULL))
+    {
+        return false;
+    }
+
+    if (chunk_size == 0)
+    {
+        chunk_size = CJSON_PRINT_CHUNK_SIZE;
+    }
+
+    p.buffer = (unsigned char*)hooks->allocate(chunk_size);
+    if (p.buffer == NULL)
+    {
+        return false;
+    }
+
+    p.length = chunk_size;
+    p.format = format;
+    p.hooks = *hooks;
+    p.writer = writer;
+    p.writer_data = user_data;
+
+    if (print_value(item, &p))
+    {
+        update_offset(&p);
+        success = flush_printbuffer(&p);
+    }
+
+    /* ensure frees the buffer when growing it fails */
+    if (p.buffer != NULL)
+    {
+        hooks->deallocate(p.buffer);
+    }
+
+    return success;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToCallback(const cJSON *item, cJSON_bool format, size_t chunk_size, cJSON_WriteCallback writer, void *user_data)
+{
+    return print_streamed(item, format, chunk_size, writer, user_data, &global_hooks);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToCallbackCtx(cJSON_Context *context, const cJSON *item, cJSON_bool format, size_t chunk_size, cJSON_WriteCallback writer, void *user_data)
+{
+    return (context != NULL) ? print_streamed(item, format, chunk_size, writer, user_data, &context->hooks) : false;
+}
+
+static cJSON_bool write_to_file(void *user_data, const char *data, size_t length)
+{
+    return fwrite(data, 1, length, (FILE*)user_data) == length;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToFile(const cJSON *item, FILE *file, cJSON_bool format)
+{
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    return print_streamed(item, format, CJSON_PRINT_CHUNK_SIZE, write_to_file, file, &global_hooks);
+}
+
+static cJSON_bool write_to_fd(void *user_data, const char *data, size_t length)
+{
+    const int fd = *(const int*)user_data;
+
+    while (length > 0)
+    {
+#if defined(_WIN32)
+        int written = _write(fd, data, (length > INT_MAX) ? INT_MAX : (unsigned int)length);
+#else
+        ssize_t written = write(fd, data, length);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+
+    return true;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToFileDescriptor(const cJSON *item, int fd, cJSON_bool format)
+{
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    return print_streamed(item, format, CJSON_PRINT_CHUNK_SIZE, write_to_fd, &fd, &global_hooks);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintPreallocated(cJSON *item, char *buffer, const int length, const cJSON_bool format)
+{
+    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 }, 0, 0 };
+
+    if ((length < 0) || (buffer == NULL))
+    {
+        return false;
+    }
+
+    p.buffer = (unsigned char*)buffer;
+    p.length = (size_t)length;
+    p.offset = 0;
+    p.noalloc = true;
+    p.format = format;
+    p.hooks = global_hooks;
+
+    return print_value(item, &p);
+}
+
+/* Parse a value that isn't an array or object. */
+static cJSON_bool parse_scalar(cJSON * const item, parse_buffer * const input_buffer)
+{
+    /* parse the different types of values */
+    /* null */
+    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "null", 4) == 0))
+    {
+        item->type = cJSON_NULL;
+        input_buffer->offset += 4;
+        return true;
+    }
+    /* false */
+    if (can_read(input_buffer, 5) && (strncmp((const char*)buffer_at_offset(input_buffer), "false", 5) == 0))
+    {
+        item->type = cJSON_False;
+        input_buffer->offset += 5;
+        return true;
+    }
+    /* true */
+    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "true", 4) == 0))
+    {
+        item->type = cJSON_True;
+        item->valueint = 1;
+        input_buffer->offset += 4;
+        return true;
+    }
+    /* string */
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '\"'))
+    {
+        return parse_string(item, input_buffer);
+    }
+    /* number */
+    if (can_access_at_index(input_buffer, 0) && ((buffer_at_offset(input_buffer)[0] == '-') || ((buffer_at_offset(input_buffer)[0] >= '0') && (buffer_at_offset(input_buffer)[0] <= '9'))))
+    {
+        return parse_number(item, input_buffer);
+    }
+    return false;
+}
+
+/* Render a value that isn't an array or object to text. */
+static cJSON_bool print_scalar(const cJSON * const item, printbuffer * const output_buffer)
+{
+    unsigned char *output = NULL;
+
+    switch ((item->type) & 0xFF)
+    {
+        case cJSON_NULL:
+            output = ensure(output_buffer, 5);
+            if (output == NULL)
+            {
+                return false;
+            }
+            strcpy((char*)output, "null");
+            return true;
+
+        case cJSON_False:
+            output = ensure(output_buffer, 6);
+            if (output == NULL)
+            {
+                return false;
+            }
+            strcpy((char*)output, "false");
+            return true;
+
+        case cJSON_True:
+            output = ensure(output_buffer, 5);
+            if (output == NULL)
+            {
+                return false;
+            }
+            strcpy((char*)output, "true");
+            return true;
+
+        case cJSON_Number:
+            return print_number(item, output_buffer);
+
+        case cJSON_Raw:
+        {
+            size_t raw_length = 0;
+            if (item->valuestring == NULL)
+            {
+                return false;
+            }
+
+            raw_length = strlen(item->valuestring) + sizeof("");
+            output = ensure(output_buffer, raw_length);
+            if (output == NULL)
+            {
+                return false;
+            }
+            memcpy(output, item->valuestring, raw_length);
+            return true;
+        }
+
+        case cJSON_String:
+            return print_string(item, output_buffer);
+
+        default:
+            return false;
+    }
+}
+
+/* Parse the name of an object member straight into the key table. Names without escape sequences
+ * are looked up in the input and cost no allocation. */
+static cJSON_bool parse_interned_key(cJSON * const item, parse_buffer * const input_buffer)
+{
+    const unsigned char *name = NULL;
+    size_t length = 0;
+
+    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != '\"'))
+    {
+        return false;
+    }
+
+    name = buffer_at_offset(input_buffer) + 1;
+    length = string_span_length(name, input_buffer->length - input_buffer->offset - 1);
+    if (can_access_at_index(input_buffer, length + 1) && (name[length] == '\"'))
+    {
+        item->string = intern_key(input_buffer->keys, &input_buffer->hooks, name, length);
+        input_buffer->offset += length + 2;
+    }
+    else
+    {
+        char *decoded = NULL;
+        cJSON_bool parsed = false;
+
+        input_buffer->temporary_strings = true;
+        parsed = parse_string(item, input_buffer);
+        input_buffer->temporary_strings = false;
+        if (!parsed)
+        {
+            return false;
+        }
+        decoded = item->valuestring;
+        item->valuestring = NULL;
+        item->string = intern_key(input_buffer->keys, &input_buffer->hooks, (const unsigned char*)decoded, strlen(decoded));
+        free_string(decoded, &input_buffer->hooks);
+    }
+
+    return item->string != NULL;
+}
+
+/* double the capacity of an explicit stack, moving it off the C stack the first time */
+static void *grow_stack(void * const frames, const void * const inline_frames, size_t * const capacity, const size_t frame_size, const internal_hooks * const hooks)
+{
+    void *grown = NULL;
+
+    if (*capacity > ((size_t)-1 / 2 / frame_size))
+    {
+        return NULL;
+    }
+
+    grown = hooks->allocate(*capacity * 2 * frame_size);
+    if (grown == NULL)
+    {
+        return NULL;
+    }
+    memcpy(grown, frames, *capacity * frame_size);
+    if (frames != inline_frames)
+    {
+        hooks->deallocate(frames);
+    }
+    *capacity *= 2;
+
+    return grown;
+}
+
+/* Parser core - when encountering text, process appropriately.
+ * Arrays and objects don't recurse: the open ones are kept on an explicit stack, so the C stack
+ * use doesn't depend on how deeply the input is nested. Children are attached as soon as they
+ * are allocated, so the caller frees a partial result by deleting item. */
+static cJSON_bool parse_value(cJSON * const item, parse_buffer * const input_buffer)
+{
+    cJSON *inline_frames[CJSON_STACK_FRAMES];
+    cJSON **frames = inline_frames; /* the open arrays and objects, innermost last */
+    size_t capacity = sizeof(inline_frames) / sizeof(inline_frames[0]);
+    size_t count = 0;
+    cJSON *current = item;
+    cJSON *container = NULL;
+    cJSON_bool success = false;
+    unsigned char opener = '\0';
+
+    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    {
+        return false; /* no input */
+    }
+
+value:
+    opener = can_access_at_index(input_buffer, 0) ? buffer_at_offset(input_buffer)[0] : '\0';
+    if ((opener != '[') && (opener != '{'))
+    {
+        if (!parse_scalar(current, input_buffer))
+        {
+            goto fail;
+        }
+        goto value_done;
+    }
+
+    if (input_buffer->depth >= input_buffer->nesting_limit)
+    {
+        goto fail; /* to deeply nested */
+    }
+    input_buffer->depth++;
+
+    /* a const name has to survive setting the type */
+    current->type = ((opener == '[') ? cJSON_Array : cJSON_Object) | (current->type & (cJSON_StringIsConst | cJSON_StringIsBorrowed));
+
+    input_buffer->offset++;
+    buffer_skip_whitespace(input_buffer);
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ((opener == '[') ? ']' : '}')))
+    {
+        /* empty array or object */
+        goto close;
+    }
+
+    /* check if we skipped to the end of the buffer */
+    if (cannot_access_at_index(input_buffer, 0))
+    {
+        input_buffer->offset--;
+        goto fail;
+    }
+
+    /* step back to character in front of the first element */
+    input_buffer->offset--;
+
+    if (count == capacity)
+    {
+        cJSON **grown = (cJSON**)grow_stack(frames, inline_frames, &capacity, sizeof(cJSON*), &input_buffer->hooks);
+        if (grown == NULL)
+        {
+            goto fail;
+        }
+        frames = grown;
+    }
+    frames[count++] = current;
+
+element:
+    container = frames[count - 1];
+    current = cJSON_New_Item(&(input_buffer->hooks));
+    if (current == NULL)
+    {
+        goto fail; /* allocation failure */
+    }
+
+    /* attach next item to list, the head's prev points to the last child */
+    if (container->child == NULL)
+    {
+        container->child = current;
+    }
+    else
+    {
+        current->prev = container->child->prev;
+        container->child->prev->next = current;
+    }
+    container->child->prev = current;
+
+    if ((container->type & 0xFF) == cJSON_Object)
+    {
+        if (cannot_access_at_index(input_buffer, 1))
+        {
+            goto fail; /* nothing comes after the comma */
+        }
+
+        /* parse the name of the child */
+        input_buffer->offset++;
+        buffer_skip_whitespace(input_buffer);
+        if (input_buffer->keys != NULL)
+        {
+            if (!parse_interned_key(current, input_buffer))
+            {
+                goto fail; /* failed to parse name */
+            }
+        }
+        else
+        {
+            if (!parse_string(current, input_buffer))
+            {
+                goto fail; /* failed to parse name */
+            }
+
+            /* swap valuestring and string, because we parsed the name */
+            current->string = current->valuestring;
+            current->valuestring = NULL;
+        }
+        buffer_skip_whitespace(input_buffer);
+
+        if (input_buffer->in_place || (input_buffer->keys != NULL))
+        {
+            /* the name points into the input or the key table */
+            current->type = cJSON_StringIsConst | cJSON_StringIsBorrowed;
+        }
+
+        if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != ':'))
+        {
+            goto fail; /* invalid object */
+        }
+    }
+
+    /* parse the value */
+    input_buffer->offset++;
+    buffer_skip_whitespace(input_buffer);
+    goto value;
+
+value_done:
+    if (count == 0)
+    {
+        success = true;
+        goto end;
+    }
+
+    container = frames[count - 1];
+    if (((container->type & 0xFF) == cJSON_Object) && (input_buffer->in_place || (input_buffer->keys != NULL)))
+    {
+        current->type |= cJSON_StringIsConst | cJSON_StringIsBorrowed;
+    }
+
+    buffer_skip_whitespace(input_buffer);
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','))
+    {
+        goto element;
+    }
+
+    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != (((container->type & 0xFF) == cJSON_Array) ? ']' : '}')))
+    {
+        goto fail; /* expected end of array or object */
+    }
+    current = frames[--count];
+
+close:
+    input_buffer->depth--;
+    input_buffer->offset++;
+    goto value_done;
+
+fail:
+    success = false;
+
+end:
+    if (frames != inline_frames)
+    {
+        input_buffer->hooks.deallocate(frames);
+    }
+
+    return success;
+}
+
+/* an array or object print_value is inside of */
+typedef struct
+{
+    const cJSON *element; /* the child being printed */
+    cJSON_bool object;
+} print_frame;
+
+/* Render a value to text. Like parse_value, this keeps the open arrays and objects on an explicit stack. */
+static cJSON_bool print_value(const cJSON * const item, printbuffer * const output_buffer)
+{
+    print_frame inline_frames[CJSON_STACK_FRAMES];
+    print_frame *frames = inline_frames; /* innermost last */
+    size_t capacity = sizeof(inline_frames) / sizeof(inline_frames[0]);
+    size_t count = 0;
+    const cJSON *current = item;
+    unsigned char *output_pointer = NULL;
+    size_t length = 0;
+    size_t i = 0;
+    cJSON_bool object = false;
+    cJSON_bool success = false;
+
+    if ((item == NULL) || (output_buffer == NULL))
+    {
+        return false;
+    }
+
+value:
+    switch ((current->type) & 0xFF)
+    {
+        case cJSON_Array:
+            /* opening square bracket */
+            output_pointer = ensure(output_buffer, 1);
+            if (output_pointer == NULL)
+            {
+                goto end;
+            }
+            *output_pointer = '[';
+            output_buffer->offset++;
+            output_buffer->depth++;
+            object = false;
+            break;
+
+        case cJSON_Object:
+            length = (size_t) (output_buffer->format ? 2 : 1); /* fmt: {\n */
+            output_pointer = ensure(output_buffer, length + 1);
+            if (output_pointer == NULL)
+            {
+                goto end;
+            }
+            *output_pointer++ = '{';
+            output_buffer->depth++;
+            if (output_buffer->format)
+            {
+                *output_pointer++ = '\n';
+            }
+            output_buffer->offset += length;
+            object = true;
+            break;
+
+        default:
+            if (!print_scalar(current, output_buffer))
+            {
+                goto end;
+            }
+            goto value_done;
+    }
+
+    if (current->child == NULL)
+    {
+        goto close;
+    }
+
+    if (count == capacity)
+    {
+        print_frame *grown = (print_frame*)grow_stack(frames, inline_frames, &capacity, sizeof(print_frame), &output_buffer->hooks);
+        if (grown == NULL)
+        {
+            goto end;
+        }
+        frames = grown;
+    }
+    frames[count].element = current->child;
+    frames[count].object = object;
+    count++;
+
+element:
+    current = frames[count - 1].element;
+    if (frames[count - 1].object)
+    {
+        if (output_buffer->format)
+        {
+            output_pointer = ensure(output_buffer, output_buffer->depth);
+            if (output_pointer == NULL)
+            {
+                goto end;
+            }
+            for (i = 0; i < output_buffer->depth; i++)
+            {
+                *output_pointer++ = '\t';
+            }
+            output_buffer->offset += output_buffer->depth;
+        }
+
+        /* print key */
+        if (!print_string_ptr((unsigned char*)current->string, output_buffer))
+        {
+            goto end;
+        }
+        update_offset(output_buffer);
+
+        length = (size_t) (output_buffer->format ? 2 : 1);
+        output_pointer = ensure(output_buffer, length);
+        if (output_pointer == NULL)
+        {
+            goto end;
+        }
+        *output_pointer++ = ':';
+        if (output_buffer->format)
+        {
+            *output_pointer++ = '\t';
+        }
+        output_buffer->offset += length;
+    }
+    goto value;
+
+value_done:
+    if (count == 0)
+    {
+        success = true;
+        goto end;
+    }
+    update_offset(output_buffer);
+
+    object = frames[count - 1].object;
+    if (object)
+    {
+        /* print comma if not last */
+        length = ((size_t)(output_buffer->format ? 1 : 0) + (size_t)(current->next ? 1 : 0));
+        output_pointer = ensure(output_buffer, length + 1);
+        if (output_pointer == NULL)
+        {
+            goto end;
+        }
+        if (current->next)
+        {
+            *output_pointer++ = ',';
+        }
+        if (output_buffer->format)
+        {
+            *output_pointer++ = '\n';
+        }
+        *output_pointer = '\0';
+        output_buffer->offset += length;
+    }
+    else if (current->next)
+    {
+        length = (size_t) (output_buffer->format ? 2 : 1);
+        output_pointer = ensure(output_buffer, length + 1);
+        if (output_pointer == NULL)
+        {
+            goto end;
+        }
+        *output_pointer++ = ',';
+        if (output_buffer->format)
+        {
+            *output_pointer++ = ' ';
+        }
+        *output_pointer = '\0';
+        output_buffer->offset += length;
+    }
+
+    if (current->next != NULL)
+    {
+        frames[count - 1].element = current->next;
+        goto element;
+    }
+
+    /* that was the last child, the container is the element of the frame below or item */
+    count--;
+    current = (count > 0) ? frames[count - 1].element : item;
+
+close:
+    if (object)
+    {
+        output_pointer = ensure(output_buffer, output_buffer->format ? (output_buffer->depth + 1) : 2);
+        if (output_pointer == NULL)
+        {
+            goto end;
+        }
+        if (output_buffer->format)
+        {
+            for (i = 0; i < (output_buffer->depth - 1); i++)
+            {
+                *output_pointer++ = '\t';
+            }
+        }
+        *output_pointer++ = '}';
+    }
+    else
+    {
+        output_pointer = ensure(output_buffer, 2);
+        if (output_pointer == NULL)
+        {
+            goto end;
+        }
+        *output_pointer++ = ']';
+    }
+    *output_pointer = '\0';
+    output_buffer->depth--;
+    goto value_done;
+
+end:
+    if (frames != inline_frames)
+    {
+        output_buffer->hooks.deallocate(frames);
+    }
+
+    return success;
+}
+
+#if CJSON_ARRAY_INDEX
+/* Contiguous vector of child pointers, the pointers follow the header in the same allocation. */
+typedef struct cJSON_ArrayIndex
+{
+    size_t count;
+    size_t capacity;
+} cJSON_ArrayIndex;
+
+#define array_index_items(index) ((cJSON**)((index) + 1))
+
+static cJSON_ArrayIndex *array_index_allocate(size_t capacity)
+{
+    cJSON_ArrayIndex *index = (cJSON_ArrayIndex*)global_hooks.allocate(sizeof(cJSON_ArrayIndex) + (capacity * sizeof(cJSON*)));
+    if (index != NULL)
+    {
+        index->count = 0;
+        index->capacity = capacity;
+    }
+
+    return index;
+}
+
+static void array_index_drop(cJSON * const array)
+{
+    if (array->array_index != NULL)
+    {
+        global_hooks.deallocate(array->array_index);
+        array->array_index = NULL;
+    }
+}
+
+/* Return the index of array if it is still consistent with the child list.
+ * Only the list ends are checked, the mutation functions below keep the middle in sync. */
+static cJSON_ArrayIndex *array_index_valid(const cJSON * const array)
+{
+    cJSON_ArrayIndex *index = array->array_index;
+
+    if (index == NULL)
+    {
+        return NULL;
+    }
+
+    if (index->count == 0)
+    {
+        return (array->child == NULL) ? index : NULL;
+    }
+
+    if ((array_index_items(index)[0] == array->child) && (array_index_items(index)[index->count - 1] == array->child->prev))
+    {
+        return index;
+    }
+
+    return NULL;
+}
+
+/* (Re)build the index of array from its child list, size is the known length of the list. */
+static cJSON_ArrayIndex *array_index_build(cJSON * const array, size_t size)
+{
+    cJSON_ArrayIndex *index = NULL;
+    cJSON *child = NULL;
+    size_t i = 0;
+
+    array_index_drop(array);
+
+    if ((array->type & cJSON_IsReference) || (size < CJSON_ARRAY_INDEX_MIN_SIZE))
+    {
+        return NULL;
+    }
+
+    index = array_index_allocate(size);
+    if (index == NULL)
+    {
+        /* not fatal, we just keep walking the list */
+        return NULL;
+    }
+
+    for (child = array->child; (child != NULL) && (i < size); child = child->next)
+    {
+        array_index_items(index)[i++] = child;
+    }
+    index->count = i;
+    array->array_index = index;
+
+    return index;
+}
+
+/* Make room for one more pointer, drops the index if that fails. */
+static cJSON_ArrayIndex *array_index_reserve(cJSON * const array)
+{
+    cJSON_ArrayIndex *index = array_index_valid(array);
+    cJSON_ArrayIndex *grown = NULL;
+
+    if (index == NULL)
+    {
+        array_index_drop(array);
+        return NULL;
+    }
+
+    if (index->count < index->capacity)
+    {
+        return index;
+    }
+
+    grown = array_index_allocate((index->capacity * 2) + 1);
+    if (grown == NULL)
+    {
+        array_index_drop(array);
+        return NULL;
+    }
+    memcpy(array_index_items(grown), array_index_items(index), index->count * sizeof(cJSON*));
+    grown->count = index->count;
+    array_index_drop(array);
+    array->array_index = grown;
+
+    return grown;
+}
+
+/* Position of item in the index, or count if it isn't there. */
+static size_t array_index_find(cJSON_ArrayIndex * const index, const cJSON * const item)
+{
+    size_t position = 0;
+
+    for (position = 0; position < index->count; position++)
+    {
+        if (array_index_items(index)[position] == item)
+        {
+            break;
+        }
+    }
+
+    return position;
+}
+
+/* Called before item is linked in front of the element at position (position == count appends). */
+static void array_index_insert(cJSON * const array, size_t position, cJSON * const item)
+{
+    cJSON_ArrayIndex *index = NULL;
+
+    if (array->array_index == NULL)
+    {
+        return;
+    }
+
+    index = array_index_reserve(array);
+    if ((index == NULL) || (position > index->count))
+    {
+        array_index_drop(array);
+        return;
+    }
+
+    memmove(array_index_items(index) + position + 1, array_index_items(index) + position, (index->count - position) * sizeof(cJSON*));
+    array_index_items(index)[position] = item;
+    index->count++;
+}
+
+/* Called before item is unlinked from array. */
+static void array_index_remove(cJSON * const array, const cJSON * const item)
+{
+    cJSON_ArrayIndex *index = NULL;
+    size_t position = 0;
+
+    if (array->array_index == NULL)
+    {
+        return;
+    }
+
+    index = array_index_valid(array);
+    if (index == NULL)
+    {
+        array_index_drop(array);
+        return;
+    }
+
+    position = array_index_find(index, item);
+    if (position == index->count)
+    {
+        array_index_drop(array);
+        return;
+    }
+
+    memmove(array_index_items(index) + position, array_index_items(index) + position + 1, (index->count - position - 1) * sizeof(cJSON*));
+    index->count--;
+}
+
+/* Called before item is replaced by replacement in array. */
+static void array_index_replace(cJSON * const array, const cJSON * const item, cJSON * const replacement)
+{
+    cJSON_ArrayIndex *index = NULL;
+    size_t position = 0;
+
+    if (array->array_index == NULL)
+    {
+        return;
+    }
+
+    index = array_index_valid(array);
+    if (index == NULL)
+    {
+        array_index_drop(array);
+        return;
+    }
+
+    position = array_index_find(index, item);
+    if (position == index->count)
+    {
+        array_index_drop(array);
+        return;
+    }
+
+    array_index_items(index)[position] = replacement;
+}
+
+static size_t array_index_memory(const cJSON *item)
+{
+    size_t memory = 0;
+
+    for (; item != NULL; item = item->next)
+    {
+        if (item->array_index != NULL)
+        {
+            memory += sizeof(cJSON_ArrayIndex) + (item->array_index->capacity * sizeof(cJSON*));
+        }
+        if (!(item->type & cJSON_IsReference))
+        {
+            memory += array_index_memory(item->child);
+        }
+    }
+
+    return memory;
+}
+#else
+#define array_index_insert(array, position, item)
+#define array_index_remove(array, item)
+#define array_index_replace(array, item, replacement)
+#endif /* CJSON_ARRAY_INDEX */
+
+CJSON_PUBLIC(cJSON_bool) cJSON_BuildArrayIndex(cJSON *array)
+{
+#if CJSON_ARRAY_INDEX
+    cJSON *child = NULL;
+    size_t size = 0;
+
+    if ((array == NULL) || !(array->type & (cJSON_Array | cJSON_Object)))
+    {
+        return false;
+    }
+
+    if (array_index_valid(array) != NULL)
+    {
+        return true;
+    }
+
+    for (child = array->child; child != NULL; child = child->next)
+    {
+        size++;
+    }
+
+    return array_index_build(array, size) != NULL;
+#else
+    (void)array;
+    return false;
+#endif
+}
+
+CJSON_PUBLIC(size_t) cJSON_GetArrayIndexMemory(const cJSON *item)
+{
+#if CJSON_ARRAY_INDEX
+    if (item == NULL)
+    {
+        return 0;
+    }
+
+    /* don't count the siblings of item */
+    return ((item->array_index != NULL) ? (sizeof(cJSON_ArrayIndex) + (item->array_index->capacity * sizeof(cJSON*))) : 0)
+        + (!(item->type & cJSON_IsReference) ? array_index_memory(item->child) : 0);
+#else
+    (void)item;
+    return 0;
+#endif
+}
+
+/* Get Array size/item / object item. */
+CJSON_PUBLIC(int) cJSON_GetArraySize(const cJSON *array)
+{
+    cJSON *child = NULL;
+    size_t size = 0;
+
+    if (array == NULL)
+    {
+        return 0;
+    }
+
+#if CJSON_ARRAY_INDEX
+    if (array_index_valid(array) != NULL)
+    {
+        return (int)array->array_index->count;
+    }
+#endif
+
+    child = array->child;
+
+    while(child != NULL)
+    {
+        size++;
+        child = child->next;
+    }
+
+    /* FIXME: Can overflow here. Cannot be fixed without breaking the API */
+
+    return (int)size;
+}
+
+static cJSON* get_array_item(const cJSON *array, size_t index)
+{
+    cJSON *current_child = NULL;
+
+    if (array == NULL)
+    {
+        return NULL;
+    }
+
+#if CJSON_ARRAY_INDEX
+    /* only read here, the getters are const and may run on several threads at once */
+    if (array_index_valid(array) != NULL)
+    {
+        return (index < array->array_index->count) ? array_index_items(array->array_index)[index] : NULL;
+    }
+#endif
+
+    current_child = array->child;
+    while ((current_child != NULL) && (index > 0))
+    {
+        index--;
+        current_child = current_child->next;
+    }
+
+    return current_child;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_GetArrayItem(const cJSON *array, int index)
+{
+    if (index < 0)
+    {
+        return NULL;
+    }
+
+    return get_array_item(array, (size_t)index);
+}
+
+static cJSON *get_object_item(const cJSON * const object, const char * const name, const cJSON_bool case_sensitive)
+{
+    cJSON *current_element = NULL;
+
+    if ((object == NULL) || (name == NULL))
+    {
+        return NULL;
+    }
+
+    current_element = object->child;
+
+    /* interned keys are shared, so a name taken from the same context is found by its address */
+    if ((current_element != NULL) && (current_element->type & cJSON_StringIsConst))
+    {
+        for (; current_element != NULL; current_element = current_element->next)
+        {
+            if (current_element->string == name)
+            {
+                return current_element;
+            }
+        }
+        current_element = object->child;
+    }
+
+    if (case_sensitive)
+    {
+        while ((current_element != NULL) && (current_element->string != NULL) && (strcmp(name, current_element->string) != 0))
+        {
+            current_element = current_element->next;
+        }
+    }
+    else
+    {
+        while ((current_element != NULL) && (case_insensitive_strcmp((const unsigned char*)name, (const unsigned char*)(current_element->string)) != 0))
+        {
+            current_element = current_element->next;
+        }
+    }
+
+    if ((current_element == NULL) || (current_element->string == NULL)) {
+        return NULL;
+    }
+
+    return current_element;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_GetObjectItem(const cJSON * const object, const char * const string)
+{
+    return get_object_item(object, string, false);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_GetObjectItemCaseSensitive(const cJSON * const object, const char * const string)
+{
+    return get_object_item(object, string, true);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_HasObjectItem(const cJSON *object, const char *string)
+{
+    return cJSON_GetObjectItem(object, string) ? 1 : 0;
+}
+
+/* Utility for array list handling. */
+static void suffix_object(cJSON *prev, cJSON *item)
+{
+    prev->next = item;
+    item->prev = prev;
+}
+
+/* Utility for handling references. */
+static cJSON *create_reference(const cJSON *item, const internal_hooks * const hooks)
+{
+    cJSON *reference = NULL;
+    if (item == NULL)
+    {
+        return NULL;
+    }
+
+    reference = cJSON_New_Item(hooks);
+    if (reference == NULL)
+    {
+        return NULL;
+    }
+
+    memcpy(reference, item, sizeof(cJSON));
+    reference->string = NULL;
+    reference->type |= cJSON_IsReference;
+    reference->next = reference->prev = NULL;
+#if CJSON_ARRAY_INDEX
+    reference->array_index = NULL;
+#endif
+    return reference;
+}
+
+static cJSON_bool add_item_to_array(cJSON *array, cJSON *item)
+{
+    cJSON *child = NULL;
+
+    if ((item == NULL) || (array == NULL) || (array == item))
+    {
+        return false;
+    }
+
+    child = array->child;
+#if CJSON_ARRAY_INDEX
+    if ((array->array_index != NULL) && ((child == NULL) || (child->prev != NULL)))
+    {
+        array_index_insert(array, array->array_index->count, item);
+    }
+#endif
+    /*
+     * To find the last item in array quickly, we use prev in array
+     */
+    if (child == NULL)
+    {
+        /* list is empty, start new one */
+        array->child = item;
+        item->prev = item;
+        item->next = NULL;
+    }
+    else
+    {
+        /* append to the end */
+        if (child->prev)
+        {
+            suffix_object(child->prev, item);
+            array->child->prev = item;
+        }
+    }
+
+    return true;
+}
+
+/* Add item to array/object. */
+CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToArray(cJSON *array, cJSON *item)
+{
+    return add_item_to_array(array, item);
+}
+
+#if defined(__clang__) || (defined(__GNUC__)  && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ > 5))))
+    #pragma GCC diagnostic push
+#endif
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#endif
+/* helper function to cast away const */
+static void* cast_away_const(const void* string)
+{
+    return (void*)string;
+}
+#if defined(__clang__) || (defined(__GNUC__)  && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ > 5))))
+    #pragma GCC diagnostic pop
+#endif
+
+
+static cJSON_bool add_item_to_object(cJSON * const object, const char * const string, cJSON * const item, const internal_hooks * const hooks, const cJSON_bool constant_key)
+{
+    char *new_key = NULL;
+    int new_type = cJSON_Invalid;
+
+    if ((object == NULL) || (string == NULL) || (item == NULL) || (object == item))
+    {
+        return false;
+    }
+
+    if (constant_key)
+    {
+        new_key = (char*)cast_away_const(string);
+        new_type = (item->type & ~cJSON_StringIsBorrowed) | cJSON_StringIsConst;
+    }
+    else
+    {
+        new_key = (char*)cJSON_strdup((const unsigned char*)string, hooks);
+        if (new_key == NULL)
+        {
+            return false;
+        }
+
+        new_type = item->type & ~(cJSON_StringIsConst | cJSON_StringIsBorrowed);
+    }
+
+    if (!(item->type & cJSON_StringIsConst) && (item->string != NULL))
+    {
+        hooks->deallocate(item->string);
+    }
+
+    item->string = new_key;
+    item->type = new_type;
+
+    return add_item_to_array(object, item);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToObject(cJSON *object, const char *string, cJSON *item)
+{
+    return add_item_to_object(object, string, item, &global_hooks, false);
+}
+
+/* Add an item to an object with constant string as key */
+CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToObjectCS(cJSON *object, const char *string, cJSON *item)
+{
+    return add_item_to_object(object, string, item, &global_hooks, true);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_AddItemReferenceToArray(cJSON *array, cJSON *item)
+{
+    if (array == NULL)
+    {
+        return false;
+    }
+
+    return add_item_to_array(array, create_reference(item, &global_hooks));
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_AddItemReferenceToObject(cJSON *object, const char *string, cJSON *item)
+{
+    if ((object == NULL) || (string == NULL))
+    {
+        return false;
+    }
+
+    return add_item_to_object(object, string, create_reference(item, &global_hooks), &global_hooks, false);
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddNullToObject(cJSON * const object, const char * const name)
+{
+    cJSON *null = cJSON_CreateNull();
+    if (add_item_to_object(object, name, null, &global_hooks, false))
+    {
+        return null;
+    }
+
+    cJSON_Delete(null);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddTrueToObject(cJSON * const object, const char * const name)
+{
+    cJSON *true_item = cJSON_CreateTrue();
+    if (add_item_to_object(object, name, true_item, &global_hooks, false))
+    {
+        return true_item;
+    }
+
+    cJSON_Delete(true_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddFalseToObject(cJSON * const object, const char * const name)
+{
+    cJSON *false_item = cJSON_CreateFalse();
+    if (add_item_to_object(object, name, false_item, &global_hooks, false))
+    {
+        return false_item;
+    }
+
+    cJSON_Delete(false_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddBoolToObject(cJSON * const object, const char * const name, const cJSON_bool boolean)
+{
+    cJSON *bool_item = cJSON_CreateBool(boolean);
+    if (add_item_to_object(object, name, bool_item, &global_hooks, false))
+    {
+        return bool_item;
+    }
+
+    cJSON_Delete(bool_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddNumberToObject(cJSON * const object, const char * const name, const double number)
+{
+    cJSON *number_item = cJSON_CreateNumber(number);
+    if (add_item_to_object(object, name, number_item, &global_hooks, false))
+    {
+        return number_item;
+    }
+
+    cJSON_Delete(number_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddStringToObject(cJSON * const object, const char * const name, const char * const string)
+{
+    cJSON *string_item = cJSON_CreateString(string);
+    if (add_item_to_object(object, name, string_item, &global_hooks, false))
+    {
+        return string_item;
+    }
+
+    cJSON_Delete(string_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddRawToObject(cJSON * const object, const char * const name, const char * const raw)
+{
+    cJSON *raw_item = cJSON_CreateRaw(raw);
+    if (add_item_to_object(object, name, raw_item, &global_hooks, false))
+    {
+        return raw_item;
+    }
+
+    cJSON_Delete(raw_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddObjectToObject(cJSON * const object, const char * const name)
+{
+    cJSON *object_item = cJSON_CreateObject();
+    if (add_item_to_object(object, name, object_item, &global_hooks, false))
+    {
+        return object_item;
+    }
+
+    cJSON_Delete(object_item);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON*) cJSON_AddArrayToObject(cJSON * const object, const char * const name)
+{
+    cJSON *array = cJSON_CreateArray();
+    if (add_item_to_object(object, name, array, &global_hooks, false))
+    {
+        return array;
+    }
+
+    cJSON_Delete(array);
+    return NULL;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_DetachItemViaPointer(cJSON *parent, cJSON * const item)
+{
+    if ((parent == NULL) || (item == NULL) || (item != parent->child && item->prev == NULL))
+    {
+        return NULL;
+    }
+
+    array_index_remove(parent, item);
+
+    if (item != parent->child)
+    {
+        /* not the first element */
+        item->prev->next = item->next;
+    }
+    if (item->next != NULL)
+    {
+        /* not the last element */
+        item->next->prev = item->prev;
+    }
+
+    if (item == parent->child)
+    {
+        /* first element */
+        parent->child = item->next;
+    }
+    else if (item->next == NULL)
+    {
+        /* last element */
+        parent->child->prev = item->prev;
+    }
+
+    /* make sure the detached item doesn't point anywhere anymore */
+    item->prev = NULL;
+    item->next = NULL;
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromArray(cJSON *array, int which)
+{
+    if (which < 0)
+    {
+        return NULL;
+    }
+
+    return cJSON_DetachItemViaPointer(array, get_array_item(array, (size_t)which));
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteItemFromArray(cJSON *array, int which)
+{
+    cJSON_Delete(cJSON_DetachItemFromArray(array, which));
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromObject(cJSON *object, const char *string)
+{
+    cJSON *to_detach = cJSON_GetObjectItem(object, string);
+
+    return cJSON_DetachItemViaPointer(object, to_detach);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromObjectCaseSensitive(cJSON *object, const char *string)
+{
+    cJSON *to_detach = cJSON_GetObjectItemCaseSensitive(object, string);
+
+    return cJSON_DetachItemViaPointer(object, to_detach);
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteItemFromObject(cJSON *object, const char *string)
+{
+    cJSON_Delete(cJSON_DetachItemFromObject(object, string));
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteItemFromObjectCaseSensitive(cJSON *object, const char *string)
+{
+    cJSON_Delete(cJSON_DetachItemFromObjectCaseSensitive(object, string));
+}
+
+/* Replace array/object items with new ones. */
+CJSON_PUBLIC(cJSON_bool) cJSON_InsertItemInArray(cJSON *array, int which, cJSON *newitem)
+{
+    cJSON *after_inserted = NULL;
+
+    if (which < 0 || newitem == NULL)
+    {
+        return false;
+    }
+
+    after_inserted = get_array_item(array, (size_t)which);
+    if (after_inserted == NULL)
+    {
+        return add_item_to_array(array, newitem);
+    }
+
+    if (after_inserted != array->child && after_inserted->prev == NULL) {
+        /* return false if after_inserted is a corrupted array item */
+        return false;
+    }
+
+    array_index_insert(array, (size_t)which, newitem);
+
+    newitem->next = after_inserted;
+    newitem->prev = after_inserted->prev;
+    after_inserted->prev = newitem;
+    if (after_inserted == array->child)
+    {
+        array->child = newitem;
+    }
+    else
+    {
+        newitem->prev->next = newitem;
+    }
+    return true;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemViaPointer(cJSON * const parent, cJSON * const item, cJSON * replacement)
+{
+    if ((parent == NULL) || (parent->child == NULL) || (replacement == NULL) || (item == NULL))
+    {
+        return false;
+    }
+
+    if (replacement == item)
+    {
+        return true;
+    }
+
+    array_index_replace(parent, item, replacement);
+
+    replacement->next = item->next;
+    replacement->prev = item->prev;
+
+    if (replacement->next != NULL)
+    {
+        replacement->next->prev = replacement;
+    }
+    if (parent->child == item)
+    {
+        if (parent->child->prev == parent->child)
+        {
+            replacement->prev = replacement;
+        }
+        parent->child = replacement;
+    }
+    else
+    {   /*
+         * To find the last item in array quickly, we use prev in array.
+         * We can't modify the last item's next pointer where this item was the parent's child
+         */
+        if (replacement->prev != NULL)
+        {
+            replacement->prev->next = replacement;
+        }
+        if (replacement->next == NULL)
+        {
+            parent->child->prev = replacement;
+        }
+    }
+
+    item->next = NULL;
+    item->prev = NULL;
+    cJSON_Delete(item);
+
+    return true;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInArray(cJSON *array, int which, cJSON *newitem)
+{
+    if (which < 0)
+    {
+        return false;
+    }
+
+    return cJSON_ReplaceItemViaPointer(array, get_array_item(array, (size_t)which), newitem);
+}
+
+static cJSON_bool replace_item_in_object(cJSON *object, const char *string, cJSON *replacement, cJSON_bool case_sensitive)
+{
+    if ((replacement == NULL) || (string == NULL))
+    {
+        return false;
+    }
+
+    /* replace the name in the replacement */
+    if (!(replacement->type & cJSON_StringIsConst) && (replacement->string != NULL))
+    {
+        cJSON_free(replacement->string);
+    }
+    replacement->string = (char*)cJSON_strdup((const unsigned char*)string, &global_hooks);
+    if (replacement->string == NULL)
+    {
+        return false;
+    }
+
+    replacement->type &= ~(cJSON_StringIsConst | cJSON_StringIsBorrowed);
+
+    return cJSON_ReplaceItemViaPointer(object, get_object_item(object, string, case_sensitive), replacement);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInObject(cJSON *object, const char *string, cJSON *newitem)
+{
+    return replace_item_in_object(object, string, newitem, false);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInObjectCaseSensitive(cJSON *object, const char *string, cJSON *newitem)
+{
+    return replace_item_in_object(object, string, newitem, true);
+}
+
+/* Create basic types: */
+CJSON_PUBLIC(cJSON *) cJSON_CreateNull(void)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_NULL;
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateTrue(void)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_True;
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateFalse(void)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_False;
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateBool(cJSON_bool boolean)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = boolean ? cJSON_True : cJSON_False;
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateNumber(double num)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_Number;
+        item->valuedouble = num;
+
+        /* use saturation in case of overflow */
+        if (num >= INT_MAX)
+        {
+            item->valueint = INT_MAX;
+        }
+        else if (num <= (double)INT_MIN)
+        {
+            item->valueint = INT_MIN;
+        }
+        else
+        {
+            item->valueint = (int)num;
+        }
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateString(const char *string)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_String;
+        item->valuestring = (char*)cJSON_strdup((const unsigned char*)string, &global_hooks);
+        if(!item->valuestring)
+        {
+            cJSON_Delete(item);
+            return NULL;
+        }
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateStringReference(const char *string)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if (item != NULL)
+    {
+        item->type = cJSON_String | cJSON_IsReference;
+        item->valuestring = (char*)cast_away_const(string);
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateObjectReference(const cJSON *child)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if (item != NULL) {
+        item->type = cJSON_Object | cJSON_IsReference;
+        item->child = (cJSON*)cast_away_const(child);
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateArrayReference(const cJSON *child) {
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if (item != NULL) {
+        item->type = cJSON_Array | cJSON_IsReference;
+        item->child = (cJSON*)cast_away_const(child);
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateRaw(const char *raw)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type = cJSON_Raw;
+        item->valuestring = (char*)cJSON_strdup((const unsigned char*)raw, &global_hooks);
+        if(!item->valuestring)
+        {
+            cJSON_Delete(item);
+            return NULL;
+        }
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateArray(void)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if(item)
+    {
+        item->type=cJSON_Array;
+    }
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateObject(void)
+{
+    cJSON *item = cJSON_New_Item(&global_hooks);
+    if (item)
+    {
+        item->type = cJSON_Object;
+    }
+
+    return item;
+}
+
+/* Create Arrays: */
+CJSON_PUBLIC(cJSON *) cJSON_CreateIntArray(const int *numbers, int count)
+{
+    size_t i = 0;
+    cJSON *n = NULL;
+    cJSON *p = NULL;
+    cJSON *a = NULL;
+
+    if ((count < 0) || (numbers == NULL))
+    {
+        return NULL;
+    }
+
+    a = cJSON_CreateArray();
+
+    for(i = 0; a && (i < (size_t)count); i++)
+    {
+        n = cJSON_CreateNumber(numbers[i]);
+        if (!n)
+        {
+            cJSON_Delete(a);
+            return NULL;
+        }
+        if(!i)
+        {
+            a->child = n;
+        }
+        else
+        {
+            suffix_object(p, n);
+        }
+        p = n;
+    }
+
+    if (a && a->child) {
+        a->child->prev = n;
+    }
+
+    return a;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateFloatArray(const float *numbers, int count)
+{
+    size_t i = 0;
+    cJSON *n = NULL;
+    cJSON *p = NULL;
+    cJSON *a = NULL;
+
+    if ((count < 0) || (numbers == NULL))
+    {
+        return NULL;
+    }
+
+    a = cJSON_CreateArray();
+
+    for(i = 0; a && (i < (size_t)count); i++)
+    {
+        n = cJSON_CreateNumber((double)numbers[i]);
+        if(!n)
+        {
+            cJSON_Delete(a);
+            return NULL;
+        }
+        if(!i)
+        {
+            a->child = n;
+        }
+        else
+        {
+            suffix_object(p, n);
+        }
+        p = n;
+    }
+
+    if (a && a->child) {
+        a->child->prev = n;
+    }
+
+    return a;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateDoubleArray(const double *numbers, int count)
+{
+    size_t i = 0;
+    cJSON *n = NULL;
+    cJSON *p = NULL;
+    cJSON *a = NULL;
+
+    if ((count < 0) || (numbers == NULL))
+    {
+        return NULL;
+    }
+
+    a = cJSON_CreateArray();
+
+    for(i = 0; a && (i < (size_t)count); i++)
+    {
+        n = cJSON_CreateNumber(numbers[i]);
+        if(!n)
+        {
+            cJSON_Delete(a);
+            return NULL;
+        }
+        if(!i)
+        {
+            a->child = n;
+        }
+        else
+        {
+            suffix_object(p, n);
+        }
+        p = n;
+    }
+
+    if (a && a->child) {
+        a->child->prev = n;
+    }
+
+    return a;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_CreateStringArray(const char *const *strings, int count)
+{
+    size_t i = 0;
+    cJSON *n = NULL;
+    cJSON *p = NULL;
+    cJSON *a = NULL;
+
+    if ((count < 0) || (strings == NULL))
+    {
+        return NULL;
+    }
+
+    a = cJSON_CreateArray();
+
+    for (i = 0; a && (i < (size_t)count); i++)
+    {
+        n = cJSON_CreateString(strings[i]);
+        if(!n)
+        {
+            cJSON_Delete(a);
+            return NULL;
+        }
+        if(!i)
+        {
+            a->child = n;
+        }
+        else
+        {
+            suffix_object(p,n);
+        }
+        p = n;
+    }
+
+    if (a && a->child) {
+        a->child->prev = n;
+    }
+
+    return a;
+}
+
+/* Duplication */
+cJSON * cJSON_Duplicate_rec(const cJSON *item, size_t depth, cJSON_bool recurse);
+
+CJSON_PUBLIC(cJSON *) cJSON_Duplicate(const cJSON *item, cJSON_bool recurse)
+{
+    return cJSON_Duplicate_rec(item, 0, recurse );
+}
+
+cJSON * cJSON_Duplicate_rec(const cJSON *item, size_t depth, cJSON_bool recurse)
+{
+    cJSON *newitem = NULL;
+    cJSON *child = NULL;
+    cJSON *next = NULL;
+    cJSON *newchild = NULL;
+
+    /* Bail on bad ptr */
+    if (!item)
+    {
+        goto fail;
+    }
+    /* Create new item */
+    newitem = cJSON_New_Item(&global_hooks);
+    if (!newitem)
+    {
+        goto fail;
+    }
+    /* Copy over all vars */
+    newitem->type = item->type & (~(cJSON_IsReference | cJSON_StringIsBorrowed));
+    newitem->valueint = item->valueint;
+    newitem->valuedouble = item->valuedouble;
+    if (item->valuestring)
+    {
+        newitem->valuestring = (char*)cJSON_strdup((unsigned char*)item->valuestring, &global_hooks);
+        if (!newitem->valuestring)
+        {
+            goto fail;
+        }
+    }
+    if (item->string)
+    {
+        /* a borrowed name lives only as long as its context or input buffer, the copy gets its own */
+        if ((item->type & cJSON_StringIsConst) && !(item->type & cJSON_StringIsBorrowed))
+        {
+            newitem->string = item->string;
+        }
+        else
+        {
+            newitem->string = (char*)cJSON_strdup((unsigned char*)item->string, &global_hooks);
+            newitem->type &= ~cJSON_StringIsConst;
+        }
+        if (!newitem->string)
+        {
+            goto fail;
+        }
+    }
+    /* If non-recursive, then we're done! */
+    if (!recurse)
+    {
+        return newitem;
+    }
+    /* Walk the ->next chain for the child. */
+    child = item->child;
+    while (child != NULL)
+    {
+        if(depth >= CJSON_CIRCULAR_LIMIT) {
+            goto fail;
+        }
+        newchild = cJSON_Duplicate_rec(child, depth + 1, true); /* Duplicate (with recurse) each item in the ->next chain */
+        if (!newchild)
+        {
+            goto fail;
+        }
+        if (next != NULL)
+        {
+            /* If newitem->child already set, then crosswire ->prev and ->next and move on */
+            next->next = newchild;
+            newchild->prev = next;
+            next = newchild;
+        }
+        else
+        {
+            /* Set newitem->child and move to it */
+            newitem->child = newchild;
+            next = newchild;
+        }
+        child = child->next;
+    }
+    if (newitem && newitem->child)
+    {
+        newitem->child->prev = newchild;
+    }
+
+    return newitem;
+
+fail:
+    if (newitem != NULL)
+    {
+        cJSON_Delete(newitem);
+    }
+
+    return NULL;
+}
+
+#if defined(CJSON_SIMD_NEON)
+/* movemask for NEON: bit i is set if byte i of the comparison is 0xFF */
+static unsigned int neon_movemask(const uint8x16_t matches)
+{
+    static const unsigned char weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t bits = vandq_u8(matches, vld1q_u8(weights));
+    uint8x8_t sums = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+
+    sums = vpadd_u8(sums, sums);
+    sums = vpadd_u8(sums, sums);
+
+    return (unsigned int)vget_lane_u8(sums, 0) | ((unsigned int)vget_lane_u8(sums, 1) << 8);
+}
+#endif
+
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+/* classify the 32 bytes at input into bitmasks of the whitespace cJSON_Minify drops, quotes
+ * and the characters that need the scalar code ('\\' and '/') */
+static void minify_classify(const unsigned char * const input, unsigned int * const blank, unsigned int * const quote, unsigned int * const special)
+{
+#if defined(CJSON_SIMD_AVX2)
+    const __m256i chunk = _mm256_loadu_si256((const __m256i*)(const void*)input);
+    *blank = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')))));
+    *quote = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\"')));
+    *special = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/'))));
+#else
+    size_t half = 0;
+
+    *blank = 0;
+    *quote = 0;
+    *special = 0;
+    for (half = 0; half < 2; half++)
+    {
+#if defined(CJSON_SIMD_SSE2)
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)(const void*)(input + (half * 16)));
+        const unsigned int blank_half = (unsigned int)_mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')))));
+        const unsigned int quote_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')));
+        const unsigned int special_half = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/'))));
+#else
+        const uint8x16_t chunk = vld1q_u8(input + (half * 16));
+        const unsigned int blank_half = neon_movemask(vorrq_u8(
+                vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t'))),
+                vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\r')), vceqq_u8(chunk, vdupq_n_u8('\n')))));
+        const unsigned int quote_half = neon_movemask(vceqq_u8(chunk, vdupq_n_u8('\"')));
+        const unsigned int special_half = neon_movemask(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\\')), vceqq_u8(chunk, vdupq_n_u8('/'))));
+#endif
+        *blank |= blank_half << (half * 16);
+        *quote |= quote_half << (half * 16);
+        *special |= special_half << (half * 16);
+    }
+#endif
+}
+
+/* minify the first length (<= 32) bytes of a classified block that has no '\\' or '/' in them,
+ * so every quote opens or closes a string. Returns whether the block ends inside a string. */
+static cJSON_bool minify_block(char **input, char **output, const size_t length, unsigned int blank, unsigned int quote, const cJSON_bool in_string)
+{
+    const unsigned int mask = (length >= 32) ? 0xFFFFFFFFu : ((1u << length) - 1u);
+    unsigned int inside = quote & mask;
+    size_t i = 0;
+
+    /* prefix xor of the quotes marks every byte after an opening quote */
+    inside ^= inside << 1;
+    inside ^= inside << 2;
+    inside ^= inside << 4;
+    inside ^= inside << 8;
+    inside ^= inside << 16;
+    inside &= 0xFFFFFFFFu;
+    if (in_string)
+    {
+        inside = ~inside;
+    }
+
+    blank &= ~inside & mask;
+    if (blank == 0)
+    {
+        if (*output != *input)
+        {
+            memmove(*output, *input, length);
+        }
+        *output += length;
+    }
+    else
+    {
+        /* branchless compaction, each byte is written and the output only advances past the kept ones */
+        char block[32];
+        char *into = *output;
+        /* the whole block is readable, a fixed size copy is cheaper than one of length bytes */
+        memcpy(block, *input, sizeof(block));
+        for (i = 0; i < length; i++)
+        {
+            *into = block[i];
+            into += 1 - ((blank >> i) & 1);
+        }
+        *output = into;
+    }
+    *input += length;
+
+    return (inside & (1u << (length - 1))) != 0;
+}
+#endif
+
+/* minify one character, or the comment or escape sequence it starts. Returns whether the input continues inside a string. */
+static cJSON_bool minify_character(char **input, char **output, const char * const end, const cJSON_bool in_string)
+{
+    const char current = (*input)[0];
+
+    if (in_string)
+    {
+        *(*output)++ = *(*input)++;
+        if ((current == '\\') && (*input < end))
+        {
+            /* the escaped character, even if it is a quote */
+            *(*output)++ = *(*input)++;
+        }
+
+        return current != '\"';
+    }
+
+    switch (current)
+    {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            (*input)++;
+            break;
+
+        case '/':
+            if ((*input)[1] == '/')
+            {
+                const void *newline = memchr(*input, '\n', (size_t)(end - *input));
+                *input += (newline != NULL) ? (((const char*)newline - *input) + (ptrdiff_t)static_strlen("\n")) : (end - *input);
+            }
+            else if ((*input)[1] == '*')
+            {
+                for (*input += static_strlen("/*"); *input < end; ++(*input))
+                {
+                    if (((*input)[0] == '*') && ((*input)[1] == '/'))
+                    {
+                        *input += static_strlen("*/");
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                (*input)++;
+            }
+            break;
+
+        case '\"':
+            *(*output)++ = *(*input)++;
+            return true;
+
+        default:
+            *(*output)++ = *(*input)++;
+            break;
+    }
+
+    return false;
+}
+
+CJSON_PUBLIC(void) cJSON_Minify(char *json)
+{
+    char *into = json;
+    const char *end = NULL;
+    cJSON_bool in_string = false;
+
+    if (json == NULL)
+    {
+        return;
+    }
+
+    end = json + strlen(json);
+    while (json < end)
+    {
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+        if ((end - json) >= 32)
+        {
+            unsigned int blank = 0;
+            unsigned int quote = 0;
+            unsigned int special = 0;
+            size_t length = 32;
+
+            minify_classify((const unsigned char*)json, &blank, &quote, &special);
+            if (special != 0)
+            {
+                length = lowest_set_bit(special);
+            }
+            if (length > 0)
+            {
+                in_string = minify_block(&json, &into, length, blank, quote, in_string);
+                continue;
             }
         }
+#endif
+        in_string = minify_character(&json, &into, end, in_string);
     }
-    output[output_length + 1] = '\"';
-    output[output_length + 2] = '\0';
 
-    return true;
+    /* and null-terminate. */
+    *into = '\0';
 }
 
-/* Invoke print_string_ptr (which is useful) on an item. */
-static cJSON_bool print_string(const cJSON * const item, printbuffer * const p)
+CJSON_PUBLIC(cJSON_bool) cJSON_IsInvalid(const cJSON * const item)
 {
-    return print_string_ptr((unsigned char*)item->valuestring, p);
-}
+    if (item == NULL)
+    {
+        return false;
+    }
 
-/* Predeclare these prototypes. */
-static cJSON_bool parse_value(cJSON * const item, parse_buffer * const input_buffer);
-static cJSON_bool print_value(const cJSON * const item, printbuffer * const output_buffer);
-static cJSON_bool parse_array(cJSON * const item, parse_buffer * const input_buffer);
-static cJSON_bool print_array(const cJSON * const item, printbuffer * const output_buffer);
-static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_buffer);
-static cJSON_bool print_object(const cJSON * const item, printbuffer * const output_buffer);
+    return (item->type & 0xFF) == cJSON_Invalid;
+}
 
-/* Utility to jump whitespace and cr/lf */
-static parse_buffer *buffer_skip_whitespace(parse_buffer * const buffer)
+CJSON_PUBLIC(cJSON_bool) cJSON_IsFalse(const cJSON * const item)
 {
-    if ((buffer == NULL) || (buffer->content == NULL))
+    if (item == NULL)
     {
-        return NULL;
+        return false;
     }
 
-    if (cannot_access_at_index(buffer, 0))
+    return (item->type & 0xFF) == cJSON_False;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_IsTrue(const cJSON * const item)
+{
+    if (item == NULL)
     {
-        return buffer;
+        return false;
     }
 
-    while (can_access_at_index(buffer, 0) && (buffer_at_offset(buffer)[0] <= 32))
+    return (item->type & 0xff) == cJSON_True;
+}
+
+
+CJSON_PUBLIC(cJSON_bool) cJSON_IsBool(const cJSON * const item)
+{
+    if (item == NULL)
     {
-       buffer->offset++;
+        return false;
     }
 
-    if (buffer->offset == buffer->length)
+    return (item->type & (cJSON_True | cJSON_False)) != 0;
+}
+CJSON_PUBLIC(cJSON_bool) cJSON_IsNull(const cJSON * const item)
+{
+    if (item == NULL)
     {
-        buffer->offset--;
+        return false;
     }
 
-    return buffer;
+    return (item->type & 0xFF) == cJSON_NULL;
 }
 
-/* skip the UTF-8 BOM (byte order mark) if it is at the beginning of a buffer */
-static parse_buffer *skip_utf8_bom(parse_buffer * const buffer)
+CJSON_PUBLIC(cJSON_bool) cJSON_IsNumber(const cJSON * const item)
 {
-    if ((buffer == NULL) || (buffer->content == NULL) || (buffer->offset != 0))
+    if (item == NULL)
     {
-        return NULL;
+        return false;
     }
 
-    if (can_access_at_index(buffer, 4) && (strncmp((const char*)buffer_at_offset(buffer), "\xEF\xBB\xBF", 3) == 0))
+    return (item->type & 0xFF) == cJSON_Number;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_IsString(const cJSON * const item)
+{
+    if (item == NULL)
     {
-        buffer->offset += 3;
+        return false;
     }
 
-    return buffer;
+    return (item->type & 0xFF) == cJSON_String;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+CJSON_PUBLIC(cJSON_bool) cJSON_IsArray(const cJSON * const item)
 {
-    size_t buffer_length;
+    if (item == NULL)
+    {
+        return false;
+    }
 
-    if (NULL == value)
+    return (item->type & 0xFF) == cJSON_Array;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_IsObject(const cJSON * const item)
+{
+    if (item == NULL)
     {
-        return NULL;
+        return false;
     }
 
-    /* Adding null character size due to require_null_terminated. */
-    buffer_length = strlen(value) + sizeof("");
+    return (item->type & 0xFF) == cJSON_Object;
+}
 
-    return cJSON_ParseWithLengthOpts(value, buffer_length, return_parse_end, require_null_terminated);
+CJSON_PUBLIC(cJSON_bool) cJSON_IsRaw(const cJSON * const item)
+{
+    if (item == NULL)
+    {
+        return false;
+    }
+
+    return (item->type & 0xFF) == cJSON_Raw;
 }
 
-/* Parse an object - create a new root, and populate. */
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+CJSON_PUBLIC(cJSON_bool) cJSON_Compare(const cJSON * const a, const cJSON * const b, const cJSON_bool case_sensitive)
 {
-    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 } };
-    cJSON *item = NULL;
+    if ((a == NULL) || (b == NULL) || ((a->type & 0xFF) != (b->type & 0xFF)))
+    {
+        return false;
+    }
 
-    /* reset error position */
-    global_error.json = NULL;
-    global_error.position = 0;
+    /* check if type is valid */
+    switch (a->type & 0xFF)
+    {
+        case cJSON_False:
+        case cJSON_True:
+        case cJSON_NULL:
+        case cJSON_Number:
+        case cJSON_String:
+        case cJSON_Raw:
+        case cJSON_Array:
+        case cJSON_Object:
+            break;
 
-    if (value == NULL || 0 == buffer_length)
+        default:
+            return false;
+    }
+
+    /* identical objects are equal */
+    if (a == b)
     {
-        goto fail;
+        return true;
     }
 
-    buffer.content = (const unsigned char*)value;
-    buffer.length = buffer_length;
-    buffer.offset = 0;
-    buffer.hooks = global_hooks;
+    switch (a->type & 0xFF)
+    {
+        /* in these cases and equal type is enough */
+        case cJSON_False:
+        case cJSON_True:
+        case cJSON_NULL:
+            return true;
 
-    item = cJSON_New_Item(&global_hooks);
-    if (item == NULL) /* memory fail */
+        case cJSON_Number:
+            if (compare_double(a->valuedouble, b->valuedouble))
+            {
+                return true;
+            }
+            return false;
+
+        case cJSON_String:
+        case cJSON_Raw:
+            if ((a->valuestring == NULL) || (b->valuestring == NULL))
+            {
+                return false;
+            }
+            if (strcmp(a->valuestring, b->valuestring) == 0)
+            {
+                return true;
+            }
+
+            return false;
+
+        case cJSON_Array:
+        {
+            cJSON *a_element = a->child;
+            cJSON *b_element = b->child;
+
+            for (; (a_element != NULL) && (b_element != NULL);)
+            {
+                if (!cJSON_Compare(a_element, b_element, case_sensitive))
+                {
+                    return false;
+                }
+
+                a_element = a_element->next;
+                b_element = b_element->next;
+            }
+
+            /* one of the arrays is longer than the other */
+            if (a_element != b_element) {
+                return false;
+            }
+
+            return true;
+        }
+
+        case cJSON_Object:
+        {
+            cJSON *a_element = NULL;
+            cJSON *b_element = NULL;
+            cJSON_ArrayForEach(a_element, a)
+            {
+                /* TODO This has O(n^2) runtime, which is horrible! */
+                b_element = get_object_item(b, a_element->string, case_sensitive);
+                if (b_element == NULL)
+                {
+                    return false;
+                }
+
+                if (!cJSON_Compare(a_element, b_element, case_sensitive))
+                {
+                    return false;
+                }
+            }
+
+            /* doing this twice, once on a and b to prevent true comparison if a subset of b
+             * TODO: Do this the proper way, this is just a fix for now */
+            cJSON_ArrayForEach(b_element, b)
+            {
+                a_element = get_object_item(a, b_element->string, case_sensitive);
+                if (a_element == NULL)
+                {
+                    return false;
+                }
+
+                if (!cJSON_Compare(b_element, a_element, case_sensitive))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/* resize a buffer of which used bytes are in use, also with hooks that don't provide realloc */
+static void *reallocate_with_hooks(const internal_hooks * const hooks, void *pointer, const size_t used, const size_t size)
+{
+    void *resized = NULL;
+
+    if (hooks->reallocate != NULL)
     {
-        goto fail;
+        return hooks->reallocate(pointer, size);
     }
 
-    if (!parse_value(item, buffer_skip_whitespace(skip_utf8_bom(&buffer))))
+    resized = hooks->allocate(size);
+    if (resized == NULL)
     {
-        /* parse failure. ep is set. */
-        goto fail;
+        return NULL;
+    }
+    if (pointer != NULL)
+    {
+        memcpy(resized, pointer, used);
+        hooks->deallocate(pointer);
     }
 
-    /* if we require null-terminated JSON without appended garbage, skip and then check for a null terminator */
-    if (require_null_terminated)
+    return resized;
+}
+
+/* On-demand parsing. A first pass only records where each value starts in a flat tape, values are
+ * parsed when a cursor reaches them. Every value, object key and closing bracket gets one entry. */
+typedef struct
+{
+    size_t start; /* offset of the first character */
+    size_t next; /* entry following the value, while a container is still open its parent instead */
+} document_entry;
+
+struct cJSON_Document
+{
+    const unsigned char *content;
+    size_t length;
+    document_entry *entries;
+    size_t count;
+    size_t capacity;
+    internal_hooks hooks;
+};
+
+typedef enum
+{
+    document_value,
+    document_value_or_end,
+    document_key_or_end,
+    document_key,
+    document_colon,
+    document_comma_or_end
+} document_state;
+
+static cJSON_bool document_add_entry(cJSON_Document * const document, const size_t start)
+{
+    document_entry *entries = NULL;
+
+    if (document->count == document->capacity)
     {
-        buffer_skip_whitespace(&buffer);
-        if ((buffer.offset >= buffer.length) || buffer_at_offset(&buffer)[0] != '\0')
+        const size_t capacity = (document->capacity > 0) ? (document->capacity * 2) : ((document->length / 8) + 16);
+        if (capacity > (((size_t)-1) / sizeof(document_entry)))
         {
-            goto fail;
+            return false;
         }
-    }
-    if (return_parse_end)
-    {
-        *return_parse_end = (const char*)buffer_at_offset(&buffer);
+
+        entries = (document_entry*)reallocate_with_hooks(&document->hooks, document->entries, document->count * sizeof(document_entry), capacity * sizeof(document_entry));
+        if (entries == NULL)
+        {
+            return false;
+        }
+        document->entries = entries;
+        document->capacity = capacity;
     }
 
-    return item;
+    document->entries[document->count].start = start;
+    document->entries[document->count].next = document->count + 1;
+    document->count++;
 
-fail:
-    if (item != NULL)
-    {
-        cJSON_Delete(item);
-    }
+    return true;
+}
 
-    if (value != NULL)
-    {
-        error local_error;
-        local_error.json = (const unsigned char*)value;
-        local_error.position = 0;
+/* length of a string including the quotes, 0 if it isn't terminated */
+static size_t document_string_length(const unsigned char * const input, const size_t length)
+{
+    size_t position = 1;
 
-        if (buffer.offset < buffer.length)
-        {
-            local_error.position = buffer.offset;
-        }
-        else if (buffer.length > 0)
+    while (position < length)
+    {
+        position += string_span_length(input + position, length - position);
+        if (position >= length)
         {
-            local_error.position = buffer.length - 1;
+            break;
         }
-
-        if (return_parse_end != NULL)
+        if (input[position] == '\"')
         {
-            *return_parse_end = (const char*)local_error.json + local_error.position;
+            return position + 1;
         }
-
-        global_error = local_error;
+        /* skip the escaped character */
+        position += 2;
     }
 
-    return NULL;
+    return 0;
 }
 
-/* Default options for cJSON_Parse */
-CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
+/* length of the characters that can make up a number, like in parse_number */
+static size_t document_number_length(const unsigned char * const input, const size_t length)
 {
-    return cJSON_ParseWithOpts(value, 0, 0);
-}
+    size_t position = 0;
 
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithLength(const char *value, size_t buffer_length)
-{
-    return cJSON_ParseWithLengthOpts(value, buffer_length, 0, 0);
-}
+    while (position < length)
+    {
+        if ((input[position] >= '0') && (input[position] <= '9'))
+        {
+            position++;
+            continue;
+        }
 
-#define cjson_min(a, b) (((a) < (b)) ? (a) : (b))
+        switch (input[position])
+        {
+            case '+': case '-': case 'e': case 'E': case '.':
+                position++;
+                break;
 
-static unsigned char *print(const cJSON * const item, cJSON_bool format, const internal_hooks * const hooks)
-{
-    static const size_t default_buffer_size = 256;
-    printbuffer buffer[1];
-    unsigned char *printed = NULL;
+            default:
+                return position;
+        }
+    }
 
-    memset(buffer, 0, sizeof(buffer));
+    return position;
+}
 
-    /* create buffer */
-    buffer->buffer = (unsigned char*) hooks->allocate(default_buffer_size);
-    buffer->length = default_buffer_size;
-    buffer->format = format;
-    buffer->hooks = *hooks;
-    if (buffer->buffer == NULL)
-    {
-        goto fail;
-    }
+/* record the values of the top level value in the tape */
+static cJSON_bool document_build(cJSON_Document * const document)
+{
+    const unsigned char * const content = document->content;
+    const size_t length = document->length;
+    document_state state = document_value;
+    size_t position = 0;
+    size_t depth = 0;
+    /* innermost open container */
+    size_t open = 0;
 
-    /* print the value */
-    if (!print_value(item, buffer))
+    for (;;)
     {
-        goto fail;
-    }
-    update_offset(buffer);
+        unsigned char character = 0;
+        size_t token_length = 0;
 
-    /* check if reallocate is available */
-    if (hooks->reallocate != NULL)
-    {
-        printed = (unsigned char*) hooks->reallocate(buffer->buffer, buffer->offset + 1);
-        if (printed == NULL) {
-            goto fail;
+        if ((position < length) && (content[position] <= 32))
+        {
+            position += whitespace_length(content + position, length - position);
         }
-        buffer->buffer = NULL;
-    }
-    else /* otherwise copy the JSON over to a new buffer */
-    {
-        printed = (unsigned char*) hooks->allocate(buffer->offset + 1);
-        if (printed == NULL)
+        if (position >= length)
         {
-            goto fail;
+            return false; /* unexpected end of the input */
         }
-        memcpy(printed, buffer->buffer, cjson_min(buffer->length, buffer->offset + 1));
-        printed[buffer->offset] = '\0'; /* just to be sure */
+        character = content[position];
 
-        /* free the buffer */
-        hooks->deallocate(buffer->buffer);
-        buffer->buffer = NULL;
-    }
+        if (((character == ']') && ((state == document_value_or_end) || (state == document_comma_or_end)))
+            || ((character == '}') && ((state == document_key_or_end) || (state == document_comma_or_end))))
+        {
+            /* the closing bracket has to match the container */
+            const size_t parent = document->entries[open].next;
+            if ((character - content[document->entries[open].start]) != 2)
+            {
+                return false;
+            }
+            if (!document_add_entry(document, position))
+            {
+                return false;
+            }
+            document->entries[open].next = document->count;
+            open = parent;
+            position++;
+            depth--;
+            if (depth == 0)
+            {
+                return true;
+            }
+            state = document_comma_or_end;
+            continue;
+        }
 
-    return printed;
+        switch (state)
+        {
+            case document_value:
+            case document_value_or_end:
+                if (!document_add_entry(document, position))
+                {
+                    return false;
+                }
+                if ((character == '{') || (character == '['))
+                {
+                    if (depth >= CJSON_NESTING_LIMIT)
+                    {
+                        return false; /* to deeply nested */
+                    }
+                    /* remember the parent until the container is closed */
+                    document->entries[document->count - 1].next = open;
+                    open = document->count - 1;
+                    depth++;
+                    position++;
+                    state = (character == '{') ? document_key_or_end : document_value_or_end;
+                    continue;
+                }
 
-fail:
-    if (buffer->buffer != NULL)
-    {
-        hooks->deallocate(buffer->buffer);
-        buffer->buffer = NULL;
-    }
+                if (character == '\"')
+                {
+                    token_length = document_string_length(content + position, length - position);
+                }
+                else if (character == 't')
+                {
+                    token_length = ((length - position) >= 4) && (strncmp((const char*)content + position, "true", 4) == 0) ? 4 : 0;
+                }
+                else if (character == 'f')
+                {
+                    token_length = ((length - position) >= 5) && (strncmp((const char*)content + position, "false", 5) == 0) ? 5 : 0;
+                }
+                else if (character == 'n')
+                {
+                    token_length = ((length - position) >= 4) && (strncmp((const char*)content + position, "null", 4) == 0) ? 4 : 0;
+                }
+                else if ((character == '-') || ((character >= '0') && (character <= '9')))
+                {
+                    /* the digits are only checked when the number is read */
+                    token_length = document_number_length(content + position, length - position);
+                }
+                if (token_length == 0)
+                {
+                    return false;
+                }
+                position += token_length;
+                if (depth == 0)
+                {
+                    return true;
+                }
+                /* most values are directly followed by a comma */
+                if ((position < length) && (content[position] == ','))
+                {
+                    position++;
+                    state = (content[document->entries[open].start] == '{') ? document_key : document_value;
+                }
+                else
+                {
+                    state = document_comma_or_end;
+                }
+                break;
 
-    if (printed != NULL)
-    {
-        hooks->deallocate(printed);
-        printed = NULL;
-    }
+            case document_key_or_end:
+            case document_key:
+                token_length = (character == '\"') ? document_string_length(content + position, length - position) : 0;
+                if ((token_length == 0) || !document_add_entry(document, position))
+                {
+                    return false;
+                }
+                position += token_length;
+                state = document_colon;
+                break;
 
-    return NULL;
-}
+            case document_colon:
+                if (character != ':')
+                {
+                    return false;
+                }
+                position++;
+                state = document_value;
+                break;
 
-/* Render a cJSON item/entity/structure to text. */
-CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item)
-{
-    return (char*)print(item, true, &global_hooks);
-}
+            case document_comma_or_end:
+                if (character != ',')
+                {
+                    return false;
+                }
+                position++;
+                state = (content[document->entries[open].start] == '{') ? document_key : document_value;
+                break;
 
-CJSON_PUBLIC(char *) cJSON_PrintUnformatted(const cJSON *item)
-{
-    return (char*)print(item, false, &global_hooks);
+            default:
+                return false;
+        }
+    }
 }
 
-CJSON_PUBLIC(char *) cJSON_PrintBuffered(const cJSON *item, int prebuffer, cJSON_bool fmt)
+CJSON_PUBLIC(cJSON_Document *) cJSON_ParseDocumentWithLength(const char *value, size_t buffer_length)
 {
-    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 } };
+    cJSON_Document *document = NULL;
 
-    if (prebuffer < 0)
+    if ((value == NULL) || (buffer_length == 0))
     {
         return NULL;
     }
 
-    p.buffer = (unsigned char*)global_hooks.allocate((size_t)prebuffer);
-    if (!p.buffer)
+    document = (cJSON_Document*)global_hooks.allocate(sizeof(cJSON_Document));
+    if (document == NULL)
     {
         return NULL;
     }
+    memset(document, '\0', sizeof(cJSON_Document));
+    document->content = (const unsigned char*)value;
+    document->length = buffer_length;
+    document->hooks = global_hooks;
 
-    p.length = (size_t)prebuffer;
-    p.offset = 0;
-    p.noalloc = false;
-    p.format = fmt;
-    p.hooks = global_hooks;
+    /* skip UTF-8 BOM */
+    if ((buffer_length >= 3) && (strncmp(value, "\xEF\xBB\xBF", 3) == 0))
+    {
+        document->content += 3;
+        document->length -= 3;
+    }
 
-    if (!print_value(item, &p))
+    if (!document_build(document))
     {
-        global_hooks.deallocate(p.buffer);
-        p.buffer = NULL;
+        cJSON_DeleteDocument(document);
         return NULL;
     }
 
-    return (char*)p.buffer;
+    return document;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_PrintPreallocated(cJSON *item, char *buffer, const int length, const cJSON_bool format)
+CJSON_PUBLIC(cJSON_Document *) cJSON_ParseDocument(const char *value)
 {
-    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 } };
-
-    if ((length < 0) || (buffer == NULL))
+    if (value == NULL)
     {
-        return false;
+        return NULL;
     }
 
-    p.buffer = (unsigned char*)buffer;
-    p.length = (size_t)length;
-    p.offset = 0;
-    p.noalloc = true;
-    p.format = format;
-    p.hooks = global_hooks;
-
-    return print_value(item, &p);
+    return cJSON_ParseDocumentWithLength(value, strlen(value));
 }
 
-/* Parser core - when encountering text, process appropriately. */
-static cJSON_bool parse_value(cJSON * const item, parse_buffer * const input_buffer)
+CJSON_PUBLIC(void) cJSON_DeleteDocument(cJSON_Document *document)
 {
-    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    if (document == NULL)
     {
-        return false; /* no input */
+        return;
     }
 
-    /* parse the different types of values */
-    /* null */
-    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "null", 4) == 0))
-    {
-        item->type = cJSON_NULL;
-        input_buffer->offset += 4;
-        return true;
-    }
-    /* false */
-    if (can_read(input_buffer, 5) && (strncmp((const char*)buffer_at_offset(input_buffer), "false", 5) == 0))
-    {
-        item->type = cJSON_False;
-        input_buffer->offset += 5;
-        return true;
-    }
-    /* true */
-    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "true", 4) == 0))
-    {
-        item->type = cJSON_True;
-        item->valueint = 1;
-        input_buffer->offset += 4;
-        return true;
-    }
-    /* string */
-    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '\"'))
-    {
-        return parse_string(item, input_buffer);
-    }
-    /* number */
-    if (can_access_at_index(input_buffer, 0) && ((buffer_at_offset(input_buffer)[0] == '-') || ((buffer_at_offset(input_buffer)[0] >= '0') && (buffer_at_offset(input_buffer)[0] <= '9'))))
-    {
-        return parse_number(item, input_buffer);
-    }
-    /* array */
-    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '['))
+    if (document->entries != NULL)
     {
-        return parse_array(item, input_buffer);
+        document->hooks.deallocate(document->entries);
     }
-    /* object */
-    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '{'))
+    document->hooks.deallocate(document);
+}
+
+CJSON_PUBLIC(size_t) cJSON_GetDocumentMemory(const cJSON_Document *document)
+{
+    if (document == NULL)
     {
-        return parse_object(item, input_buffer);
+        return 0;
     }
 
-    return false;
+    return sizeof(cJSON_Document) + (document->capacity * sizeof(document_entry));
+}
+
+static cJSON_Cursor invalid_cursor(void)
+{
+    cJSON_Cursor cursor;
+
+    cursor.document = NULL;
+    cursor.entry = 0;
+
+    return cursor;
+}
+
+static cJSON_Cursor make_cursor(const cJSON_Document * const document, const size_t entry)
+{
+    cJSON_Cursor cursor;
+
+    cursor.document = document;
+    cursor.entry = entry;
+
+    return cursor;
 }
 
-/* Render a value to text. */
-static cJSON_bool print_value(const cJSON * const item, printbuffer * const output_buffer)
+static unsigned char cursor_character(const cJSON_Cursor cursor)
 {
-    unsigned char *output = NULL;
+    return cursor.document->content[cursor.document->entries[cursor.entry].start];
+}
 
-    if ((item == NULL) || (output_buffer == NULL))
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetDocumentRoot(const cJSON_Document *document)
+{
+    if (document == NULL)
     {
-        return false;
+        return invalid_cursor();
     }
 
-    switch ((item->type) & 0xFF)
-    {
-        case cJSON_NULL:
-            output = ensure(output_buffer, 5);
-            if (output == NULL)
-            {
-                return false;
-            }
-            strcpy((char*)output, "null");
-            return true;
-
-        case cJSON_False:
-            output = ensure(output_buffer, 6);
-            if (output == NULL)
-            {
-                return false;
-            }
-            strcpy((char*)output, "false");
-            return true;
+    return make_cursor(document, 0);
+}
 
-        case cJSON_True:
-            output = ensure(output_buffer, 5);
-            if (output == NULL)
-            {
-                return false;
-            }
-            strcpy((char*)output, "true");
-            return true;
+CJSON_PUBLIC(int) cJSON_GetCursorType(const cJSON_Cursor cursor)
+{
+    if (cursor.document == NULL)
+    {
+        return cJSON_Invalid;
+    }
 
-        case cJSON_Number:
-            return print_number(item, output_buffer);
+    switch (cursor_character(cursor))
+    {
+        case '{':
+            return cJSON_Object;
+        case '[':
+            return cJSON_Array;
+        case '\"':
+            return cJSON_String;
+        case 't':
+            return cJSON_True;
+        case 'f':
+            return cJSON_False;
+        case 'n':
+            return cJSON_NULL;
+        default:
+            return cJSON_Number;
+    }
+}
 
-        case cJSON_Raw:
+/* compare an object key in the tape to a '\0' terminated string */
+static cJSON_bool document_key_equals(const cJSON_Document * const document, const size_t entry, const char * const string, const cJSON_bool case_sensitive)
+{
+    const unsigned char *key = document->content + document->entries[entry].start + 1;
+    const size_t available = document->length - document->entries[entry].start - 1;
+    const size_t key_length = string_span_length(key, available);
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
+    cJSON decoded;
+    cJSON_bool equal = false;
+    size_t index = 0;
+
+    if (key[key_length] == '\"')
+    {
+        /* no escape sequences, compare in place */
+        for (index = 0; index < key_length; index++)
         {
-            size_t raw_length = 0;
-            if (item->valuestring == NULL)
-            {
-                return false;
-            }
-
-            raw_length = strlen(item->valuestring) + sizeof("");
-            output = ensure(output_buffer, raw_length);
-            if (output == NULL)
+            if ((string[index] == '\0')
+                || (case_sensitive ? (key[index] != (unsigned char)string[index])
+                    : (tolower(key[index]) != tolower((unsigned char)string[index]))))
             {
                 return false;
             }
-            memcpy(output, item->valuestring, raw_length);
-            return true;
         }
+        return string[key_length] == '\0';
+    }
 
-        case cJSON_String:
-            return print_string(item, output_buffer);
-
-        case cJSON_Array:
-            return print_array(item, output_buffer);
-
-        case cJSON_Object:
-            return print_object(item, output_buffer);
-
-        default:
-            return false;
+    buffer.content = document->content;
+    buffer.length = document->length;
+    buffer.offset = document->entries[entry].start;
+    buffer.hooks = document->hooks;
+    memset(&decoded, '\0', sizeof(decoded));
+    if (!parse_string(&decoded, &buffer))
+    {
+        return false;
     }
+    equal = case_sensitive ? (strcmp(decoded.valuestring, string) == 0)
+        : (case_insensitive_strcmp((const unsigned char*)decoded.valuestring, (const unsigned char*)string) == 0);
+    document->hooks.deallocate(decoded.valuestring);
+
+    return equal;
 }
 
-/* Build an array from input text. */
-static cJSON_bool parse_array(cJSON * const item, parse_buffer * const input_buffer)
+static cJSON_Cursor get_cursor_object_item(const cJSON_Cursor object, const char * const name, const cJSON_bool case_sensitive)
 {
-    cJSON *head = NULL; /* head of the linked list */
-    cJSON *current_item = NULL;
+    const document_entry *entries = NULL;
+    size_t entry = 0;
 
-    if (input_buffer->depth >= CJSON_NESTING_LIMIT)
+    if ((name == NULL) || (cJSON_GetCursorType(object) != cJSON_Object))
     {
-        return false; /* to deeply nested */
+        return invalid_cursor();
     }
-    input_buffer->depth++;
 
-    if (buffer_at_offset(input_buffer)[0] != '[')
+    entries = object.document->entries;
+    for (entry = object.entry + 1; object.document->content[entries[entry].start] != '}'; entry = entries[entry + 1].next)
     {
-        /* not an array */
-        goto fail;
+        if (document_key_equals(object.document, entry, name, case_sensitive))
+        {
+            return make_cursor(object.document, entry + 1);
+        }
     }
 
-    input_buffer->offset++;
-    buffer_skip_whitespace(input_buffer);
-    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ']'))
-    {
-        /* empty array */
-        goto success;
-    }
+    return invalid_cursor();
+}
 
-    /* check if we skipped to the end of the buffer */
-    if (cannot_access_at_index(input_buffer, 0))
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorObjectItem(const cJSON_Cursor object, const char *string)
+{
+    return get_cursor_object_item(object, string, false);
+}
+
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorObjectItemCaseSensitive(const cJSON_Cursor object, const char *string)
+{
+    return get_cursor_object_item(object, string, true);
+}
+
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorArrayItem(const cJSON_Cursor array, int index)
+{
+    size_t entry = 0;
+
+    if ((index < 0) || (cJSON_GetCursorType(array) != cJSON_Array))
     {
-        input_buffer->offset--;
-        goto fail;
+        return invalid_cursor();
     }
 
-    /* step back to character in front of the first element */
-    input_buffer->offset--;
-    /* loop through the comma separated array elements */
-    do
+    /* hop over the preceding values without looking into them */
+    for (entry = array.entry + 1; array.document->content[array.document->entries[entry].start] != ']'; entry = array.document->entries[entry].next)
     {
-        /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
-        if (new_item == NULL)
+        if (index == 0)
         {
-            goto fail; /* allocation failure */
+            return make_cursor(array.document, entry);
         }
+        index--;
+    }
 
-        /* attach next item to list */
-        if (head == NULL)
-        {
-            /* start the linked list */
-            current_item = head = new_item;
-        }
-        else
-        {
-            /* add to the end and advance */
-            current_item->next = new_item;
-            new_item->prev = current_item;
-            current_item = new_item;
-        }
+    return invalid_cursor();
+}
 
-        /* parse next value */
-        input_buffer->offset++;
-        buffer_skip_whitespace(input_buffer);
-        if (!parse_value(current_item, input_buffer))
-        {
-            goto fail; /* failed to parse value */
-        }
-        buffer_skip_whitespace(input_buffer);
-    }
-    while (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','));
+CJSON_PUBLIC(int) cJSON_GetCursorArraySize(const cJSON_Cursor array)
+{
+    size_t entry = 0;
+    size_t size = 0;
 
-    if (cannot_access_at_index(input_buffer, 0) || buffer_at_offset(input_buffer)[0] != ']')
+    if (cJSON_GetCursorType(array) != cJSON_Array)
     {
-        goto fail; /* expected end of array */
+        return 0;
     }
 
-success:
-    input_buffer->depth--;
-
-    if (head != NULL) {
-        head->prev = current_item;
+    for (entry = array.entry + 1; array.document->content[array.document->entries[entry].start] != ']'; entry = array.document->entries[entry].next)
+    {
+        size++;
     }
 
-    item->type = cJSON_Array;
-    item->child = head;
+    /* FIXME: Can overflow here. Cannot be fixed without breaking the API */
 
-    input_buffer->offset++;
+    return (int)size;
+}
 
-    return true;
+CJSON_PUBLIC(double) cJSON_GetCursorNumberValue(const cJSON_Cursor cursor)
+{
+    const unsigned char *input = NULL;
+    size_t available = 0;
+    size_t token_length = 0;
+    double number = 0;
 
-fail:
-    if (head != NULL)
+    if (cJSON_GetCursorType(cursor) != cJSON_Number)
     {
-        cJSON_Delete(head);
+        return (double) NAN;
     }
 
-    return false;
+    input = cursor.document->content + cursor.document->entries[cursor.entry].start;
+    available = cursor.document->length - cursor.document->entries[cursor.entry].start;
+    token_length = document_number_length(input, available);
+    if (parse_decimal(input, token_length, &number) == 0)
+    {
+        return (double) NAN;
+    }
+
+    return number;
 }
 
-/* Render an array to text */
-static cJSON_bool print_array(const cJSON * const item, printbuffer * const output_buffer)
+CJSON_PUBLIC(cJSON *) cJSON_MaterializeCursor(const cJSON_Cursor cursor)
 {
-    unsigned char *output_pointer = NULL;
-    size_t length = 0;
-    cJSON *current_element = item->child;
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
+    cJSON *item = NULL;
 
-    if (output_buffer == NULL)
+    if (cursor.document == NULL)
     {
-        return false;
+        return NULL;
     }
 
-    /* Compose the output array. */
-    /* opening square bracket */
-    output_pointer = ensure(output_buffer, 1);
-    if (output_pointer == NULL)
+    buffer.content = cursor.document->content;
+    buffer.length = cursor.document->length;
+    buffer.offset = cursor.document->entries[cursor.entry].start;
+    buffer.hooks = global_hooks;
+    buffer.nesting_limit = global_context.nesting_limit;
+
+    item = cJSON_New_Item(&global_hooks);
+    if (item == NULL)
     {
-        return false;
+        return NULL;
+    }
+
+    if (!parse_value(item, &buffer))
+    {
+        cJSON_Delete(item);
+        return NULL;
     }
 
-    *output_pointer = '[';
-    output_buffer->offset++;
-    output_buffer->depth++;
+    return item;
+}
+
+/* Incremental (push) parser. The input is fed in arbitrary chunks and reported through callbacks,
+ * only the string or number currently being read is buffered. */
+typedef enum
+{
+    stream_value,           /* expecting a value */
+    stream_value_or_end,    /* after '[' */
+    stream_key_or_end,      /* after '{' */
+    stream_key,             /* after ',' in an object */
+    stream_colon,           /* after a key */
+    stream_after_value,     /* expecting ',' or the end of the container */
+    stream_string,
+    stream_string_escape,   /* after a backslash */
+    stream_string_unicode,  /* collecting \uXXXX or \uXXXX\uXXXX */
+    stream_number,
+    stream_literal,         /* true, false or null */
+    stream_done,            /* top level value complete, only whitespace may follow */
+    stream_error
+} stream_state;
+
+struct cJSON_StreamParser
+{
+    cJSON_StreamCallbacks callbacks;
+    void *user_data;
+    internal_hooks hooks;
+    stream_state state;
+    /* one bit per nesting level, set for objects */
+    unsigned char containers[(CJSON_NESTING_LIMIT + 7) / 8];
+    size_t depth;
+    cJSON_bool string_is_key;
+    /* string or number being read */
+    unsigned char *token;
+    size_t token_length;
+    size_t token_capacity;
+    /* raw unicode escape sequence being read */
+    unsigned char escape[12];
+    size_t escape_length;
+    const char *literal;
+    size_t literal_position;
+    /* bytes of the stream consumed so far */
+    size_t offset;
+    size_t error_offset;
+};
+
+CJSON_PUBLIC(cJSON_StreamParser *) cJSON_CreateStreamParser(const cJSON_StreamCallbacks *callbacks, void *user_data)
+{
+    cJSON_StreamParser *parser = NULL;
 
-    while (current_element != NULL)
+    if (callbacks == NULL)
     {
-        if (!print_value(current_element, output_buffer))
-        {
-            return false;
-        }
-        update_offset(output_buffer);
-        if (current_element->next)
-        {
-            length = (size_t) (output_buffer->format ? 2 : 1);
-            output_pointer = ensure(output_buffer, length + 1);
-            if (output_pointer == NULL)
-            {
-                return false;
-            }
-            *output_pointer++ = ',';
-            if(output_buffer->format)
-            {
-                *output_pointer++ = ' ';
-            }
-            *output_pointer = '\0';
-            output_buffer->offset += length;
-        }
-        current_element = current_element->next;
+        return NULL;
     }
 
-    output_pointer = ensure(output_buffer, 2);
-    if (output_pointer == NULL)
+    parser = (cJSON_StreamParser*)global_hooks.allocate(sizeof(cJSON_StreamParser));
+    if (parser == NULL)
     {
-        return false;
+        return NULL;
     }
-    *output_pointer++ = ']';
-    *output_pointer = '\0';
-    output_buffer->depth--;
+    memset(parser, '\0', sizeof(cJSON_StreamParser));
+    parser->callbacks = *callbacks;
+    parser->user_data = user_data;
+    parser->hooks = global_hooks;
+    parser->state = stream_value;
 
-    return true;
+    return parser;
 }
 
-/* Build an object from the text. */
-static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_buffer)
+CJSON_PUBLIC(void) cJSON_ResetStreamParser(cJSON_StreamParser *parser)
 {
-    cJSON *head = NULL; /* linked list head */
-    cJSON *current_item = NULL;
-
-    if (input_buffer->depth >= CJSON_NESTING_LIMIT)
+    if (parser == NULL)
     {
-        return false; /* to deeply nested */
+        return;
     }
-    input_buffer->depth++;
 
-    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != '{'))
+    parser->state = stream_value;
+    parser->depth = 0;
+    parser->token_length = 0;
+    parser->offset = 0;
+    parser->error_offset = 0;
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteStreamParser(cJSON_StreamParser *parser)
+{
+    if (parser == NULL)
     {
-        goto fail; /* not an object */
+        return;
     }
 
-    input_buffer->offset++;
-    buffer_skip_whitespace(input_buffer);
-    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '}'))
+    if (parser->token != NULL)
     {
-        goto success; /* empty object */
+        parser->hooks.deallocate(parser->token);
     }
+    parser->hooks.deallocate(parser);
+}
 
-    /* check if we skipped to the end of the buffer */
-    if (cannot_access_at_index(input_buffer, 0))
+CJSON_PUBLIC(size_t) cJSON_GetStreamParserErrorOffset(const cJSON_StreamParser *parser)
+{
+    return (parser != NULL) ? parser->error_offset : 0;
+}
+
+/* make room for needed more bytes (plus a terminating '\0') in the token buffer */
+static cJSON_bool stream_reserve(cJSON_StreamParser * const parser, const size_t needed)
+{
+    unsigned char *grown = NULL;
+    size_t capacity = 0;
+
+    if ((parser->token_length + needed + 1) <= parser->token_capacity)
     {
-        input_buffer->offset--;
-        goto fail;
+        return true;
     }
 
-    /* step back to character in front of the first element */
-    input_buffer->offset--;
-    /* loop through the comma separated array elements */
-    do
+    capacity = (parser->token_capacity > 0) ? parser->token_capacity : 64;
+    while (capacity < (parser->token_length + needed + 1))
     {
-        /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
-        if (new_item == NULL)
+        if (capacity > (((size_t)-1) / 2))
         {
-            goto fail; /* allocation failure */
+            return false;
         }
+        capacity *= 2;
+    }
 
-        /* attach next item to list */
-        if (head == NULL)
-        {
-            /* start the linked list */
-            current_item = head = new_item;
-        }
-        else
-        {
-            /* add to the end and advance */
-            current_item->next = new_item;
-            new_item->prev = current_item;
-            current_item = new_item;
-        }
+    grown = (unsigned char*)reallocate_with_hooks(&parser->hooks, parser->token, parser->token_length, capacity);
+    if (grown == NULL)
+    {
+        return false;
+    }
+    parser->token = grown;
+    parser->token_capacity = capacity;
 
-        if (cannot_access_at_index(input_buffer, 1))
-        {
-            goto fail; /* nothing comes after the comma */
-        }
+    return true;
+}
 
-        /* parse the name of the child */
-        input_buffer->offset++;
-        buffer_skip_whitespace(input_buffer);
-        if (!parse_string(current_item, input_buffer))
-        {
-            goto fail; /* failed to parse name */
-        }
-        buffer_skip_whitespace(input_buffer);
+static cJSON_bool stream_append(cJSON_StreamParser * const parser, const unsigned char * const data, const size_t length)
+{
+    if (!stream_reserve(parser, length))
+    {
+        return false;
+    }
+    memcpy(parser->token + parser->token_length, data, length);
+    parser->token_length += length;
 
-        /* swap valuestring and string, because we parsed the name */
-        current_item->string = current_item->valuestring;
-        current_item->valuestring = NULL;
+    return true;
+}
 
-        if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != ':'))
-        {
-            goto fail; /* invalid object */
-        }
+/* a complete value has been read */
+static void stream_value_done(cJSON_StreamParser * const parser)
+{
+    parser->state = (parser->depth == 0) ? stream_done : stream_after_value;
+}
 
-        /* parse the value */
-        input_buffer->offset++;
-        buffer_skip_whitespace(input_buffer);
-        if (!parse_value(current_item, input_buffer))
-        {
-            goto fail; /* failed to parse value */
-        }
-        buffer_skip_whitespace(input_buffer);
+static cJSON_bool stream_in_object(const cJSON_StreamParser * const parser)
+{
+    return (parser->depth > 0) && ((parser->containers[(parser->depth - 1) / 8] >> ((parser->depth - 1) % 8)) & 1);
+}
+
+static cJSON_bool stream_push(cJSON_StreamParser * const parser, const cJSON_bool object)
+{
+    const unsigned char bit = (unsigned char)(1 << (parser->depth % 8));
+
+    if (parser->depth >= CJSON_NESTING_LIMIT)
+    {
+        return false; /* to deeply nested */
     }
-    while (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','));
 
-    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != '}'))
+    if (object)
+    {
+        parser->containers[parser->depth / 8] |= bit;
+    }
+    else
     {
-        goto fail; /* expected end of object */
+        parser->containers[parser->depth / 8] &= (unsigned char)~bit;
     }
+    parser->depth++;
 
-success:
-    input_buffer->depth--;
+    return object ? ((parser->callbacks.start_object == NULL) || parser->callbacks.start_object(parser->user_data))
+        : ((parser->callbacks.start_array == NULL) || parser->callbacks.start_array(parser->user_data));
+}
+
+static cJSON_bool stream_pop(cJSON_StreamParser * const parser)
+{
+    const cJSON_bool object = stream_in_object(parser);
 
-    if (head != NULL) {
-        head->prev = current_item;
-    }
+    parser->depth--;
+    stream_value_done(parser);
 
-    item->type = cJSON_Object;
-    item->child = head;
+    return object ? ((parser->callbacks.end_object == NULL) || parser->callbacks.end_object(parser->user_data))
+        : ((parser->callbacks.end_array == NULL) || parser->callbacks.end_array(parser->user_data));
+}
 
-    input_buffer->offset++;
-    return true;
+static cJSON_bool stream_finish_string(cJSON_StreamParser * const parser)
+{
+    parser->token[parser->token_length] = '\0';
 
-fail:
-    if (head != NULL)
+    if (parser->string_is_key)
     {
-        cJSON_Delete(head);
+        parser->state = stream_colon;
+        return (parser->callbacks.key == NULL) || parser->callbacks.key(parser->user_data, (const char*)parser->token, parser->token_length);
     }
 
-    return false;
+    stream_value_done(parser);
+    return (parser->callbacks.string == NULL) || parser->callbacks.string(parser->user_data, (const char*)parser->token, parser->token_length);
 }
 
-/* Render an object to text. */
-static cJSON_bool print_object(const cJSON * const item, printbuffer * const output_buffer)
+static cJSON_bool stream_finish_number(cJSON_StreamParser * const parser)
 {
-    unsigned char *output_pointer = NULL;
-    size_t length = 0;
-    cJSON *current_item = item->child;
+    double number = 0;
 
-    if (output_buffer == NULL)
+    if (parse_decimal(parser->token, parser->token_length, &number) != parser->token_length)
     {
         return false;
     }
 
-    /* Compose the output: */
-    length = (size_t) (output_buffer->format ? 2 : 1); /* fmt: {\n */
-    output_pointer = ensure(output_buffer, length + 1);
-    if (output_pointer == NULL)
-    {
-        return false;
-    }
+    stream_value_done(parser);
+    return (parser->callbacks.number == NULL) || parser->callbacks.number(parser->user_data, number);
+}
+
+static cJSON_bool stream_finish_literal(cJSON_StreamParser * const parser)
+{
+    stream_value_done(parser);
 
-    *output_pointer++ = '{';
-    output_buffer->depth++;
-    if (output_buffer->format)
+    if (parser->literal[0] == 'n')
     {
-        *output_pointer++ = '\n';
+        return (parser->callbacks.null == NULL) || parser->callbacks.null(parser->user_data);
     }
-    output_buffer->offset += length;
 
-    while (current_item)
-    {
-        if (output_buffer->format)
-        {
-            size_t i;
-            output_pointer = ensure(output_buffer, output_buffer->depth);
-            if (output_pointer == NULL)
-            {
-                return false;
-            }
-            for (i = 0; i < output_buffer->depth; i++)
-            {
-                *output_pointer++ = '\t';
-            }
-            output_buffer->offset += output_buffer->depth;
-        }
+    return (parser->callbacks.boolean == NULL) || parser->callbacks.boolean(parser->user_data, parser->literal[0] == 't');
+}
 
-        /* print key */
-        if (!print_string_ptr((unsigned char*)current_item->string, output_buffer))
-        {
-            return false;
-        }
-        update_offset(output_buffer);
+/* start a value with its first character */
+static cJSON_bool stream_start_value(cJSON_StreamParser * const parser, const unsigned char character)
+{
+    switch (character)
+    {
+        case '{':
+            parser->state = stream_key_or_end;
+            return stream_push(parser, true);
 
-        length = (size_t) (output_buffer->format ? 2 : 1);
-        output_pointer = ensure(output_buffer, length);
-        if (output_pointer == NULL)
-        {
-            return false;
-        }
-        *output_pointer++ = ':';
-        if (output_buffer->format)
-        {
-            *output_pointer++ = '\t';
-        }
-        output_buffer->offset += length;
+        case '[':
+            parser->state = stream_value_or_end;
+            return stream_push(parser, false);
 
-        /* print value */
-        if (!print_value(current_item, output_buffer))
-        {
-            return false;
-        }
-        update_offset(output_buffer);
+        case '\"':
+            parser->string_is_key = false;
+            parser->token_length = 0;
+            parser->state = stream_string;
+            return stream_reserve(parser, 0);
 
-        /* print comma if not last */
-        length = ((size_t)(output_buffer->format ? 1 : 0) + (size_t)(current_item->next ? 1 : 0));
-        output_pointer = ensure(output_buffer, length + 1);
-        if (output_pointer == NULL)
-        {
-            return false;
-        }
-        if (current_item->next)
-        {
-            *output_pointer++ = ',';
-        }
+        case 't':
+            parser->literal = "true";
+            break;
 
-        if (output_buffer->format)
-        {
-            *output_pointer++ = '\n';
-        }
-        *output_pointer = '\0';
-        output_buffer->offset += length;
+        case 'f':
+            parser->literal = "false";
+            break;
 
-        current_item = current_item->next;
-    }
+        case 'n':
+            parser->literal = "null";
+            break;
 
-    output_pointer = ensure(output_buffer, output_buffer->format ? (output_buffer->depth + 1) : 2);
-    if (output_pointer == NULL)
-    {
-        return false;
-    }
-    if (output_buffer->format)
-    {
-        size_t i;
-        for (i = 0; i < (output_buffer->depth - 1); i++)
-        {
-            *output_pointer++ = '\t';
-        }
+        default:
+            if ((character == '-') || ((character >= '0') && (character <= '9')))
+            {
+                parser->token_length = 0;
+                parser->state = stream_number;
+                return stream_append(parser, &character, 1);
+            }
+            return false;
     }
-    *output_pointer++ = '}';
-    *output_pointer = '\0';
-    output_buffer->depth--;
 
+    parser->literal_position = 1;
+    parser->state = stream_literal;
     return true;
 }
 
-/* Get Array size/item / object item. */
-CJSON_PUBLIC(int) cJSON_GetArraySize(const cJSON *array)
+static cJSON_bool stream_escape(cJSON_StreamParser * const parser, const unsigned char character)
 {
-    cJSON *child = NULL;
-    size_t size = 0;
+    unsigned char decoded = 0;
 
-    if (array == NULL)
+    switch (character)
     {
-        return 0;
-    }
+        case 'b':
+            decoded = '\b';
+            break;
+        case 'f':
+            decoded = '\f';
+            break;
+        case 'n':
+            decoded = '\n';
+            break;
+        case 'r':
+            decoded = '\r';
+            break;
+        case 't':
+            decoded = '\t';
+            break;
+        case '\"':
+        case '\\':
+        case '/':
+            decoded = character;
+            break;
 
-    child = array->child;
+        /* UTF-16 literal */
+        case 'u':
+            parser->escape[0] = '\\';
+            parser->escape[1] = 'u';
+            parser->escape_length = 2;
+            parser->state = stream_string_unicode;
+            return true;
 
-    while(child != NULL)
-    {
-        size++;
-        child = child->next;
+        default:
+            return false;
     }
 
-    /* FIXME: Can overflow here. Cannot be fixed without breaking the API */
-
-    return (int)size;
+    parser->state = stream_string;
+    return stream_append(parser, &decoded, 1);
 }
 
-static cJSON* get_array_item(const cJSON *array, size_t index)
+static cJSON_bool stream_unicode(cJSON_StreamParser * const parser, const unsigned char character)
 {
-    cJSON *current_child = NULL;
+    unsigned char *output_pointer = NULL;
+    unsigned int first_code = 0;
 
-    if (array == NULL)
+    /* check the characters as they come in, a quote must not end up inside the sequence */
+    if (parser->escape_length == 6)
     {
-        return NULL;
+        if (character != '\\')
+        {
+            return false;
+        }
     }
-
-    current_child = array->child;
-    while ((current_child != NULL) && (index > 0))
+    else if (parser->escape_length == 7)
     {
-        index--;
-        current_child = current_child->next;
+        if (character != 'u')
+        {
+            return false;
+        }
+    }
+    else if (!(((character >= '0') && (character <= '9'))
+        || ((character >= 'A') && (character <= 'F')) || ((character >= 'a') && (character <= 'f'))))
+    {
+        return false;
     }
 
-    return current_child;
-}
+    parser->escape[parser->escape_length++] = character;
+    if (parser->escape_length < 6)
+    {
+        return true;
+    }
+    if (parser->escape_length == 6)
+    {
+        /* the first half of a surrogate pair needs the second sequence as well */
+        first_code = parse_hex4(parser->escape + 2);
+        if ((first_code >= 0xD800) && (first_code <= 0xDBFF))
+        {
+            return true;
+        }
+    }
+    else if (parser->escape_length < 12)
+    {
+        return true;
+    }
 
-CJSON_PUBLIC(cJSON *) cJSON_GetArrayItem(const cJSON *array, int index)
-{
-    if (index < 0)
+    if (!stream_reserve(parser, 4))
     {
-        return NULL;
+        return false;
     }
+    output_pointer = parser->token + parser->token_length;
+    if (utf16_literal_to_utf8(parser->escape, parser->escape + parser->escape_length, &output_pointer) == 0)
+    {
+        return false;
+    }
+    parser->token_length = (size_t)(output_pointer - parser->token);
+    parser->state = stream_string;
 
-    return get_array_item(array, (size_t)index);
+    return true;
 }
 
-static cJSON *get_object_item(const cJSON * const object, const char * const name, const cJSON_bool case_sensitive)
+CJSON_PUBLIC(cJSON_bool) cJSON_FeedStreamParser(cJSON_StreamParser *parser, const char *chunk, size_t length)
 {
-    cJSON *current_element = NULL;
+    const unsigned char *input = (const unsigned char*)chunk;
+    size_t position = 0;
 
-    if ((object == NULL) || (name == NULL))
+    if ((parser == NULL) || ((chunk == NULL) && (length > 0)))
     {
-        return NULL;
+        return false;
     }
-
-    current_element = object->child;
-    if (case_sensitive)
+    if (parser->state == stream_error)
     {
-        while ((current_element != NULL) && (current_element->string != NULL) && (strcmp(name, current_element->string) != 0))
-        {
-            current_element = current_element->next;
-        }
+        return false;
     }
-    else
+
+    while (position < length)
     {
-        while ((current_element != NULL) && (case_insensitive_strcmp((const unsigned char*)name, (const unsigned char*)(current_element->string)) != 0))
+        const unsigned char character = input[position];
+        cJSON_bool success = true;
+
+        switch (parser->state)
         {
-            current_element = current_element->next;
-        }
-    }
+            case stream_string:
+            {
+                /* copy everything up to the next quote or escape sequence in one go */
+                const size_t run_length = string_span_length(input + position, length - position);
+                if (run_length > 0)
+                {
+                    success = stream_append(parser, input + position, run_length);
+                    position += run_length;
+                    if (!success)
+                    {
+                        goto fail;
+                    }
+                    continue;
+                }
+                if (character == '\"')
+                {
+                    success = stream_finish_string(parser);
+                }
+                else
+                {
+                    parser->state = stream_string_escape;
+                }
+                break;
+            }
 
-    if ((current_element == NULL) || (current_element->string == NULL)) {
-        return NULL;
-    }
+            case stream_string_escape:
+                success = stream_escape(parser, character);
+                break;
 
-    return current_element;
-}
+            case stream_string_unicode:
+                success = stream_unicode(parser, character);
+                break;
 
-CJSON_PUBLIC(cJSON *) cJSON_GetObjectItem(const cJSON * const object, const char * const string)
-{
-    return get_object_item(object, string, false);
-}
+            case stream_number:
+                switch (character)
+                {
+                    case '0': case '1': case '2': case '3': case '4':
+                    case '5': case '6': case '7': case '8': case '9':
+                    case '+': case '-': case 'e': case 'E': case '.':
+                        success = stream_append(parser, &character, 1);
+                        break;
+
+                    default:
+                        /* the character after the number still has to be processed */
+                        if (!stream_finish_number(parser))
+                        {
+                            goto fail;
+                        }
+                        continue;
+                }
+                break;
 
-CJSON_PUBLIC(cJSON *) cJSON_GetObjectItemCaseSensitive(const cJSON * const object, const char * const string)
-{
-    return get_object_item(object, string, true);
-}
+            case stream_literal:
+                success = (character == (unsigned char)parser->literal[parser->literal_position]);
+                parser->literal_position++;
+                if (success && (parser->literal[parser->literal_position] == '\0'))
+                {
+                    success = stream_finish_literal(parser);
+                }
+                break;
 
-CJSON_PUBLIC(cJSON_bool) cJSON_HasObjectItem(const cJSON *object, const char *string)
-{
-    return cJSON_GetObjectItem(object, string) ? 1 : 0;
-}
+            case stream_value:
+            case stream_value_or_end:
+                if (character <= 32)
+                {
+                    position += whitespace_length(input + position, length - position);
+                    continue;
+                }
+                if ((parser->state == stream_value_or_end) && (character == ']'))
+                {
+                    success = stream_pop(parser);
+                }
+                else
+                {
+                    success = stream_start_value(parser, character);
+                }
+                break;
 
-/* Utility for array list handling. */
-static void suffix_object(cJSON *prev, cJSON *item)
-{
-    prev->next = item;
-    item->prev = prev;
-}
+            case stream_key_or_end:
+            case stream_key:
+                if (character <= 32)
+                {
+                    position += whitespace_length(input + position, length - position);
+                    continue;
+                }
+                if (character == '\"')
+                {
+                    parser->string_is_key = true;
+                    parser->token_length = 0;
+                    parser->state = stream_string;
+                    success = stream_reserve(parser, 0);
+                }
+                else
+                {
+                    success = (parser->state == stream_key_or_end) && (character == '}') && stream_pop(parser);
+                }
+                break;
+
+            case stream_colon:
+                if (character <= 32)
+                {
+                    position += whitespace_length(input + position, length - position);
+                    continue;
+                }
+                success = (character == ':');
+                parser->state = stream_value;
+                break;
+
+            case stream_after_value:
+                if (character <= 32)
+                {
+                    position += whitespace_length(input + position, length - position);
+                    continue;
+                }
+                if (character == ',')
+                {
+                    parser->state = stream_in_object(parser) ? stream_key : stream_value;
+                }
+                else if (character == (stream_in_object(parser) ? '}' : ']'))
+                {
+                    success = stream_pop(parser);
+                }
+                else
+                {
+                    success = false;
+                }
+                break;
+
+            case stream_done:
+                if (character <= 32)
+                {
+                    position += whitespace_length(input + position, length - position);
+                    continue;
+                }
+                success = false;
+                break;
+
+            default:
+                success = false;
+                break;
+        }
 
-/* Utility for handling references. */
-static cJSON *create_reference(const cJSON *item, const internal_hooks * const hooks)
-{
-    cJSON *reference = NULL;
-    if (item == NULL)
-    {
-        return NULL;
+        if (!success)
+        {
+            goto fail;
+        }
+        position++;
     }
 
-    reference = cJSON_New_Item(hooks);
-    if (reference == NULL)
-    {
-        return NULL;
-    }
+    parser->offset += length;
+    return true;
 
-    memcpy(reference, item, sizeof(cJSON));
-    reference->string = NULL;
-    reference->type |= cJSON_IsReference;
-    reference->next = reference->prev = NULL;
-    return reference;
+fail:
+    parser->error_offset = parser->offset + position;
+    parser->state = stream_error;
+    return false;
 }
 
-static cJSON_bool add_item_to_array(cJSON *array, cJSON *item)
+CJSON_PUBLIC(cJSON_bool) cJSON_FinishStreamParser(cJSON_StreamParser *parser)
 {
-    cJSON *child = NULL;
-
-    if ((item == NULL) || (array == NULL) || (array == item))
+    if (parser == NULL)
     {
         return false;
     }
 
-    child = array->child;
-    /*
-     * To find the last item in array quickly, we use prev in array
-     */
-    if (child == NULL)
+    /* a number at the top level only ends with the input */
+    if ((parser->state == stream_number) && !stream_finish_number(parser))
     {
-        /* list is empty, start new one */
-        array->child = item;
-        item->prev = item;
-        item->next = NULL;
+        parser->state = stream_error;
     }
-    else
+
+    if (parser->state == stream_done)
     {
-        /* append to the end */
-        if (child->prev)
-        {
-            suffix_object(child->prev, item);
-            array->child->prev = item;
-        }
+        return true;
     }
 
-    return true;
+    if (parser->state != stream_error)
+    {
+        /* input ended unexpectedly */
+        parser->error_offset = parser->offset;
+        parser->state = stream_error;
+    }
+
+    return false;
 }
 
-/* Add item to array/object. */
-CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToArray(cJSON *array, cJSON *item)
+/* Parallel parsing of newline delimited JSON and of large top level arrays. The input is cut into chunks
+ * of whole records, every chunk is parsed into a list of items on its own and the lists are joined in order.
+ * Chunks are handed out to the threads one at a time, so a slow chunk doesn't hold up the others.
+ * The nodes come from the per-thread pool of whichever thread parses them. */
+#define PARALLEL_CHUNK_MIN_SIZE (256 * 1024)
+#define PARALLEL_CHUNKS_PER_THREAD 8
+
+typedef struct
 {
-    return add_item_to_array(array, item);
-}
+    size_t start;
+    size_t end; /* the chunk is parsed as if the input ended here */
+    cJSON *first;
+    cJSON *last;
+    cJSON_bool failed;
+    size_t error; /* offset of the error if it failed */
+} parallel_chunk;
 
-#if defined(__clang__) || (defined(__GNUC__)  && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ > 5))))
-    #pragma GCC diagnostic push
-#endif
-#ifdef __GNUC__
-#pragma GCC diagnostic ignored "-Wcast-qual"
-#endif
-/* helper function to cast away const */
-static void* cast_away_const(const void* string)
+typedef struct
 {
-    return (void*)string;
-}
-#if defined(__clang__) || (defined(__GNUC__)  && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ > 5))))
-    #pragma GCC diagnostic pop
+    const unsigned char *content;
+    parallel_chunk *chunks;
+    size_t chunk_count;
+    cJSON_bool ndjson;
+    internal_hooks hooks;
+    size_t nesting_limit;
+    /* handed out to the threads, chunks after a failed one are skipped */
+    size_t next_chunk;
+    size_t failed_chunk;
+#if CJSON_THREADS
+    pthread_mutex_t lock;
 #endif
+} parallel_parse;
 
-
-static cJSON_bool add_item_to_object(cJSON * const object, const char * const string, cJSON * const item, const internal_hooks * const hooks, const cJSON_bool constant_key)
+/* parse the records of a chunk: one value per line for NDJSON, elements separated by commas otherwise */
+static void parse_chunk(const parallel_parse * const parallel, parallel_chunk * const chunk)
 {
-    char *new_key = NULL;
-    int new_type = cJSON_Invalid;
+    const unsigned char * const content = parallel->content;
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
 
-    if ((object == NULL) || (string == NULL) || (item == NULL) || (object == item))
-    {
-        return false;
-    }
+    buffer.content = content;
+    buffer.length = chunk->end;
+    buffer.offset = chunk->start;
+    buffer.hooks = parallel->hooks;
+    buffer.nesting_limit = parallel->nesting_limit;
 
-    if (constant_key)
+    for (;;)
     {
-        new_key = (char*)cast_away_const(string);
-        new_type = item->type | cJSON_StringIsConst;
-    }
-    else
-    {
-        new_key = (char*)cJSON_strdup((const unsigned char*)string, hooks);
-        if (new_key == NULL)
+        cJSON *item = NULL;
+
+        buffer.offset += whitespace_length(content + buffer.offset, chunk->end - buffer.offset);
+        if (buffer.offset >= chunk->end)
         {
-            return false;
+            if (parallel->ndjson)
+            {
+                return; /* blank lines at the end */
+            }
+            break; /* an element is missing */
         }
 
-        new_type = item->type & ~cJSON_StringIsConst;
-    }
+        item = cJSON_New_Item(&parallel->hooks);
+        if (item == NULL)
+        {
+            break;
+        }
+        if (chunk->first == NULL)
+        {
+            chunk->first = item;
+        }
+        else
+        {
+            chunk->last->next = item;
+            item->prev = chunk->last;
+        }
+        chunk->last = item;
 
-    if (!(item->type & cJSON_StringIsConst) && (item->string != NULL))
-    {
-        hooks->deallocate(item->string);
-    }
+        /* the elements of an array are one level down */
+        buffer.depth = parallel->ndjson ? 0 : 1;
+        if (!parse_value(item, &buffer))
+        {
+            break;
+        }
 
-    item->string = new_key;
-    item->type = new_type;
+        if (parallel->ndjson)
+        {
+            /* nothing else on the line */
+            while ((buffer.offset < chunk->end) && (content[buffer.offset] <= 32) && (content[buffer.offset] != '\n'))
+            {
+                buffer.offset++;
+            }
+            if ((buffer.offset < chunk->end) && (content[buffer.offset] != '\n'))
+            {
+                break;
+            }
+            continue;
+        }
 
-    return add_item_to_array(object, item);
+        buffer.offset += whitespace_length(content + buffer.offset, chunk->end - buffer.offset);
+        if (buffer.offset >= chunk->end)
+        {
+            return;
+        }
+        if (content[buffer.offset] != ',')
+        {
+            break;
+        }
+        buffer.offset++;
+    }
+
+    chunk->failed = true;
+    chunk->error = (buffer.offset < chunk->end) ? buffer.offset : chunk->end;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToObject(cJSON *object, const char *string, cJSON *item)
+static void parse_chunks(parallel_parse * const parallel)
 {
-    return add_item_to_object(object, string, item, &global_hooks, false);
+    for (;;)
+    {
+        size_t index = 0;
+
+#if CJSON_THREADS
+        pthread_mutex_lock(&parallel->lock);
+#endif
+        index = parallel->next_chunk++;
+        if (index > parallel->failed_chunk)
+        {
+            index = parallel->chunk_count;
+        }
+#if CJSON_THREADS
+        pthread_mutex_unlock(&parallel->lock);
+#endif
+        if (index >= parallel->chunk_count)
+        {
+            return;
+        }
+
+        parse_chunk(parallel, &parallel->chunks[index]);
+        if (parallel->chunks[index].failed)
+        {
+#if CJSON_THREADS
+            pthread_mutex_lock(&parallel->lock);
+#endif
+            if (index < parallel->failed_chunk)
+            {
+                parallel->failed_chunk = index;
+            }
+#if CJSON_THREADS
+            pthread_mutex_unlock(&parallel->lock);
+#endif
+        }
+    }
 }
 
-/* Add an item to an object with constant string as key */
-CJSON_PUBLIC(cJSON_bool) cJSON_AddItemToObjectCS(cJSON *object, const char *string, cJSON *item)
+#if CJSON_THREADS
+static void *parse_chunks_thread(void *parallel)
 {
-    return add_item_to_object(object, string, item, &global_hooks, true);
+    parse_chunks((parallel_parse*)parallel);
+#if CJSON_POOL
+    /* nodes freed after an error would be lost with the thread */
+    pool_trim(0);
+#endif
+
+    return NULL;
 }
+#endif
 
-CJSON_PUBLIC(cJSON_bool) cJSON_AddItemReferenceToArray(cJSON *array, cJSON *item)
+/* number of threads to use for threads requested and chunk_count chunks */
+static size_t parallel_thread_count(const int threads, const size_t chunk_count)
 {
-    if (array == NULL)
+    size_t count = 1;
+
+#if CJSON_THREADS
+    if (threads > 0)
     {
-        return false;
+        count = (size_t)threads;
+    }
+    else
+    {
+#if defined(_SC_NPROCESSORS_ONLN)
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        count = (processors > 0) ? (size_t)processors : 1;
+#endif
+    }
+    if (count > CJSON_THREADS)
+    {
+        count = CJSON_THREADS;
     }
+#else
+    (void)threads;
+#endif
 
-    return add_item_to_array(array, create_reference(item, &global_hooks));
+    return (count < chunk_count) ? count : chunk_count;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_AddItemReferenceToObject(cJSON *object, const char *string, cJSON *item)
+/* number of chunks to cut length bytes into */
+static size_t parallel_chunk_count(const size_t length, const int threads)
 {
-    if ((object == NULL) || (string == NULL))
-    {
-        return false;
-    }
+    const size_t wanted = parallel_thread_count(threads, (size_t)-1) * PARALLEL_CHUNKS_PER_THREAD;
+    const size_t fitting = (length / PARALLEL_CHUNK_MIN_SIZE) + 1;
 
-    return add_item_to_object(object, string, create_reference(item, &global_hooks), &global_hooks, false);
+    return (wanted < fitting) ? wanted : fitting;
 }
 
-CJSON_PUBLIC(cJSON*) cJSON_AddNullToObject(cJSON * const object, const char * const name)
+typedef struct
 {
-    cJSON *null = cJSON_CreateNull();
-    if (add_item_to_object(object, name, null, &global_hooks, false))
+    size_t depth; /* 1 directly inside the top level array */
+    cJSON_bool in_string;
+    cJSON_bool escaped;
+    /* the chunks are cut at the first comma directly inside the array after split_size bytes */
+    parallel_chunk *chunks;
+    size_t chunk;
+    size_t chunk_count;
+    size_t split_size;
+} structure_scan;
+
+/* follow a bracket or comma outside of strings at position, returns whether it closes the top level array */
+static cJSON_bool scan_structural(structure_scan * const scan, const unsigned char character, const size_t position)
+{
+    switch (character)
     {
-        return null;
-    }
+        case '[':
+        case '{':
+            scan->depth++;
+            return false;
 
-    cJSON_Delete(null);
-    return NULL;
+        case ']':
+        case '}':
+            return --scan->depth == 0;
+
+        case ',':
+            if ((scan->depth == 1) && ((scan->chunk + 1) < scan->chunk_count) && ((position - scan->chunks[scan->chunk].start) >= scan->split_size))
+            {
+                scan->chunks[scan->chunk].end = position;
+                scan->chunk++;
+                scan->chunks[scan->chunk].start = position + 1;
+            }
+            return false;
+
+        default:
+            return false;
+    }
 }
 
-CJSON_PUBLIC(cJSON*) cJSON_AddTrueToObject(cJSON * const object, const char * const name)
+/* follow the structure of bytes [position, end) one at a time, returns the position of the closing bracket or end */
+static size_t scan_structure(const unsigned char * const content, size_t position, const size_t end, structure_scan * const scan)
 {
-    cJSON *true_item = cJSON_CreateTrue();
-    if (add_item_to_object(object, name, true_item, &global_hooks, false))
+    for (; position < end; position++)
     {
-        return true_item;
+        const unsigned char character = content[position];
+
+        if (scan->in_string)
+        {
+            if (scan->escaped)
+            {
+                scan->escaped = false;
+            }
+            else if (character == '\\')
+            {
+                scan->escaped = true;
+            }
+            else if (character == '\"')
+            {
+                scan->in_string = false;
+            }
+        }
+        else if (character == '\"')
+        {
+            scan->in_string = true;
+        }
+        else if (scan_structural(scan, character, position))
+        {
+            return position;
+        }
     }
 
-    cJSON_Delete(true_item);
-    return NULL;
+    return end;
 }
 
-CJSON_PUBLIC(cJSON*) cJSON_AddFalseToObject(cJSON * const object, const char * const name)
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+static unsigned int bit_count(unsigned int mask)
 {
-    cJSON *false_item = cJSON_CreateFalse();
-    if (add_item_to_object(object, name, false_item, &global_hooks, false))
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_popcount(mask);
+#else
+    unsigned int count = 0;
+    for (; mask != 0; mask &= mask - 1)
     {
-        return false_item;
+        count++;
     }
-
-    cJSON_Delete(false_item);
-    return NULL;
+    return count;
+#endif
 }
 
-CJSON_PUBLIC(cJSON*) cJSON_AddBoolToObject(cJSON * const object, const char * const name, const cJSON_bool boolean)
+/* masks of the quotes, backslashes, opening and closing brackets and commas in 32 bytes of input.
+ * '[' and '{' (and ']' and '}') only differ in 0x20. */
+static void structure_classify(const unsigned char * const input, unsigned int * const quote, unsigned int * const backslash, unsigned int * const opening, unsigned int * const closing, unsigned int * const comma)
 {
-    cJSON *bool_item = cJSON_CreateBool(boolean);
-    if (add_item_to_object(object, name, bool_item, &global_hooks, false))
-    {
-        return bool_item;
+#if defined(CJSON_SIMD_AVX2)
+    const __m256i chunk = _mm256_loadu_si256((const __m256i*)(const void*)input);
+    const __m256i folded = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+    *quote = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\"')));
+    *backslash = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+    *opening = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')));
+    *closing = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+    *comma = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(',')));
+#else
+    size_t half = 0;
+
+    *quote = 0;
+    *backslash = 0;
+    *opening = 0;
+    *closing = 0;
+    *comma = 0;
+    for (half = 0; half < 2; half++)
+    {
+#if defined(CJSON_SIMD_SSE2)
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)(const void*)(input + (half * 16)));
+        const __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        const unsigned int quote_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')));
+        const unsigned int backslash_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+        const unsigned int opening_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')));
+        const unsigned int closing_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+        const unsigned int comma_half = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(',')));
+#else
+        const uint8x16_t chunk = vld1q_u8(input + (half * 16));
+        const uint8x16_t folded = vorrq_u8(chunk, vdupq_n_u8(0x20));
+        const unsigned int quote_half = neon_movemask(vceqq_u8(chunk, vdupq_n_u8('\"')));
+        const unsigned int backslash_half = neon_movemask(vceqq_u8(chunk, vdupq_n_u8('\\')));
+        const unsigned int opening_half = neon_movemask(vceqq_u8(folded, vdupq_n_u8('{')));
+        const unsigned int closing_half = neon_movemask(vceqq_u8(folded, vdupq_n_u8('}')));
+        const unsigned int comma_half = neon_movemask(vceqq_u8(chunk, vdupq_n_u8(',')));
+#endif
+        *quote |= quote_half << (half * 16);
+        *backslash |= backslash_half << (half * 16);
+        *opening |= opening_half << (half * 16);
+        *closing |= closing_half << (half * 16);
+        *comma |= comma_half << (half * 16);
     }
-
-    cJSON_Delete(bool_item);
-    return NULL;
+#endif
 }
+#endif
 
-CJSON_PUBLIC(cJSON*) cJSON_AddNumberToObject(cJSON * const object, const char * const name, const double number)
+/* cut the elements of the array that opens at start into chunks, returns the position of the closing bracket or length */
+static size_t split_array(const unsigned char * const content, const size_t start, const size_t length, parallel_chunk * const chunks, size_t * const chunk_count)
 {
-    cJSON *number_item = cJSON_CreateNumber(number);
-    if (add_item_to_object(object, name, number_item, &global_hooks, false))
-    {
-        return number_item;
+    structure_scan scan;
+    size_t position = start + 1;
+
+    memset(&scan, '\0', sizeof(scan));
+    scan.depth = 1;
+    scan.chunks = chunks;
+    scan.chunk_count = *chunk_count;
+    scan.split_size = ((length - start) / *chunk_count) + 1;
+    chunks[0].start = position;
+
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+    /* blocks without escape sequences that stay two levels deep are followed by counting their brackets,
+     * the others only stop at the brackets and commas outside of strings */
+    while ((position + 32) <= length)
+    {
+        unsigned int quote = 0;
+        unsigned int backslash = 0;
+        unsigned int opening = 0;
+        unsigned int closing = 0;
+        unsigned int comma = 0;
+        unsigned int structural = 0;
+
+        structure_classify(content + position, &quote, &backslash, &opening, &closing, &comma);
+        if ((backslash == 0) && !scan.escaped)
+        {
+            /* prefix xor of the quotes marks the bytes inside of strings */
+            unsigned int inside = quote;
+            inside ^= inside << 1;
+            inside ^= inside << 2;
+            inside ^= inside << 4;
+            inside ^= inside << 8;
+            inside ^= inside << 16;
+            inside &= 0xFFFFFFFFu;
+            if (scan.in_string)
+            {
+                inside = ~inside & 0xFFFFFFFFu;
+            }
+
+            opening &= ~inside;
+            closing &= ~inside;
+            if ((bit_count(closing) + 1) < scan.depth)
+            {
+                scan.depth = scan.depth + bit_count(opening) - bit_count(closing);
+            }
+            else
+            {
+                for (structural = opening | closing | (comma & ~inside); structural != 0; structural &= structural - 1)
+                {
+                    const size_t bracket = position + lowest_set_bit(structural);
+                    if (scan_structural(&scan, content[bracket], bracket))
+                    {
+                        position = bracket;
+                        goto end;
+                    }
+                }
+            }
+            scan.in_string = (cJSON_bool)((inside >> 31) & 1);
+        }
+        else
+        {
+            const size_t closed = scan_structure(content, position, position + 32, &scan);
+            if (closed < (position + 32))
+            {
+                position = closed;
+                goto end;
+            }
+        }
+        position += 32;
     }
+#endif
+
+    position = scan_structure(content, position, length, &scan);
+
+#if defined(CJSON_SIMD_AVX2) || defined(CJSON_SIMD_SSE2) || defined(CJSON_SIMD_NEON)
+end:
+#endif
+    *chunk_count = scan.chunk + 1;
+    chunks[scan.chunk].end = position;
 
-    cJSON_Delete(number_item);
-    return NULL;
+    return position;
 }
 
-CJSON_PUBLIC(cJSON*) cJSON_AddStringToObject(cJSON * const object, const char * const name, const char * const string)
+static cJSON *parse_parallel(const char * const value, const size_t buffer_length, const int threads, const cJSON_bool ndjson)
 {
-    cJSON *string_item = cJSON_CreateString(string);
-    if (add_item_to_object(object, name, string_item, &global_hooks, false))
-    {
-        return string_item;
-    }
+    const unsigned char * const content = (const unsigned char*)value;
+    parallel_parse parallel;
+    size_t chunk_count = 0;
+    size_t start = 0;
+    size_t error_position = 0;
+    size_t chunk = 0;
+    cJSON *array = NULL;
+    cJSON *last = NULL;
+#if CJSON_THREADS
+    pthread_t workers[CJSON_THREADS];
+    size_t started = 0;
+#endif
 
-    cJSON_Delete(string_item);
-    return NULL;
-}
+    /* reset error position */
+    global_context.last_error.json = NULL;
+    global_context.last_error.position = 0;
 
-CJSON_PUBLIC(cJSON*) cJSON_AddRawToObject(cJSON * const object, const char * const name, const char * const raw)
-{
-    cJSON *raw_item = cJSON_CreateRaw(raw);
-    if (add_item_to_object(object, name, raw_item, &global_hooks, false))
+    memset(&parallel, '\0', sizeof(parallel));
+    /* empty NDJSON is a stream without records, like one of blank lines, an empty array needs its brackets */
+    if ((value == NULL) || ((buffer_length == 0) && !ndjson))
     {
-        return raw_item;
+        goto fail;
     }
 
-    cJSON_Delete(raw_item);
-    return NULL;
-}
+    parallel.content = content;
+    parallel.ndjson = ndjson;
+    parallel.hooks = global_hooks;
+    parallel.nesting_limit = global_context.nesting_limit;
 
-CJSON_PUBLIC(cJSON*) cJSON_AddObjectToObject(cJSON * const object, const char * const name)
-{
-    cJSON *object_item = cJSON_CreateObject();
-    if (add_item_to_object(object, name, object_item, &global_hooks, false))
+    /* skip a UTF-8 BOM */
+    if ((buffer_length >= 3) && (strncmp(value, "\xEF\xBB\xBF", 3) == 0))
     {
-        return object_item;
+        start = 3;
     }
 
-    cJSON_Delete(object_item);
-    return NULL;
-}
+    chunk_count = parallel_chunk_count(buffer_length - start, threads);
+    parallel.chunks = (parallel_chunk*)global_hooks.allocate(chunk_count * sizeof(parallel_chunk));
+    if (parallel.chunks == NULL)
+    {
+        goto fail;
+    }
+    memset(parallel.chunks, '\0', chunk_count * sizeof(parallel_chunk));
 
-CJSON_PUBLIC(cJSON*) cJSON_AddArrayToObject(cJSON * const object, const char * const name)
-{
-    cJSON *array = cJSON_CreateArray();
-    if (add_item_to_object(object, name, array, &global_hooks, false))
+    if (ndjson)
     {
-        return array;
+        /* every newline ends a record, strings can't contain them */
+        const size_t split_size = ((buffer_length - start) / chunk_count) + 1;
+
+        parallel.chunks[0].start = start;
+        for (chunk = 1; chunk < chunk_count; chunk++)
+        {
+            const size_t split = parallel.chunks[chunk - 1].start + split_size;
+            const unsigned char *newline = NULL;
+
+            if (split < buffer_length)
+            {
+                newline = (const unsigned char*)memchr(content + split, '\n', buffer_length - split);
+            }
+            if (newline == NULL)
+            {
+                break;
+            }
+            parallel.chunks[chunk - 1].end = (size_t)(newline - content);
+            parallel.chunks[chunk].start = parallel.chunks[chunk - 1].end + 1;
+        }
+        chunk_count = chunk;
+        parallel.chunks[chunk_count - 1].end = buffer_length;
     }
+    else
+    {
+        size_t end = 0;
 
-    cJSON_Delete(array);
-    return NULL;
-}
+        start += whitespace_length(content + start, buffer_length - start);
+        if ((start >= buffer_length) || (content[start] != '['))
+        {
+            error_position = start;
+            goto fail;
+        }
 
-CJSON_PUBLIC(cJSON *) cJSON_DetachItemViaPointer(cJSON *parent, cJSON * const item)
-{
-    if ((parent == NULL) || (item == NULL) || (item != parent->child && item->prev == NULL))
+        end = split_array(content, start, buffer_length, parallel.chunks, &chunk_count);
+        if ((end >= buffer_length) || (content[end] != ']'))
+        {
+            error_position = end;
+            goto fail; /* the array isn't closed */
+        }
+        if ((start + 1 + whitespace_length(content + start + 1, end - start - 1)) == end)
+        {
+            chunk_count = 0; /* empty array */
+        }
+    }
+
+    parallel.chunk_count = chunk_count;
+    parallel.failed_chunk = chunk_count;
+#if CJSON_THREADS
+    if (pthread_mutex_init(&parallel.lock, NULL) != 0)
     {
-        return NULL;
+        goto fail;
+    }
+    /* the calling thread parses chunks as well, threads that can't be started leave more to the others */
+    for (chunk = 1; chunk < parallel_thread_count(threads, chunk_count); chunk++)
+    {
+        if (pthread_create(&workers[started], NULL, parse_chunks_thread, &parallel) == 0)
+        {
+            started++;
+        }
+    }
+    parse_chunks(&parallel);
+    while (started > 0)
+    {
+        pthread_join(workers[--started], NULL);
     }
+    pthread_mutex_destroy(&parallel.lock);
+#else
+    parse_chunks(&parallel);
+#endif
 
-    if (item != parent->child)
+    if (parallel.failed_chunk < chunk_count)
     {
-        /* not the first element */
-        item->prev->next = item->next;
+        error_position = parallel.chunks[parallel.failed_chunk].error;
+        goto fail;
     }
-    if (item->next != NULL)
+
+    array = cJSON_New_Item(&global_hooks);
+    if (array == NULL)
     {
-        /* not the last element */
-        item->next->prev = item->prev;
+        goto fail;
     }
+    array->type = cJSON_Array;
 
-    if (item == parent->child)
+    /* join the lists, the head's prev points to the last child */
+    for (chunk = 0; chunk < chunk_count; chunk++)
     {
-        /* first element */
-        parent->child = item->next;
+        parallel_chunk * const current = &parallel.chunks[chunk];
+        if (current->first == NULL)
+        {
+            continue;
+        }
+        if (last == NULL)
+        {
+            array->child = current->first;
+        }
+        else
+        {
+            last->next = current->first;
+            current->first->prev = last;
+        }
+        last = current->last;
+        current->first = NULL;
     }
-    else if (item->next == NULL)
+    if (array->child != NULL)
     {
-        /* last element */
-        parent->child->prev = item->prev;
+        array->child->prev = last;
     }
 
-    /* make sure the detached item doesn't point anywhere anymore */
-    item->prev = NULL;
-    item->next = NULL;
+    global_hooks.deallocate(parallel.chunks);
 
-    return item;
-}
+    return array;
 
-CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromArray(cJSON *array, int which)
-{
-    if (which < 0)
+fail:
+    if (parallel.chunks != NULL)
     {
-        return NULL;
+        for (chunk = 0; chunk < chunk_count; chunk++)
+        {
+            if (parallel.chunks[chunk].first != NULL)
+            {
+                delete_item(parallel.chunks[chunk].first, &global_hooks);
+            }
+        }
+        global_hooks.deallocate(parallel.chunks);
     }
 
-    return cJSON_DetachItemViaPointer(array, get_array_item(array, (size_t)which));
+    if (value != NULL)
+    {
+        global_context.last_error.json = content;
+        global_context.last_error.position = ((error_position < buffer_length) || (buffer_length == 0)) ? error_position : (buffer_length - 1);
+    }
+
+    return NULL;
 }
 
-CJSON_PUBLIC(void) cJSON_DeleteItemFromArray(cJSON *array, int which)
+CJSON_PUBLIC(cJSON *) cJSON_ParseNDJSON(const char *value, size_t buffer_length, int threads)
 {
-    cJSON_Delete(cJSON_DetachItemFromArray(array, which));
+    return parse_parallel(value, buffer_length, threads, true);
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromObject(cJSON *object, const char *string)
+CJSON_PUBLIC(cJSON *) cJSON_ParseArrayParallel(const char *value, size_t buffer_length, int threads)
 {
-    cJSON *to_detach = cJSON_GetObjectItem(object, string);
-
-    return cJSON_DetachItemViaPointer(object, to_detach);
+    return parse_parallel(value, buffer_length, threads, false);
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_DetachItemFromObjectCaseSensitive(cJSON *object, const char *string)
+/* Schema-directed decoding. The text is scanned like in document_build, but instead of recording
+ * every value, each one is compared against the bindings whose path leads to it. matched counts
+ * how many segments of a binding's path the open containers match, so containers no binding leads
+ * into are skipped without looking at the bindings. */
+typedef struct
 {
-    cJSON *to_detach = cJSON_GetObjectItemCaseSensitive(object, string);
+    const unsigned char *name; /* within the path, still with ~0 and ~1 escapes */
+    size_t length;
+    size_t index; /* as an array index, (size_t)-1 if it isn't one */
+} decode_segment;
 
-    return cJSON_DetachItemViaPointer(object, to_detach);
-}
+typedef struct
+{
+    size_t first_segment;
+    size_t segment_count;
+    size_t matched;
+    size_t capacity; /* of a list */
+    cJSON_bool seen;
+} decode_binding;
 
-CJSON_PUBLIC(void) cJSON_DeleteItemFromObject(cJSON *object, const char *string)
+typedef struct
 {
-    cJSON_Delete(cJSON_DetachItemFromObject(object, string));
-}
+    size_t index; /* of the next element */
+    cJSON_bool object;
+    cJSON_bool tracked; /* some binding leads into or ends at this container */
+} decode_frame;
 
-CJSON_PUBLIC(void) cJSON_DeleteItemFromObjectCaseSensitive(cJSON *object, const char *string)
+typedef enum
 {
-    cJSON_Delete(cJSON_DetachItemFromObjectCaseSensitive(object, string));
+    decode_value,
+    decode_value_or_end,
+    decode_key_or_end,
+    decode_key,
+    decode_colon,
+    decode_comma_or_end
+} decode_state;
+
+typedef struct
+{
+    const unsigned char *content;
+    size_t length;
+    const cJSON_Binding *bindings;
+    size_t binding_count;
+    decode_binding *states;
+    decode_segment *segments;
+    unsigned char *target;
+    cJSON_DecodeError *error;
+    /* name of the member whose value comes next, between the quotes */
+    const unsigned char *key;
+    size_t key_length;
+} decoder;
+
+static cJSON_bool decode_fail(decoder * const decoder, const int status, const size_t binding, const size_t offset)
+{
+    decoder->error->status = status;
+    decoder->error->binding = binding;
+    decoder->error->offset = offset;
+
+    return false;
 }
 
-/* Replace array/object items with new ones. */
-CJSON_PUBLIC(cJSON_bool) cJSON_InsertItemInArray(cJSON *array, int which, cJSON *newitem)
+/* compare a JSON pointer segment with a name without escape sequences */
+static cJSON_bool segment_equals(const decode_segment * const segment, const unsigned char * const name, const size_t name_length)
 {
-    cJSON *after_inserted = NULL;
+    size_t position = 0;
+    size_t name_position = 0;
 
-    if (which < 0 || newitem == NULL)
+    for (position = 0; position < segment->length; position++, name_position++)
     {
-        return false;
+        unsigned char character = segment->name[position];
+        if ((character == '~') && ((position + 1) < segment->length))
+        {
+            position++;
+            character = (segment->name[position] == '1') ? '/' : '~';
+        }
+        if ((name_position >= name_length) || (name[name_position] != character))
+        {
+            return false;
+        }
     }
 
-    after_inserted = get_array_item(array, (size_t)which);
-    if (after_inserted == NULL)
-    {
-        return add_item_to_array(array, newitem);
-    }
+    return name_position == name_length;
+}
 
-    if (after_inserted != array->child && after_inserted->prev == NULL) {
-        /* return false if after_inserted is a corrupted array item */
-        return false;
-    }
+/* does the segment of the binding at depth select the current member or element of frame */
+static cJSON_bool decode_segment_matches(const decoder * const decoder, const decode_segment * const segment, const decode_frame * const frame, const size_t element)
+{
+    cJSON item;
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
+    cJSON_bool matches = false;
 
-    newitem->next = after_inserted;
-    newitem->prev = after_inserted->prev;
-    after_inserted->prev = newitem;
-    if (after_inserted == array->child)
+    if (!frame->object)
     {
-        array->child = newitem;
+        return segment->index == element;
     }
-    else
+
+    if (memchr(decoder->key, '\\', decoder->key_length) == NULL)
     {
-        newitem->prev->next = newitem;
+        return segment_equals(segment, decoder->key, decoder->key_length);
     }
-    return true;
-}
 
-CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemViaPointer(cJSON * const parent, cJSON * const item, cJSON * replacement)
-{
-    if ((parent == NULL) || (parent->child == NULL) || (replacement == NULL) || (item == NULL))
+    /* decode the escape sequences of the name first */
+    memset(&item, '\0', sizeof(item));
+    buffer.content = decoder->key - 1;
+    buffer.length = decoder->key_length + 2;
+    buffer.hooks = global_hooks;
+    buffer.temporary_strings = true;
+    if (!parse_string(&item, &buffer))
     {
         return false;
     }
+    matches = segment_equals(segment, (const unsigned char*)item.valuestring, strlen(item.valuestring));
+    free_string(item.valuestring, &global_hooks);
 
-    if (replacement == item)
-    {
-        return true;
-    }
+    return matches;
+}
 
-    replacement->next = item->next;
-    replacement->prev = item->prev;
+/* store the scalar at position, token_length long, in the field of a binding */
+static cJSON_bool decode_scalar(decoder * const decoder, const size_t binding, const size_t position, const size_t token_length)
+{
+    const cJSON_Binding * const bind = &decoder->bindings[binding];
+    const unsigned char * const token = decoder->content + position;
+    unsigned char * const field = decoder->target + bind->offset;
+    double number = 0;
 
-    if (replacement->next != NULL)
-    {
-        replacement->next->prev = replacement;
-    }
-    if (parent->child == item)
+    switch (bind->type)
     {
-        if (parent->child->prev == parent->child)
-        {
-            replacement->prev = replacement;
-        }
-        parent->child = replacement;
-    }
-    else
-    {   /*
-         * To find the last item in array quickly, we use prev in array.
-         * We can't modify the last item's next pointer where this item was the parent's child
-         */
-        if (replacement->prev != NULL)
-        {
-            replacement->prev->next = replacement;
-        }
-        if (replacement->next == NULL)
+        case cJSON_BindNumber:
+        case cJSON_BindInt:
+            if ((token[0] != '-') && ((token[0] < '0') || (token[0] > '9')))
+            {
+                return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
+            }
+            if (parse_decimal(token, token_length, &number) != token_length)
+            {
+                return decode_fail(decoder, cJSON_DecodeSyntaxError, decoder->binding_count, position);
+            }
+            if (bind->type == cJSON_BindNumber)
+            {
+                memcpy(field, &number, sizeof(double));
+            }
+            else
+            {
+                /* use saturation in case of overflow */
+                const int integer = (number >= INT_MAX) ? INT_MAX : ((number <= (double)INT_MIN) ? INT_MIN : (int)number);
+                memcpy(field, &integer, sizeof(int));
+            }
+            return true;
+
+        case cJSON_BindBool:
         {
-            parent->child->prev = replacement;
+            cJSON_bool boolean = false;
+            if ((token[0] != 't') && (token[0] != 'f'))
+            {
+                return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
+            }
+            boolean = (token[0] == 't');
+            memcpy(field, &boolean, sizeof(cJSON_bool));
+            return true;
         }
-    }
-
-    item->next = NULL;
-    item->prev = NULL;
-    cJSON_Delete(item);
-
-    return true;
-}
 
-CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInArray(cJSON *array, int which, cJSON *newitem)
-{
-    if (which < 0)
-    {
-        return false;
-    }
+        case cJSON_BindString:
+            if (token[0] != '\"')
+            {
+                return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
+            }
+            if (memchr(token + 1, '\\', token_length - 2) == NULL)
+            {
+                if ((token_length - 2) >= bind->size)
+                {
+                    return decode_fail(decoder, cJSON_DecodeOverflow, binding, position);
+                }
+                memcpy(field, token + 1, token_length - 2);
+                field[token_length - 2] = '\0';
+            }
+            else
+            {
+                cJSON item;
+                parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0, 0 };
+                size_t length = 0;
+
+                memset(&item, '\0', sizeof(item));
+                buffer.content = token;
+                buffer.length = token_length;
+                buffer.hooks = global_hooks;
+                buffer.temporary_strings = true;
+                if (!parse_string(&item, &buffer))
+                {
+                    return decode_fail(decoder, cJSON_DecodeSyntaxError, decoder->binding_count, position);
+                }
+                length = strlen(item.valuestring);
+                if (length < bind->size)
+                {
+                    memcpy(field, item.valuestring, length + 1);
+                }
+                free_string(item.valuestring, &global_hooks);
+                if (length >= bind->size)
+                {
+                    return decode_fail(decoder, cJSON_DecodeOverflow, binding, position);
+                }
+            }
+            return true;
 
-    return cJSON_ReplaceItemViaPointer(array, get_array_item(array, (size_t)which), newitem);
+        default:
+            /* arrays */
+            return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
+    }
 }
 
-static cJSON_bool replace_item_in_object(cJSON *object, const char *string, cJSON *replacement, cJSON_bool case_sensitive)
+/* append an element of an array to a number array or list */
+static cJSON_bool decode_element(decoder * const decoder, const size_t binding, const size_t position, const size_t token_length)
 {
-    if ((replacement == NULL) || (string == NULL))
-    {
-        return false;
-    }
+    const cJSON_Binding * const bind = &decoder->bindings[binding];
+    const unsigned char * const token = decoder->content + position;
+    decode_binding * const state = &decoder->states[binding];
+    size_t count = 0;
+    double number = 0;
+    double *numbers = NULL;
 
-    /* replace the name in the replacement */
-    if (!(replacement->type & cJSON_StringIsConst) && (replacement->string != NULL))
+    if (token[0] == 'n')
     {
-        cJSON_free(replacement->string);
+        return true; /* nulls are skipped */
     }
-    replacement->string = (char*)cJSON_strdup((const unsigned char*)string, &global_hooks);
-    if (replacement->string == NULL)
+    if ((token_length == 0) || ((token[0] != '-') && ((token[0] < '0') || (token[0] > '9'))))
     {
-        return false;
+        return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
     }
-
-    replacement->type &= ~cJSON_StringIsConst;
-
-    return cJSON_ReplaceItemViaPointer(object, get_object_item(object, string, case_sensitive), replacement);
-}
-
-CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInObject(cJSON *object, const char *string, cJSON *newitem)
-{
-    return replace_item_in_object(object, string, newitem, false);
-}
-
-CJSON_PUBLIC(cJSON_bool) cJSON_ReplaceItemInObjectCaseSensitive(cJSON *object, const char *string, cJSON *newitem)
-{
-    return replace_item_in_object(object, string, newitem, true);
-}
-
-/* Create basic types: */
-CJSON_PUBLIC(cJSON *) cJSON_CreateNull(void)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
+    if (parse_decimal(token, token_length, &number) != token_length)
     {
-        item->type = cJSON_NULL;
+        return decode_fail(decoder, cJSON_DecodeSyntaxError, decoder->binding_count, position);
     }
 
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateTrue(void)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
+    memcpy(&count, decoder->target + bind->count_offset, sizeof(size_t));
+    if (bind->type == cJSON_BindNumberArray)
     {
-        item->type = cJSON_True;
+        if (count >= bind->size)
+        {
+            return decode_fail(decoder, cJSON_DecodeOverflow, binding, position);
+        }
+        memcpy(decoder->target + bind->offset + (count * sizeof(double)), &number, sizeof(double));
     }
-
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateFalse(void)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
+    else
     {
-        item->type = cJSON_False;
+        memcpy(&numbers, decoder->target + bind->offset, sizeof(double*));
+        if (count == state->capacity)
+        {
+            const size_t capacity = (state->capacity == 0) ? 16 : (state->capacity * 2);
+            double *grown = NULL;
+            if (capacity > ((size_t)-1 / sizeof(double)))
+            {
+                return decode_fail(decoder, cJSON_DecodeNoMemory, binding, position);
+            }
+            grown = (double*)reallocate_with_hooks(&global_hooks, numbers, count * sizeof(double), capacity * sizeof(double));
+            if (grown == NULL)
+            {
+                return decode_fail(decoder, cJSON_DecodeNoMemory, binding, position);
+            }
+            numbers = grown;
+            state->capacity = capacity;
+            memcpy(decoder->target + bind->offset, &numbers, sizeof(double*));
+        }
+        numbers[count] = number;
     }
+    count++;
+    memcpy(decoder->target + bind->count_offset, &count, sizeof(size_t));
 
-    return item;
+    return true;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateBool(cJSON_bool boolean)
+/* check the bindings at the start of a value that's depth containers deep, element is the index in an array.
+ * Returns whether a binding leads into the value or ends at it if it's an array or object. */
+static cJSON_bool decode_value_start(decoder * const decoder, const decode_frame * const frames, const size_t depth, const size_t element, const size_t position, const size_t token_length, cJSON_bool * const tracked)
 {
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
-    {
-        item->type = boolean ? cJSON_True : cJSON_False;
-    }
+    const unsigned char character = decoder->content[position];
+    const cJSON_bool container = (character == '{') || (character == '[');
+    size_t binding = 0;
 
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateNumber(double num)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
+    *tracked = false;
+    for (binding = 0; binding < decoder->binding_count; binding++)
     {
-        item->type = cJSON_Number;
-        item->valuedouble = num;
+        decode_binding * const state = &decoder->states[binding];
+        const int type = decoder->bindings[binding].type;
+        const cJSON_bool array_binding = (type == cJSON_BindNumberArray) || (type == cJSON_BindNumberList);
 
-        /* use saturation in case of overflow */
-        if (num >= INT_MAX)
+        if (depth > 0)
         {
-            item->valueint = INT_MAX;
+            /* only bindings whose path matches up to the enclosing container */
+            if (state->matched != (depth - 1))
+            {
+                continue;
+            }
+            if (state->segment_count == (depth - 1))
+            {
+                /* the binding is for the enclosing container, this is one of its elements */
+                if (array_binding && !frames[depth - 1].object && !decode_element(decoder, binding, position, token_length))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if ((state->segment_count < depth) || !decode_segment_matches(decoder, &decoder->segments[state->first_segment + depth - 1], &frames[depth - 1], element))
+            {
+                continue;
+            }
         }
-        else if (num <= (double)INT_MIN)
+
+        if (state->segment_count == depth)
         {
-            item->valueint = INT_MIN;
+            /* the binding is for this value */
+            state->seen = true;
+            if (!array_binding)
+            {
+                if (!decode_scalar(decoder, binding, position, token_length))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (character != '[')
+            {
+                return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
+            }
         }
-        else
+        else if (!container)
         {
-            item->valueint = (int)num;
+            /* the path goes on below a scalar */
+            return decode_fail(decoder, cJSON_DecodeWrongType, binding, position);
         }
+
+        state->matched = depth;
+        *tracked = true;
     }
 
-    return item;
+    return true;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateString(const char *string)
+static cJSON_bool decode_bindings(decoder * const decoder)
 {
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
+    size_t binding = 0;
+    size_t segment_count = 0;
+
+    /* count the segments */
+    for (binding = 0; binding < decoder->binding_count; binding++)
     {
-        item->type = cJSON_String;
-        item->valuestring = (char*)cJSON_strdup((const unsigned char*)string, &global_hooks);
-        if(!item->valuestring)
+        const cJSON_Binding * const bind = &decoder->bindings[binding];
+        const char *path = bind->path;
+
+        if ((path == NULL) || ((path[0] != '\0') && (path[0] != '/')) || (bind->type < cJSON_BindNumber) || (bind->type > cJSON_BindNumberList))
         {
-            cJSON_Delete(item);
-            return NULL;
+            return decode_fail(decoder, cJSON_DecodeInvalidBinding, binding, 0);
+        }
+        for (; *path != '\0'; path++)
+        {
+            if (*path == '/')
+            {
+                segment_count++;
+            }
         }
     }
 
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateStringReference(const char *string)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if (item != NULL)
+    decoder->states = (decode_binding*)global_hooks.allocate((decoder->binding_count * sizeof(decode_binding)) + (segment_count * sizeof(decode_segment)) + 1);
+    if (decoder->states == NULL)
     {
-        item->type = cJSON_String | cJSON_IsReference;
-        item->valuestring = (char*)cast_away_const(string);
+        return decode_fail(decoder, cJSON_DecodeNoMemory, decoder->binding_count, 0);
     }
+    decoder->segments = (decode_segment*)(void*)(decoder->states + decoder->binding_count);
 
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateObjectReference(const cJSON *child)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if (item != NULL) {
-        item->type = cJSON_Object | cJSON_IsReference;
-        item->child = (cJSON*)cast_away_const(child);
-    }
+    /* split the paths */
+    segment_count = 0;
+    for (binding = 0; binding < decoder->binding_count; binding++)
+    {
+        const cJSON_Binding * const bind = &decoder->bindings[binding];
+        const unsigned char *path = (const unsigned char*)bind->path;
+        decode_binding * const state = &decoder->states[binding];
 
-    return item;
-}
+        memset(state, '\0', sizeof(decode_binding));
+        state->first_segment = segment_count;
+        while (*path == '/')
+        {
+            decode_segment * const segment = &decoder->segments[segment_count++];
+            size_t i = 0;
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateArrayReference(const cJSON *child) {
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if (item != NULL) {
-        item->type = cJSON_Array | cJSON_IsReference;
-        item->child = (cJSON*)cast_away_const(child);
-    }
+            segment->name = ++path;
+            while ((*path != '\0') && (*path != '/'))
+            {
+                path++;
+            }
+            segment->length = (size_t)(path - segment->name);
 
-    return item;
-}
+            /* array indexes are digits without leading zeros */
+            segment->index = 0;
+            if ((segment->length == 0) || ((segment->name[0] == '0') && (segment->length > 1)))
+            {
+                segment->index = (size_t)-1;
+            }
+            for (i = 0; (i < segment->length) && (segment->index != (size_t)-1); i++)
+            {
+                if ((segment->name[i] < '0') || (segment->name[i] > '9') || (segment->index > (((size_t)-1 / 10) - 1)))
+                {
+                    segment->index = (size_t)-1;
+                }
+                else
+                {
+                    segment->index = (segment->index * 10) + (size_t)(segment->name[i] - '0');
+                }
+            }
+            state->segment_count++;
+        }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateRaw(const char *raw)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
-    {
-        item->type = cJSON_Raw;
-        item->valuestring = (char*)cJSON_strdup((const unsigned char*)raw, &global_hooks);
-        if(!item->valuestring)
+        /* arrays start out empty */
+        if ((bind->type == cJSON_BindNumberArray) || (bind->type == cJSON_BindNumberList))
         {
-            cJSON_Delete(item);
-            return NULL;
+            const size_t count = 0;
+            memcpy(decoder->target + bind->count_offset, &count, sizeof(size_t));
+        }
+        if (bind->type == cJSON_BindNumberList)
+        {
+            double *numbers = NULL;
+            memcpy(decoder->target + bind->offset, &numbers, sizeof(double*));
         }
     }
 
-    return item;
+    return true;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateArray(void)
+static cJSON_bool decode_document(decoder * const decoder)
 {
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if(item)
-    {
-        item->type=cJSON_Array;
-    }
+    const unsigned char * const content = decoder->content;
+    const size_t length = decoder->length;
+    decode_frame inline_frames[CJSON_STACK_FRAMES];
+    decode_frame *frames = inline_frames;
+    size_t capacity = sizeof(inline_frames) / sizeof(inline_frames[0]);
+    size_t depth = 0;
+    decode_state state = decode_value;
+    size_t position = 0;
+    cJSON_bool success = false;
 
-    return item;
-}
-
-CJSON_PUBLIC(cJSON *) cJSON_CreateObject(void)
-{
-    cJSON *item = cJSON_New_Item(&global_hooks);
-    if (item)
+    /* skip a UTF-8 BOM */
+    if ((length >= 3) && (strncmp((const char*)content, "\xEF\xBB\xBF", 3) == 0))
     {
-        item->type = cJSON_Object;
+        position = 3;
     }
 
-    return item;
-}
-
-/* Create Arrays: */
-CJSON_PUBLIC(cJSON *) cJSON_CreateIntArray(const int *numbers, int count)
-{
-    size_t i = 0;
-    cJSON *n = NULL;
-    cJSON *p = NULL;
-    cJSON *a = NULL;
-
-    if ((count < 0) || (numbers == NULL))
+    for (;;)
     {
-        return NULL;
-    }
-
-    a = cJSON_CreateArray();
+        unsigned char character = 0;
+        size_t token_length = 0;
 
-    for(i = 0; a && (i < (size_t)count); i++)
-    {
-        n = cJSON_CreateNumber(numbers[i]);
-        if (!n)
+        if ((position < length) && (content[position] <= 32))
         {
-            cJSON_Delete(a);
-            return NULL;
+            position += whitespace_length(content + position, length - position);
         }
-        if(!i)
+        if ((position >= length) || (content[position] == '\0'))
         {
-            a->child = n;
+            break; /* unexpected end of the input */
         }
-        else
+        character = content[position];
+
+        if (((character == ']') && ((state == decode_value_or_end) || (state == decode_comma_or_end)) && !frames[depth - 1].object)
+            || ((character == '}') && ((state == decode_key_or_end) || (state == decode_comma_or_end)) && frames[depth - 1].object))
         {
-            suffix_object(p, n);
+            depth--;
+            if (frames[depth].tracked && (depth > 0))
+            {
+                size_t binding = 0;
+                for (binding = 0; binding < decoder->binding_count; binding++)
+                {
+                    if (decoder->states[binding].matched == depth)
+                    {
+                        decoder->states[binding].matched = depth - 1;
+                    }
+                }
+            }
+            position++;
+            if (depth == 0)
+            {
+                success = true;
+                goto end;
+            }
+            state = decode_comma_or_end;
+            continue;
         }
-        p = n;
-    }
 
-    if (a && a->child) {
-        a->child->prev = n;
-    }
+        switch (state)
+        {
+            case decode_value:
+            case decode_value_or_end:
+            {
+                const cJSON_bool container = (character == '{') || (character == '[');
+                size_t element = 0;
+                cJSON_bool tracked = false;
+
+                if (character == '\"')
+                {
+                    token_length = document_string_length(content + position, length - position);
+                }
+                else if (character == 't')
+                {
+                    token_length = ((length - position) >= 4) && (strncmp((const char*)content + position, "true", 4) == 0) ? 4 : 0;
+                }
+                else if (character == 'f')
+                {
+                    token_length = ((length - position) >= 5) && (strncmp((const char*)content + position, "false", 5) == 0) ? 5 : 0;
+                }
+                else if (character == 'n')
+                {
+                    token_length = ((length - position) >= 4) && (strncmp((const char*)content + position, "null", 4) == 0) ? 4 : 0;
+                }
+                else if ((character == '-') || ((character >= '0') && (character <= '9')))
+                {
+                    token_length = document_number_length(content + position, length - position);
+                    /* a sign has to be followed by a digit */
+                    if ((character == '-') && ((token_length == 1) || (content[position + 1] < '0') || (content[position + 1] > '9')))
+                    {
+                        token_length = 0;
+                    }
+                }
+                if ((token_length == 0) && !container)
+                {
+                    goto syntax_error;
+                }
+
+                if ((depth > 0) && !frames[depth - 1].object)
+                {
+                    element = frames[depth - 1].index++;
+                }
+                if (((depth == 0) || frames[depth - 1].tracked) && !decode_value_start(decoder, frames, depth, element, position, token_length, &tracked))
+                {
+                    goto end;
+                }
+
+                if (container)
+                {
+                    if (depth >= global_context.nesting_limit)
+                    {
+                        goto syntax_error; /* too deeply nested */
+                    }
+                    if (depth == capacity)
+                    {
+                        decode_frame *grown = (decode_frame*)grow_stack(frames, inline_frames, &capacity, sizeof(decode_frame), &global_hooks);
+                        if (grown == NULL)
+                        {
+                            decode_fail(decoder, cJSON_DecodeNoMemory, decoder->binding_count, position);
+                            goto end;
+                        }
+                        frames = grown;
+                    }
+                    frames[depth].index = 0;
+                    frames[depth].object = (character == '{');
+                    frames[depth].tracked = tracked;
+                    depth++;
+                    position++;
+                    state = (character == '{') ? decode_key_or_end : decode_value_or_end;
+                    continue;
+                }
 
-    return a;
-}
+                position += token_length;
+                if (depth == 0)
+                {
+                    success = true;
+                    goto end;
+                }
+                /* most values are directly followed by a comma */
+                if ((position < length) && (content[position] == ','))
+                {
+                    position++;
+                    state = frames[depth - 1].object ? decode_key : decode_value;
+                }
+                else
+                {
+                    state = decode_comma_or_end;
+                }
+                break;
+            }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateFloatArray(const float *numbers, int count)
-{
-    size_t i = 0;
-    cJSON *n = NULL;
-    cJSON *p = NULL;
-    cJSON *a = NULL;
+            case decode_key_or_end:
+            case decode_key:
+                token_length = (character == '\"') ? document_string_length(content + position, length - position) : 0;
+                if (token_length == 0)
+                {
+                    goto syntax_error;
+                }
+                decoder->key = content + position + 1;
+                decoder->key_length = token_length - 2;
+                position += token_length;
+                state = decode_colon;
+                break;
 
-    if ((count < 0) || (numbers == NULL))
-    {
-        return NULL;
-    }
+            case decode_colon:
+                if (character != ':')
+                {
+                    goto syntax_error;
+                }
+                position++;
+                state = decode_value;
+                break;
 
-    a = cJSON_CreateArray();
+            case decode_comma_or_end:
+                if (character != ',')
+                {
+                    goto syntax_error;
+                }
+                position++;
+                state = frames[depth - 1].object ? decode_key : decode_value;
+                break;
 
-    for(i = 0; a && (i < (size_t)count); i++)
-    {
-        n = cJSON_CreateNumber((double)numbers[i]);
-        if(!n)
-        {
-            cJSON_Delete(a);
-            return NULL;
-        }
-        if(!i)
-        {
-            a->child = n;
-        }
-        else
-        {
-            suffix_object(p, n);
+            default:
+                goto syntax_error;
         }
-        p = n;
     }
 
-    if (a && a->child) {
-        a->child->prev = n;
+syntax_error:
+    decode_fail(decoder, cJSON_DecodeSyntaxError, decoder->binding_count, (position < length) ? position : length);
+
+end:
+    if (frames != inline_frames)
+    {
+        global_hooks.deallocate(frames);
     }
 
-    return a;
+    return success;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateDoubleArray(const double *numbers, int count)
+CJSON_PUBLIC(cJSON_bool) cJSON_DecodeWithLength(const char *value, size_t buffer_length, const cJSON_Binding *bindings, size_t binding_count, void *target, cJSON_DecodeError *error)
 {
-    size_t i = 0;
-    cJSON *n = NULL;
-    cJSON *p = NULL;
-    cJSON *a = NULL;
+    decoder decoder;
+    cJSON_DecodeError local_error;
+    size_t binding = 0;
+    cJSON_bool success = false;
 
-    if ((count < 0) || (numbers == NULL))
+    memset(&decoder, '\0', sizeof(decoder));
+    decoder.error = (error != NULL) ? error : &local_error;
+    decoder.error->status = cJSON_DecodeOk;
+    decoder.error->binding = binding_count;
+    decoder.error->offset = 0;
+
+    if ((value == NULL) || (target == NULL) || ((bindings == NULL) && (binding_count > 0)))
     {
-        return NULL;
+        return decode_fail(&decoder, cJSON_DecodeInvalidBinding, binding_count, 0);
     }
 
-    a = cJSON_CreateArray();
+    decoder.content = (const unsigned char*)value;
+    decoder.length = buffer_length;
+    decoder.bindings = bindings;
+    decoder.binding_count = binding_count;
+    decoder.target = (unsigned char*)target;
 
-    for(i = 0; a && (i < (size_t)count); i++)
+    if (!decode_bindings(&decoder))
     {
-        n = cJSON_CreateNumber(numbers[i]);
-        if(!n)
-        {
-            cJSON_Delete(a);
-            return NULL;
-        }
-        if(!i)
+        return false;
+    }
+
+    success = decode_document(&decoder);
+    for (binding = 0; success && (binding < binding_count); binding++)
+    {
+        if (!decoder.states[binding].seen && !bindings[binding].optional)
         {
-            a->child = n;
+            success = decode_fail(&decoder, cJSON_DecodeMissing, binding, 0);
         }
-        else
+    }
+
+    if (!success)
+    {
+        /* don't leave the caller with half filled lists */
+        for (binding = 0; binding < binding_count; binding++)
         {
-            suffix_object(p, n);
+            if (bindings[binding].type == cJSON_BindNumberList)
+            {
+                double *numbers = NULL;
+                const size_t count = 0;
+                memcpy(&numbers, decoder.target + bindings[binding].offset, sizeof(double*));
+                if (numbers != NULL)
+                {
+                    global_hooks.deallocate(numbers);
+                }
+                numbers = NULL;
+                memcpy(decoder.target + bindings[binding].offset, &numbers, sizeof(double*));
+                memcpy(decoder.target + bindings[binding].count_offset, &count, sizeof(size_t));
+            }
         }
-        p = n;
     }
 
-    if (a && a->child) {
-        a->child->prev = n;
-    }
+    global_hooks.deallocate(decoder.states);
 
-    return a;
+    return success;
 }
 
-CJSON_PUBLIC(cJSON *) cJSON_CreateStringArray(const char *const *strings, int count)
+CJSON_PUBLIC(cJSON_bool) cJSON_Decode(const char *value, const cJSON_Binding *bindings, size_t binding_count, void *target, cJSON_DecodeError *error)
 {
-    size_t i = 0;
-    cJSON *n = NULL;
-    cJSON *p = NULL;
-    cJSON *a = NULL;
-
-    if ((count < 0) || (strings == NULL))
+    if (value == NULL)
     {
-        return NULL;
+        return cJSON_DecodeWithLength(NULL, 0, bindings, binding_count, target, error);
     }
 
-    a = cJSON_CreateArray();
+    return cJSON_DecodeWithLength(value, strlen(value), bindings, binding_count, target, error);
+}
 
-    for (i = 0; a && (i < (size_t)count); i++)
+#if CJSON_COMPACT
+/* Compact trees: nodes live in one array and refer to each other by index, arrays that only hold
+ * numbers keep them as a run of doubles in a separate pool instead of one node per value. */
+typedef struct
+{
+    unsigned int next; /* next sibling, 0 for none (node 0 is the root) */
+    unsigned int name; /* offset of the name in the string pool plus one, 0 for none */
+    unsigned int type; /* cJSON type, compact_packed is added for packed arrays */
+    unsigned int count; /* containers: number of children, strings: length */
+    union
     {
-        n = cJSON_CreateString(strings[i]);
-        if(!n)
-        {
-            cJSON_Delete(a);
-            return NULL;
-        }
-        if(!i)
-        {
-            a->child = n;
-        }
-        else
-        {
-            suffix_object(p,n);
-        }
-        p = n;
-    }
-
-    if (a && a->child) {
-        a->child->prev = n;
-    }
+        double number;
+        unsigned int child; /* first child, packed arrays: offset of the first number */
+        unsigned int string; /* offset in the string pool */
+    } value;
+} compact_node;
 
-    return a;
-}
+#define compact_packed 0x10000
 
-/* Duplication */
-cJSON * cJSON_Duplicate_rec(const cJSON *item, size_t depth, cJSON_bool recurse);
+struct cJSON_Compact
+{
+    compact_node *nodes;
+    size_t node_count;
+    size_t node_capacity;
+    char *strings;
+    size_t string_length;
+    size_t string_capacity;
+    double *numbers;
+    size_t number_count;
+    size_t number_capacity;
+    internal_hooks hooks;
+};
 
-CJSON_PUBLIC(cJSON *) cJSON_Duplicate(const cJSON *item, cJSON_bool recurse)
+typedef struct
 {
-    return cJSON_Duplicate_rec(item, 0, recurse );
-}
+    unsigned int node;
+    unsigned int last_child;
+    /* the numbers of the array are still collected in the number pool */
+    cJSON_bool packed;
+} compact_frame;
 
-cJSON * cJSON_Duplicate_rec(const cJSON *item, size_t depth, cJSON_bool recurse)
+typedef struct
 {
-    cJSON *newitem = NULL;
-    cJSON *child = NULL;
-    cJSON *next = NULL;
-    cJSON *newchild = NULL;
+    cJSON_Compact *compact;
+    compact_frame frames[CJSON_NESTING_LIMIT];
+    size_t depth;
+    unsigned int name; /* name for the next value */
+} compact_builder;
+
+/* make room for needed more elements in a pool */
+static cJSON_bool compact_reserve(const cJSON_Compact * const compact, void ** const pool, size_t * const capacity, const size_t used, const size_t needed, const size_t element_size)
+{
+    size_t new_capacity = (*capacity > 0) ? *capacity : 16;
+    void *grown = NULL;
 
-    /* Bail on bad ptr */
-    if (!item)
+    if ((used + needed) <= *capacity)
     {
-        goto fail;
+        return true;
     }
-    /* Create new item */
-    newitem = cJSON_New_Item(&global_hooks);
-    if (!newitem)
+
+    while (new_capacity < (used + needed))
     {
-        goto fail;
+        new_capacity *= 2;
     }
-    /* Copy over all vars */
-    newitem->type = item->type & (~cJSON_IsReference);
-    newitem->valueint = item->valueint;
-    newitem->valuedouble = item->valuedouble;
-    if (item->valuestring)
+    /* everything is addressed with 32 bit offsets */
+    if ((new_capacity > UINT_MAX) || (new_capacity > (((size_t)-1) / element_size)))
     {
-        newitem->valuestring = (char*)cJSON_strdup((unsigned char*)item->valuestring, &global_hooks);
-        if (!newitem->valuestring)
-        {
-            goto fail;
-        }
+        return false;
     }
-    if (item->string)
+
+    grown = reallocate_with_hooks(&compact->hooks, *pool, used * element_size, new_capacity * element_size);
+    if (grown == NULL)
     {
-        newitem->string = (item->type&cJSON_StringIsConst) ? item->string : (char*)cJSON_strdup((unsigned char*)item->string, &global_hooks);
-        if (!newitem->string)
-        {
-            goto fail;
-        }
+        return false;
     }
-    /* If non-recursive, then we're done! */
-    if (!recurse)
+    *pool = grown;
+    *capacity = new_capacity;
+
+    return true;
+}
+
+/* append a node to the innermost container */
+static compact_node *compact_link(compact_builder * const builder, const unsigned int type, const unsigned int name)
+{
+    cJSON_Compact * const compact = builder->compact;
+    compact_node *node = NULL;
+    void *pool = compact->nodes;
+    unsigned int index = 0;
+
+    if (!compact_reserve(compact, &pool, &compact->node_capacity, compact->node_count, 1, sizeof(compact_node)))
     {
-        return newitem;
+        return NULL;
     }
-    /* Walk the ->next chain for the child. */
-    child = item->child;
-    while (child != NULL)
+    compact->nodes = (compact_node*)pool;
+
+    index = (unsigned int)compact->node_count++;
+    node = compact->nodes + index;
+    memset(node, '\0', sizeof(compact_node));
+    node->type = type;
+    node->name = name;
+
+    if (builder->depth > 0)
     {
-        if(depth >= CJSON_CIRCULAR_LIMIT) {
-            goto fail;
-        }
-        newchild = cJSON_Duplicate_rec(child, depth + 1, true); /* Duplicate (with recurse) each item in the ->next chain */
-        if (!newchild)
-        {
-            goto fail;
-        }
-        if (next != NULL)
+        compact_frame * const frame = &builder->frames[builder->depth - 1];
+        compact_node * const parent = compact->nodes + frame->node;
+        if (frame->last_child == 0)
         {
-            /* If newitem->child already set, then crosswire ->prev and ->next and move on */
-            next->next = newchild;
-            newchild->prev = next;
-            next = newchild;
+            parent->value.child = index;
         }
         else
         {
-            /* Set newitem->child and move to it */
-            newitem->child = newchild;
-            next = newchild;
+            compact->nodes[frame->last_child].next = index;
         }
-        child = child->next;
-    }
-    if (newitem && newitem->child)
-    {
-        newitem->child->prev = newchild;
+        frame->last_child = index;
+        parent->count++;
     }
 
-    return newitem;
+    return node;
+}
 
-fail:
-    if (newitem != NULL)
-    {
-        cJSON_Delete(newitem);
+/* the innermost array turned out not to hold only numbers, give them nodes after all */
+static cJSON_bool compact_unpack(compact_builder * const builder)
+{
+    cJSON_Compact * const compact = builder->compact;
+    compact_frame * const frame = &builder->frames[builder->depth - 1];
+    const unsigned int count = compact->nodes[frame->node].count;
+    const size_t start = compact->number_count - count;
+    unsigned int index = 0;
+
+    frame->packed = false;
+    compact->nodes[frame->node].count = 0;
+    for (index = 0; index < count; index++)
+    {
+        compact_node * const node = compact_link(builder, cJSON_Number, 0);
+        if (node == NULL)
+        {
+            return false;
+        }
+        node->value.number = compact->numbers[start + index];
     }
+    compact->number_count = start;
 
-    return NULL;
+    return true;
 }
 
-static void skip_oneline_comment(char **input)
+static compact_node *compact_add(compact_builder * const builder, const unsigned int type)
 {
-    *input += static_strlen("//");
+    const unsigned int name = builder->name;
 
-    for (; (*input)[0] != '\0'; ++(*input))
+    if ((builder->depth > 0) && builder->frames[builder->depth - 1].packed && !compact_unpack(builder))
     {
-        if ((*input)[0] == '\n') {
-            *input += static_strlen("\n");
-            return;
-        }
+        return NULL;
     }
+    builder->name = 0;
+
+    return compact_link(builder, type, name);
 }
 
-static void skip_multiline_comment(char **input)
+/* copy a string into the string pool, returns its offset */
+static cJSON_bool compact_add_string(cJSON_Compact * const compact, const char * const string, const size_t length, unsigned int * const offset)
 {
-    *input += static_strlen("/*");
+    void *pool = compact->strings;
 
-    for (; (*input)[0] != '\0'; ++(*input))
+    if (!compact_reserve(compact, &pool, &compact->string_capacity, compact->string_length, length + 1, 1))
     {
-        if (((*input)[0] == '*') && ((*input)[1] == '/'))
-        {
-            *input += static_strlen("*/");
-            return;
-        }
+        return false;
     }
-}
+    compact->strings = (char*)pool;
 
-static void minify_string(char **input, char **output) {
-    (*output)[0] = (*input)[0];
-    *input += static_strlen("\"");
-    *output += static_strlen("\"");
+    *offset = (unsigned int)compact->string_length;
+    memcpy(compact->strings + compact->string_length, string, length + 1);
+    compact->string_length += length + 1;
 
-
-    for (; (*input)[0] != '\0'; (void)++(*input), ++(*output)) {
-        (*output)[0] = (*input)[0];
-
-        if ((*input)[0] == '\"') {
-            (*output)[0] = '\"';
-            *input += static_strlen("\"");
-            *output += static_strlen("\"");
-            return;
-        } else if (((*input)[0] == '\\') && ((*input)[1] == '\"')) {
-            (*output)[1] = (*input)[1];
-            *input += static_strlen("\"");
-            *output += static_strlen("\"");
-        }
-    }
+    return true;
 }
 
-CJSON_PUBLIC(void) cJSON_Minify(char *json)
+static cJSON_bool compact_start(compact_builder * const builder, const unsigned int type)
 {
-    char *into = json;
+    compact_node * const node = compact_add(builder, type);
 
-    if (json == NULL)
+    if ((node == NULL) || (builder->depth >= CJSON_NESTING_LIMIT))
     {
-        return;
+        return false;
     }
 
-    while (json[0] != '\0')
-    {
-        switch (json[0])
-        {
-            case ' ':
-            case '\t':
-            case '\r':
-            case '\n':
-                json++;
-                break;
+    builder->frames[builder->depth].node = (unsigned int)(node - builder->compact->nodes);
+    builder->frames[builder->depth].last_child = 0;
+    builder->frames[builder->depth].packed = (type == cJSON_Array);
+    builder->depth++;
 
-            case '/':
-                if (json[1] == '/')
-                {
-                    skip_oneline_comment(&json);
-                }
-                else if (json[1] == '*')
-                {
-                    skip_multiline_comment(&json);
-                } else {
-                    json++;
-                }
-                break;
+    return true;
+}
 
-            case '\"':
-                minify_string(&json, (char**)&into);
-                break;
+static cJSON_bool compact_start_object(void *user_data)
+{
+    return compact_start((compact_builder*)user_data, cJSON_Object);
+}
+
+static cJSON_bool compact_start_array(void *user_data)
+{
+    return compact_start((compact_builder*)user_data, cJSON_Array);
+}
+
+static cJSON_bool compact_end(void *user_data)
+{
+    compact_builder * const builder = (compact_builder*)user_data;
+    const compact_frame * const frame = &builder->frames[--builder->depth];
+    compact_node * const node = builder->compact->nodes + frame->node;
 
-            default:
-                into[0] = json[0];
-                json++;
-                into++;
-        }
+    if (frame->packed && (node->count > 0))
+    {
+        node->type |= compact_packed;
+        node->value.child = (unsigned int)(builder->compact->number_count - node->count);
     }
 
-    /* and null-terminate. */
-    *into = '\0';
+    return true;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsInvalid(const cJSON * const item)
+static cJSON_bool compact_key(void *user_data, const char *key, size_t length)
 {
-    if (item == NULL)
+    compact_builder * const builder = (compact_builder*)user_data;
+    unsigned int offset = 0;
+
+    if (!compact_add_string(builder->compact, key, length, &offset))
     {
         return false;
     }
+    builder->name = offset + 1;
 
-    return (item->type & 0xFF) == cJSON_Invalid;
+    return true;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsFalse(const cJSON * const item)
+static cJSON_bool compact_string(void *user_data, const char *string, size_t length)
 {
-    if (item == NULL)
+    compact_builder * const builder = (compact_builder*)user_data;
+    compact_node * const node = compact_add(builder, cJSON_String);
+    unsigned int offset = 0;
+
+    if ((node == NULL) || !compact_add_string(builder->compact, string, length, &offset))
     {
         return false;
     }
+    /* the string pool may have moved, but the node pool didn't */
+    node->value.string = offset;
+    node->count = (unsigned int)length;
 
-    return (item->type & 0xFF) == cJSON_False;
+    return true;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsTrue(const cJSON * const item)
+static cJSON_bool compact_number(void *user_data, double number)
 {
-    if (item == NULL)
+    compact_builder * const builder = (compact_builder*)user_data;
+    cJSON_Compact * const compact = builder->compact;
+    compact_node *node = NULL;
+    void *pool = compact->numbers;
+
+    if ((builder->depth > 0) && builder->frames[builder->depth - 1].packed)
+    {
+        if (!compact_reserve(compact, &pool, &compact->number_capacity, compact->number_count, 1, sizeof(double)))
+        {
+            return false;
+        }
+        compact->numbers = (double*)pool;
+        compact->numbers[compact->number_count++] = number;
+        compact->nodes[builder->frames[builder->depth - 1].node].count++;
+        return true;
+    }
+
+    node = compact_add(builder, cJSON_Number);
+    if (node == NULL)
     {
         return false;
     }
+    node->value.number = number;
 
-    return (item->type & 0xff) == cJSON_True;
+    return true;
 }
 
+static cJSON_bool compact_boolean(void *user_data, cJSON_bool boolean)
+{
+    return compact_add((compact_builder*)user_data, boolean ? cJSON_True : cJSON_False) != NULL;
+}
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsBool(const cJSON * const item)
+static cJSON_bool compact_null(void *user_data)
 {
-    if (item == NULL)
+    return compact_add((compact_builder*)user_data, cJSON_NULL) != NULL;
+}
+
+CJSON_PUBLIC(cJSON_Compact *) cJSON_ParseCompactWithLength(const char *value, size_t buffer_length)
+{
+    static const cJSON_StreamCallbacks callbacks = {
+        compact_start_object,
+        compact_end,
+        compact_start_array,
+        compact_end,
+        compact_key,
+        compact_string,
+        compact_number,
+        compact_boolean,
+        compact_null
+    };
+    compact_builder *builder = NULL;
+    cJSON_StreamParser *parser = NULL;
+    cJSON_Compact *compact = NULL;
+    cJSON_bool success = false;
+
+    if (value == NULL)
     {
-        return false;
+        return NULL;
     }
 
-    return (item->type & (cJSON_True | cJSON_False)) != 0;
-}
-CJSON_PUBLIC(cJSON_bool) cJSON_IsNull(const cJSON * const item)
-{
-    if (item == NULL)
+    compact = (cJSON_Compact*)global_hooks.allocate(sizeof(cJSON_Compact));
+    builder = (compact_builder*)global_hooks.allocate(sizeof(compact_builder));
+    if ((compact == NULL) || (builder == NULL))
     {
-        return false;
+        goto fail;
     }
+    memset(compact, '\0', sizeof(cJSON_Compact));
+    compact->hooks = global_hooks;
+    builder->compact = compact;
+    builder->depth = 0;
+    builder->name = 0;
 
-    return (item->type & 0xFF) == cJSON_NULL;
-}
+    parser = cJSON_CreateStreamParser(&callbacks, builder);
+    if (parser == NULL)
+    {
+        goto fail;
+    }
+    success = cJSON_FeedStreamParser(parser, value, buffer_length) && cJSON_FinishStreamParser(parser);
+    cJSON_DeleteStreamParser(parser);
+    if (!success)
+    {
+        goto fail;
+    }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsNumber(const cJSON * const item)
-{
-    if (item == NULL)
+    global_hooks.deallocate(builder);
+    return compact;
+
+fail:
+    if (builder != NULL)
     {
-        return false;
+        global_hooks.deallocate(builder);
     }
+    cJSON_DeleteCompact(compact);
 
-    return (item->type & 0xFF) == cJSON_Number;
+    return NULL;
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsString(const cJSON * const item)
+CJSON_PUBLIC(cJSON_Compact *) cJSON_ParseCompact(const char *value)
 {
-    if (item == NULL)
+    if (value == NULL)
     {
-        return false;
+        return NULL;
     }
 
-    return (item->type & 0xFF) == cJSON_String;
+    return cJSON_ParseCompactWithLength(value, strlen(value));
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsArray(const cJSON * const item)
+CJSON_PUBLIC(void) cJSON_DeleteCompact(cJSON_Compact *compact)
 {
-    if (item == NULL)
+    if (compact == NULL)
     {
-        return false;
+        return;
     }
 
-    return (item->type & 0xFF) == cJSON_Array;
+    if (compact->nodes != NULL)
+    {
+        compact->hooks.deallocate(compact->nodes);
+    }
+    if (compact->strings != NULL)
+    {
+        compact->hooks.deallocate(compact->strings);
+    }
+    if (compact->numbers != NULL)
+    {
+        compact->hooks.deallocate(compact->numbers);
+    }
+    compact->hooks.deallocate(compact);
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsObject(const cJSON * const item)
+CJSON_PUBLIC(size_t) cJSON_GetCompactMemory(const cJSON_Compact *compact)
 {
-    if (item == NULL)
+    if (compact == NULL)
     {
-        return false;
+        return 0;
     }
 
-    return (item->type & 0xFF) == cJSON_Object;
+    return sizeof(cJSON_Compact) + (compact->node_capacity * sizeof(compact_node))
+        + compact->string_capacity + (compact->number_capacity * sizeof(double));
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_IsRaw(const cJSON * const item)
+static cJSON_CompactItem make_compact_item(const cJSON_Compact * const compact, const unsigned int node, const unsigned int element)
 {
-    if (item == NULL)
+    cJSON_CompactItem item;
+
+    item.compact = compact;
+    item.node = node;
+    item.element = element;
+
+    return item;
+}
+
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactRoot(const cJSON_Compact *compact)
+{
+    return make_compact_item(compact, 0, 0);
+}
+
+CJSON_PUBLIC(int) cJSON_GetCompactType(const cJSON_CompactItem item)
+{
+    if (item.compact == NULL)
     {
-        return false;
+        return cJSON_Invalid;
+    }
+    if (item.element > 0)
+    {
+        return cJSON_Number;
     }
 
-    return (item->type & 0xFF) == cJSON_Raw;
+    return (int)(item.compact->nodes[item.node].type & ~compact_packed);
 }
 
-CJSON_PUBLIC(cJSON_bool) cJSON_Compare(const cJSON * const a, const cJSON * const b, const cJSON_bool case_sensitive)
+static cJSON_CompactItem get_compact_object_item(const cJSON_CompactItem object, const char * const name, const cJSON_bool case_sensitive)
 {
-    if ((a == NULL) || (b == NULL) || ((a->type & 0xFF) != (b->type & 0xFF)))
+    const compact_node *nodes = NULL;
+    unsigned int index = 0;
+
+    if ((name == NULL) || (cJSON_GetCompactType(object) != cJSON_Object))
     {
-        return false;
+        return make_compact_item(NULL, 0, 0);
     }
 
-    /* check if type is valid */
-    switch (a->type & 0xFF)
+    nodes = object.compact->nodes;
+    for (index = (nodes[object.node].count > 0) ? nodes[object.node].value.child : 0; index != 0; index = nodes[index].next)
     {
-        case cJSON_False:
-        case cJSON_True:
-        case cJSON_NULL:
-        case cJSON_Number:
-        case cJSON_String:
-        case cJSON_Raw:
-        case cJSON_Array:
-        case cJSON_Object:
-            break;
-
-        default:
-            return false;
+        const char * const current = object.compact->strings + nodes[index].name - 1;
+        if (case_sensitive ? (strcmp(current, name) == 0)
+            : (case_insensitive_strcmp((const unsigned char*)current, (const unsigned char*)name) == 0))
+        {
+            return make_compact_item(object.compact, index, 0);
+        }
     }
 
-    /* identical objects are equal */
-    if (a == b)
+    return make_compact_item(NULL, 0, 0);
+}
+
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactObjectItem(const cJSON_CompactItem object, const char *string)
+{
+    return get_compact_object_item(object, string, false);
+}
+
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactObjectItemCaseSensitive(const cJSON_CompactItem object, const char *string)
+{
+    return get_compact_object_item(object, string, true);
+}
+
+CJSON_PUBLIC(int) cJSON_GetCompactArraySize(const cJSON_CompactItem array)
+{
+    if (cJSON_GetCompactType(array) != cJSON_Array)
     {
-        return true;
+        return 0;
     }
 
-    switch (a->type & 0xFF)
-    {
-        /* in these cases and equal type is enough */
-        case cJSON_False:
-        case cJSON_True:
-        case cJSON_NULL:
-            return true;
+    return (int)array.compact->nodes[array.node].count;
+}
 
-        case cJSON_Number:
-            if (compare_double(a->valuedouble, b->valuedouble))
-            {
-                return true;
-            }
-            return false;
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactArrayItem(const cJSON_CompactItem array, int index)
+{
+    const compact_node *nodes = NULL;
+    unsigned int child = 0;
 
-        case cJSON_String:
-        case cJSON_Raw:
-            if ((a->valuestring == NULL) || (b->valuestring == NULL))
-            {
-                return false;
-            }
-            if (strcmp(a->valuestring, b->valuestring) == 0)
-            {
-                return true;
-            }
+    if ((index < 0) || (index >= cJSON_GetCompactArraySize(array)))
+    {
+        return make_compact_item(NULL, 0, 0);
+    }
 
-            return false;
+    nodes = array.compact->nodes;
+    if (nodes[array.node].type & compact_packed)
+    {
+        return make_compact_item(array.compact, array.node, (unsigned int)index + 1);
+    }
 
-        case cJSON_Array:
-        {
-            cJSON *a_element = a->child;
-            cJSON *b_element = b->child;
+    for (child = nodes[array.node].value.child; index > 0; index--)
+    {
+        child = nodes[child].next;
+    }
 
-            for (; (a_element != NULL) && (b_element != NULL);)
-            {
-                if (!cJSON_Compare(a_element, b_element, case_sensitive))
-                {
-                    return false;
-                }
+    return make_compact_item(array.compact, child, 0);
+}
 
-                a_element = a_element->next;
-                b_element = b_element->next;
-            }
+CJSON_PUBLIC(const double *) cJSON_GetCompactNumbers(const cJSON_CompactItem array, int *count)
+{
+    const compact_node *node = NULL;
 
-            /* one of the arrays is longer than the other */
-            if (a_element != b_element) {
-                return false;
-            }
+    if (cJSON_GetCompactType(array) != cJSON_Array)
+    {
+        return NULL;
+    }
 
-            return true;
-        }
+    node = array.compact->nodes + array.node;
+    if (!(node->type & compact_packed))
+    {
+        return NULL;
+    }
 
-        case cJSON_Object:
-        {
-            cJSON *a_element = NULL;
-            cJSON *b_element = NULL;
-            cJSON_ArrayForEach(a_element, a)
-            {
-                /* TODO This has O(n^2) runtime, which is horrible! */
-                b_element = get_object_item(b, a_element->string, case_sensitive);
-                if (b_element == NULL)
-                {
-                    return false;
-                }
+    if (count != NULL)
+    {
+        *count = (int)node->count;
+    }
 
-                if (!cJSON_Compare(a_element, b_element, case_sensitive))
-                {
-                    return false;
-                }
-            }
+    return array.compact->numbers + node->value.child;
+}
 
-            /* doing this twice, once on a and b to prevent true comparison if a subset of b
-             * TODO: Do this the proper way, this is just a fix for now */
-            cJSON_ArrayForEach(b_element, b)
-            {
-                a_element = get_object_item(a, b_element->string, case_sensitive);
-                if (a_element == NULL)
-                {
-                    return false;
-                }
+CJSON_PUBLIC(double) cJSON_GetCompactNumberValue(const cJSON_CompactItem item)
+{
+    if (cJSON_GetCompactType(item) != cJSON_Number)
+    {
+        return (double) NAN;
+    }
 
-                if (!cJSON_Compare(b_element, a_element, case_sensitive))
-                {
-                    return false;
-                }
-            }
+    if (item.element > 0)
+    {
+        return item.compact->numbers[item.compact->nodes[item.node].value.child + item.element - 1];
+    }
 
-            return true;
-        }
+    return item.compact->nodes[item.node].value.number;
+}
 
-        default:
-            return false;
+CJSON_PUBLIC(const char *) cJSON_GetCompactStringValue(const cJSON_CompactItem item)
+{
+    if (cJSON_GetCompactType(item) != cJSON_String)
+    {
+        return NULL;
     }
+
+    return item.compact->strings + item.compact->nodes[item.node].value.string;
 }
+#endif /* CJSON_COMPACT */
 
 CJSON_PUBLIC(void *) cJSON_malloc(size_t size)
 {
@@ -3189,3 +9976,38 @@ CJSON_PUBLIC(void) cJSON_free(void *object)
     global_hooks.deallocate(object);
     object = NULL;
 }
+
+CJSON_PUBLIC(void) cJSON_GetPoolStats(cJSON_PoolStats *stats)
+{
+#if CJSON_POOL
+    size_t index = 0;
+#endif
+
+    if (stats == NULL)
+    {
+        return;
+    }
+
+#if CJSON_POOL
+    memset(stats, '\0', sizeof(cJSON_PoolStats));
+    for (index = 0; index < POOL_HOOK_SETS; index++)
+    {
+        stats->cached_nodes += pool.sets[index].cached_nodes;
+        stats->cached_strings += pool.sets[index].cached_strings;
+    }
+    stats->cached_bytes = pool.cached_bytes;
+    stats->reused = pool.reused;
+    stats->allocated = pool.allocated;
+#else
+    memset(stats, '\0', sizeof(cJSON_PoolStats));
+#endif
+}
+
+CJSON_PUBLIC(void) cJSON_TrimPool(size_t keep_bytes)
+{
+#if CJSON_POOL
+    pool_trim(keep_bytes);
+#else
+    (void)keep_bytes;
+#endif
+}
@@ -0,0 +1,156 @@
+/* Memory used by a parsed chart response: classic cJSON items against the compact layout.
+ * Usage: compact_memory [file.json ...], without files a response with 1000 closes is generated. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cJSON.h"
+
+/* live bytes of the classic tree, counted through the hooks */
+static size_t live_bytes = 0;
+static size_t allocations = 0;
+
+typedef union
+{
+    size_t size;
+    double align;
+} header;
+
+static void *counting_malloc(size_t size)
+{
+    header *block = (header*)malloc(sizeof(header) + size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->size = size;
+    live_bytes += size;
+    allocations++;
+    return block + 1;
+}
+
+static void counting_free(void *pointer)
+{
+    header *block = NULL;
+    if (pointer == NULL)
+    {
+        return;
+    }
+    block = (header*)pointer - 1;
+    live_bytes -= block->size;
+    free(block);
+}
+
+static char *generate_chart(int closes)
+{
+    size_t size = 256 + (size_t)closes * 48;
+    char *json = (char*)malloc(size);
+    size_t length = 0;
+    int i = 0;
+
+    length += (size_t)sprintf(json + length, "{\"chart\":{\"result\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AAPL\","
+        "\"regularMarketPrice\":189.84,\"previousClose\":187.15},\"timestamp\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%d", (i > 0) ? "," : "", 1700000000 + i * 86400);
+    }
+    length += (size_t)sprintf(json + length, "],\"indicators\":{\"quote\":[{\"close\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%.2f", (i > 0) ? "," : "", 150.0 + (i % 97) * 0.37);
+    }
+    sprintf(json + length, "]}]}}],\"error\":null}}");
+
+    return json;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *json = NULL;
+    long size = 0;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    json = (char*)malloc((size_t)size + 1);
+    if ((json != NULL) && (fread(json, 1, (size_t)size, file) != (size_t)size))
+    {
+        free(json);
+        json = NULL;
+    }
+    if (json != NULL)
+    {
+        json[size] = '\0';
+    }
+    fclose(file);
+
+    return json;
+}
+
+static void measure(const char *name, const char *json)
+{
+    cJSON *tree = NULL;
+    cJSON_Compact *compact = NULL;
+    size_t classic_bytes = 0;
+    size_t classic_allocations = 0;
+
+    /* nodes recycled from an earlier parse wouldn't be counted */
+    cJSON_TrimPool(0);
+    live_bytes = 0;
+    allocations = 0;
+    tree = cJSON_Parse(json);
+    classic_bytes = live_bytes;
+    classic_allocations = allocations;
+
+    compact = cJSON_ParseCompact(json);
+    if ((tree == NULL) || (compact == NULL))
+    {
+        printf("%-24s parse failed\n", name);
+    }
+    else
+    {
+        printf("%-24s %10lu %12lu bytes (%lu allocations) %12lu bytes  x%.1f\n", name, (unsigned long)strlen(json),
+            (unsigned long)classic_bytes, (unsigned long)classic_allocations,
+            (unsigned long)cJSON_GetCompactMemory(compact), (double)classic_bytes / (double)cJSON_GetCompactMemory(compact));
+    }
+
+    cJSON_Delete(tree);
+    cJSON_DeleteCompact(compact);
+}
+
+int main(int argc, char **argv)
+{
+    cJSON_Hooks hooks;
+    int i = 0;
+
+    hooks.malloc_fn = counting_malloc;
+    hooks.free_fn = counting_free;
+    cJSON_InitHooks(&hooks);
+
+    printf("%-24s %10s %12s %31s\n", "input", "size", "classic", "compact");
+    if (argc < 2)
+    {
+        char *json = generate_chart(1000);
+        measure("chart, 1000 closes", json);
+        free(json);
+        return 0;
+    }
+
+    for (i = 1; i < argc; i++)
+    {
+        char *json = read_file(argv[i]);
+        if (json == NULL)
+        {
+            printf("%-24s cannot be read\n", argv[i]);
+            continue;
+        }
+        measure(argv[i], json);
+        free(json);
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/* Filling a struct from a chart response: cJSON_Decode against parsing the tree and walking it.
+ * Usage: decode [file.json ...], without files a response with 1000 closes is generated. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+#include "cJSON.h"
+
+typedef struct
+{
+    char symbol[32];
+    char currency[8];
+    double price;
+    double previous_close;
+    double *closes;
+    size_t close_count;
+} quote;
+
+static const cJSON_Binding quote_bindings[] =
+{
+    { "/chart/result/0/meta/symbol", cJSON_BindString, offsetof(quote, symbol), sizeof(((quote*)0)->symbol), 0, 0 },
+    { "/chart/result/0/meta/currency", cJSON_BindString, offsetof(quote, currency), sizeof(((quote*)0)->currency), 0, 1 },
+    { "/chart/result/0/meta/regularMarketPrice", cJSON_BindNumber, offsetof(quote, price), 0, 0, 0 },
+    { "/chart/result/0/meta/previousClose", cJSON_BindNumber, offsetof(quote, previous_close), 0, 0, 1 },
+    { "/chart/result/0/indicators/quote/0/close", cJSON_BindNumberList, offsetof(quote, closes), 0, offsetof(quote, close_count), 0 }
+};
+
+static char *generate_chart(int closes)
+{
+    size_t size = 256 + (size_t)closes * 48;
+    char *json = (char*)malloc(size);
+    size_t length = 0;
+    int i = 0;
+
+    length += (size_t)sprintf(json + length, "{\"chart\":{\"result\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AAPL\","
+        "\"regularMarketPrice\":189.84,\"previousClose\":187.15},\"timestamp\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%d", (i > 0) ? "," : "", 1700000000 + i * 86400);
+    }
+    length += (size_t)sprintf(json + length, "],\"indicators\":{\"quote\":[{\"close\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%.2f", (i > 0) ? "," : "", 150.0 + (i % 97) * 0.37);
+    }
+    sprintf(json + length, "]}]}}],\"error\":null}}");
+
+    return json;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *json = NULL;
+    long size = 0;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    json = (char*)malloc((size_t)size + 1);
+    if ((json != NULL) && (fread(json, 1, (size_t)size, file) != (size_t)size))
+    {
+        free(json);
+        json = NULL;
+    }
+    if (json != NULL)
+    {
+        json[size] = '\0';
+    }
+    fclose(file);
+
+    return json;
+}
+
+/* the same fields the way main.c gets them */
+static int walk_tree(const char *json, quote *out)
+{
+    cJSON *root = cJSON_Parse(json);
+    cJSON *result = cJSON_GetArrayItem(cJSON_GetObjectItemCaseSensitive(cJSON_GetObjectItemCaseSensitive(root, "chart"), "result"), 0);
+    cJSON *meta = cJSON_GetObjectItemCaseSensitive(result, "meta");
+    cJSON *quotes = cJSON_GetObjectItemCaseSensitive(cJSON_GetObjectItemCaseSensitive(result, "indicators"), "quote");
+    cJSON *closes = cJSON_GetObjectItemCaseSensitive(cJSON_GetArrayItem(quotes, 0), "close");
+    cJSON *symbol = cJSON_GetObjectItemCaseSensitive(meta, "symbol");
+    cJSON *currency = cJSON_GetObjectItemCaseSensitive(meta, "currency");
+    cJSON *element = NULL;
+    int ok = 0;
+
+    memset(out, '\0', sizeof(*out));
+    if (cJSON_IsString(symbol) && cJSON_IsArray(closes))
+    {
+        strncpy(out->symbol, symbol->valuestring, sizeof(out->symbol) - 1);
+        if (cJSON_IsString(currency))
+        {
+            strncpy(out->currency, currency->valuestring, sizeof(out->currency) - 1);
+        }
+        out->price = cJSON_GetNumberValue(cJSON_GetObjectItemCaseSensitive(meta, "regularMarketPrice"));
+        out->previous_close = cJSON_GetNumberValue(cJSON_GetObjectItemCaseSensitive(meta, "previousClose"));
+        out->closes = (double*)malloc(sizeof(double) * (size_t)(cJSON_GetArraySize(closes) + 1));
+        cJSON_ArrayForEach(element, closes)
+        {
+            if (cJSON_IsNumber(element))
+            {
+                out->closes[out->close_count++] = element->valuedouble;
+            }
+        }
+        ok = 1;
+    }
+    cJSON_Delete(root);
+
+    return ok;
+}
+
+static double seconds(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void measure(const char *name, const char *json)
+{
+    const size_t length = strlen(json);
+    const int runs = (int)(200000000 / (length + 1)) + 1;
+    cJSON_DecodeError error;
+    quote decoded;
+    quote walked;
+    double decode_time = 0;
+    double walk_time = 0;
+    clock_t start = 0;
+    int i = 0;
+
+    if (!cJSON_Decode(json, quote_bindings, sizeof(quote_bindings) / sizeof(quote_bindings[0]), &decoded, &error))
+    {
+        printf("%-24s decode failed: status %d, binding %lu, offset %lu\n", name, error.status, (unsigned long)error.binding, (unsigned long)error.offset);
+        return;
+    }
+    if (!walk_tree(json, &walked) || (walked.close_count != decoded.close_count)
+        || (memcmp(walked.closes, decoded.closes, decoded.close_count * sizeof(double)) != 0))
+    {
+        printf("%-24s results differ\n", name);
+    }
+    cJSON_free(decoded.closes);
+    free(walked.closes);
+
+    start = clock();
+    for (i = 0; i < runs; i++)
+    {
+        cJSON_Decode(json, quote_bindings, sizeof(quote_bindings) / sizeof(quote_bindings[0]), &decoded, NULL);
+        cJSON_free(decoded.closes);
+    }
+    decode_time = seconds(start);
+
+    start = clock();
+    for (i = 0; i < runs; i++)
+    {
+        walk_tree(json, &walked);
+        free(walked.closes);
+    }
+    walk_time = seconds(start);
+
+    printf("%-24s %10lu %10.1f MB/s %10.1f MB/s  x%.1f\n", name, (unsigned long)length,
+        (double)length * runs / walk_time / 1e6, (double)length * runs / decode_time / 1e6, walk_time / decode_time);
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+
+    printf("%-24s %10s %15s %15s\n", "input", "size", "parse+walk", "decode");
+    if (argc < 2)
+    {
+        char *json = generate_chart(1000);
+        measure("chart, 1000 closes", json);
+        free(json);
+        return 0;
+    }
+
+    for (i = 1; i < argc; i++)
+    {
+        char *json = read_file(argv[i]);
+        if (json == NULL)
+        {
+            printf("%-24s cannot be read\n", argv[i]);
+            continue;
+        }
+        measure(argv[i], json);
+        free(json);
+    }
+
+    return 0;
+}
@@ -0,0 +1,336 @@
+/* Randomized check of cJSON_Minify against the byte at a time minifier it replaced, and of cJSON_IsValidUTF8
+ * against a decoder that computes every code point. Built once per instruction set by make -f Makefile.bench check.
+ * Usage: minify_fuzz [iterations] [seed] */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cJSON.h"
+
+static unsigned long long random_state = 0;
+
+static unsigned long long next_random(void)
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 2685821657736338717ULL;
+}
+
+static size_t random_below(const size_t limit)
+{
+    return (size_t)(next_random() % limit);
+}
+
+/* the scalar minifier from before vectorization, except that a backslash in a string escapes any character,
+ * not only a quote, which is what cJSON_Minify does now */
+static void reference_minify(char *json)
+{
+    char *into = json;
+
+    while (json[0] != '\0')
+    {
+        switch (json[0])
+        {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                json++;
+                break;
+
+            case '/':
+                if (json[1] == '/')
+                {
+                    for (json += 2; (json[0] != '\0') && (json[0] != '\n'); json++)
+                    {
+                    }
+                    if (json[0] == '\n')
+                    {
+                        json++;
+                    }
+                }
+                else if (json[1] == '*')
+                {
+                    for (json += 2; json[0] != '\0'; json++)
+                    {
+                        if ((json[0] == '*') && (json[1] == '/'))
+                        {
+                            json += 2;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    json++;
+                }
+                break;
+
+            case '\"':
+                *into++ = *json++;
+                while (json[0] != '\0')
+                {
+                    if (json[0] == '\"')
+                    {
+                        *into++ = *json++;
+                        break;
+                    }
+                    if ((json[0] == '\\') && (json[1] != '\0'))
+                    {
+                        *into++ = *json++;
+                    }
+                    *into++ = *json++;
+                }
+                break;
+
+            default:
+                *into++ = *json++;
+        }
+    }
+
+    *into = '\0';
+}
+
+/* decode every sequence and check the code point, independent of the lead byte ranges cJSON uses */
+static cJSON_bool reference_valid_utf8(const unsigned char *data, const size_t length)
+{
+    size_t position = 0;
+
+    while (position < length)
+    {
+        const unsigned char lead = data[position];
+        unsigned long codepoint = 0;
+        size_t sequence_length = 0;
+        size_t i = 0;
+
+        if (lead < 0x80)
+        {
+            position++;
+            continue;
+        }
+        else if ((lead & 0xE0) == 0xC0)
+        {
+            sequence_length = 2;
+            codepoint = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            sequence_length = 3;
+            codepoint = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            sequence_length = 4;
+            codepoint = lead & 0x07;
+        }
+        else
+        {
+            return 0;
+        }
+
+        if ((length - position) < sequence_length)
+        {
+            return 0;
+        }
+        for (i = 1; i < sequence_length; i++)
+        {
+            if ((data[position + i] & 0xC0) != 0x80)
+            {
+                return 0;
+            }
+            codepoint = (codepoint << 6) | (data[position + i] & 0x3F);
+        }
+
+        if (((sequence_length == 2) && (codepoint < 0x80))
+            || ((sequence_length == 3) && (codepoint < 0x800))
+            || ((sequence_length == 4) && (codepoint < 0x10000))
+            || ((codepoint >= 0xD800) && (codepoint <= 0xDFFF))
+            || (codepoint > 0x10FFFF))
+        {
+            return 0;
+        }
+        position += sequence_length;
+    }
+
+    return 1;
+}
+
+/* append the UTF-8 encoding of codepoint, surrogates and values above U+10FFFF included */
+static size_t encode(unsigned char *output, const unsigned long codepoint)
+{
+    if (codepoint < 0x80)
+    {
+        output[0] = (unsigned char)codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800)
+    {
+        output[0] = (unsigned char)(0xC0 | (codepoint >> 6));
+        output[1] = (unsigned char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000)
+    {
+        output[0] = (unsigned char)(0xE0 | (codepoint >> 12));
+        output[1] = (unsigned char)(0x80 | ((codepoint >> 6) & 0x3F));
+        output[2] = (unsigned char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    output[0] = (unsigned char)(0xF0 | ((codepoint >> 18) & 0x07));
+    output[1] = (unsigned char)(0x80 | ((codepoint >> 12) & 0x3F));
+    output[2] = (unsigned char)(0x80 | ((codepoint >> 6) & 0x3F));
+    output[3] = (unsigned char)(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+/* mostly valid text with ASCII runs long enough for the vector code, and now and then a broken sequence */
+static size_t generate_utf8(unsigned char *output, const size_t limit)
+{
+    static const unsigned long boundaries[] =
+    {
+        0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xE000,
+        0xFFFD, 0xFFFF, 0x10000, 0x10FFFF, 0x110000, 0x13FFFF, 0x1FFFFF
+    };
+    static const char *broken[] =
+    {
+        "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF",
+        "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80",
+        "\xFE", "\xFF", "\x80", "\xBF", "\xC2", "\xE1\x80", "\xF1\x80\x80", "\xC2\x41", "\xE1\x80\x41"
+    };
+    size_t length = 0;
+
+    while (length + 8 < limit)
+    {
+        const size_t choice = random_below(100);
+
+        if (choice < 40)
+        {
+            size_t run = random_below(48);
+            while ((run-- > 0) && (length + 8 < limit))
+            {
+                output[length++] = (unsigned char)(0x20 + random_below(0x5F));
+            }
+        }
+        else if (choice < 75)
+        {
+            const unsigned long ranges[] = { 0x80, 0x800, 0x10000, 0x110000 };
+            unsigned long codepoint = (unsigned long)random_below(ranges[random_below(4)]);
+            if ((codepoint >= 0xD800) && (codepoint <= 0xDFFF))
+            {
+                codepoint += 0x800;
+            }
+            length += encode(output + length, codepoint);
+        }
+        else if (choice < 90)
+        {
+            length += encode(output + length, boundaries[random_below(sizeof(boundaries) / sizeof(boundaries[0]))]);
+        }
+        else if (choice < 97)
+        {
+            const char *sequence = broken[random_below(sizeof(broken) / sizeof(broken[0]))];
+            memcpy(output + length, sequence, strlen(sequence));
+            length += strlen(sequence);
+        }
+        else
+        {
+            output[length++] = (unsigned char)random_below(256);
+        }
+        if (random_below(8) == 0)
+        {
+            break;
+        }
+    }
+
+    return length;
+}
+
+/* JSON-like text from the characters the minifier treats specially */
+static void generate_json(char *output, const size_t limit)
+{
+    static const char alphabet[] = "    \t\r\n\"\"\"\\\\//**ab1{}[],:";
+    static const char *pieces[] = { "\\\"", "\\\\\"", "//", "/*", "*/", "\"   \"", "\n", "\"\\\\\"  " };
+    size_t length = 0;
+    const size_t target = random_below(limit - 8);
+
+    while (length < target)
+    {
+        if (random_below(6) == 0)
+        {
+            const char *piece = pieces[random_below(sizeof(pieces) / sizeof(pieces[0]))];
+            size_t piece_length = strlen(piece);
+            if (length + piece_length >= limit)
+            {
+                break;
+            }
+            memcpy(output + length, piece, piece_length);
+            length += piece_length;
+        }
+        else
+        {
+            output[length++] = alphabet[random_below(sizeof(alphabet) - 1)];
+        }
+    }
+    output[length] = '\0';
+}
+
+int main(int argc, char **argv)
+{
+    const long iterations = (argc > 1) ? atol(argv[1]) : 200000;
+    static char input[512];
+    static char expected[512];
+    static char actual[512];
+    static unsigned char text[512];
+    long minify_failures = 0;
+    long utf8_failures = 0;
+    long i = 0;
+
+#if defined(__AVX2__) && defined(__GNUC__)
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        printf("no AVX2 on this machine, skipped\n");
+        return 0;
+    }
+#endif
+
+    random_state = (argc > 2) ? strtoull(argv[2], NULL, 0) : 0x9e3779b97f4a7c15ULL;
+    for (i = 0; i < iterations; i++)
+    {
+        size_t length = 0;
+        size_t offset = 0;
+
+        /* start at different alignments, so blocks split the input differently */
+        offset = random_below(32);
+        generate_json(input, sizeof(input) - 32);
+        strcpy(expected, input);
+        reference_minify(expected);
+        strcpy(actual + offset, input);
+        cJSON_Minify(actual + offset);
+        if (strcmp(actual + offset, expected) != 0)
+        {
+            if (minify_failures++ < 5)
+            {
+                printf("minify \"%s\":\n  expected \"%s\"\n  got      \"%s\"\n", input, expected, actual + offset);
+            }
+        }
+
+        length = generate_utf8(text, sizeof(text));
+        offset = random_below(length + 1);
+        if (cJSON_IsValidUTF8((const char*)text + offset, length - offset) != reference_valid_utf8(text + offset, length - offset))
+        {
+            if (utf8_failures++ < 5)
+            {
+                size_t byte = 0;
+                printf("utf8, expected %d for", reference_valid_utf8(text + offset, length - offset));
+                for (byte = offset; byte < length; byte++)
+                {
+                    printf(" %02X", text[byte]);
+                }
+                printf("\n");
+            }
+        }
+    }
+
+    printf("%ld inputs, %ld minify and %ld UTF-8 mismatches\n", iterations, minify_failures, utf8_failures);
+
+    return ((minify_failures == 0) && (utf8_failures == 0)) ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+/* Number conversion check: cJSON_Parse against strtod and print -> parse round trips, bit for bit.
+ * Usage: numbers [count], count random doubles (default 1000000) on top of the fixed boundary cases. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "cJSON.h"
+
+static unsigned long long random_state = 0x9e3779b97f4a7c15ULL;
+static long checked = 0;
+static long failures = 0;
+
+static unsigned long long next_random(void)
+{
+    /* xorshift64*, the same sequence on every run */
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 2685821657736338717ULL;
+}
+
+static unsigned long long double_bits(double d)
+{
+    unsigned long long bits = 0;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+static double bits_double(unsigned long long bits)
+{
+    double d = 0;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static void report(const char *what, const char *text, double expected, double actual)
+{
+    failures++;
+    if (failures <= 20)
+    {
+        printf("  %s \"%s\": expected %.17g (%016llx), got %.17g (%016llx)\n", what, text,
+            expected, double_bits(expected), actual, double_bits(actual));
+    }
+}
+
+/* parse the text as a JSON number and compare with strtod */
+static void check_parse(const char *text)
+{
+    cJSON *number = cJSON_Parse(text);
+    double expected = strtod(text, NULL);
+
+    checked++;
+    if (!cJSON_IsNumber(number))
+    {
+        report("parse failed", text, expected, 0.0);
+    }
+    else if (double_bits(number->valuedouble) != double_bits(expected))
+    {
+        report("parse", text, expected, number->valuedouble);
+    }
+    cJSON_Delete(number);
+}
+
+/* print the value and parse it back, with cJSON and with strtod */
+static void check_round_trip(double d)
+{
+    cJSON *number = cJSON_CreateNumber(d);
+    char *text = cJSON_PrintUnformatted(number);
+    cJSON *parsed = NULL;
+
+    checked++;
+    if (text == NULL)
+    {
+        report("print failed", "", d, 0.0);
+        cJSON_Delete(number);
+        return;
+    }
+    parsed = cJSON_Parse(text);
+    /* the printer writes -0 as 0, so zeros only have to come back as zero */
+    if (!cJSON_IsNumber(parsed) || ((d != 0.0) && (double_bits(parsed->valuedouble) != double_bits(d))) || ((d == 0.0) && (parsed->valuedouble != 0.0)))
+    {
+        report("round trip", text, d, cJSON_IsNumber(parsed) ? parsed->valuedouble : 0.0);
+    }
+    else if ((d != 0.0) && (double_bits(strtod(text, NULL)) != double_bits(d)))
+    {
+        report("round trip through strtod", text, d, strtod(text, NULL));
+    }
+    cJSON_Delete(parsed);
+    cJSON_Delete(number);
+    free(text);
+}
+
+static void check_both(const char *text)
+{
+    double d = strtod(text, NULL);
+
+    check_parse(text);
+    /* infinity prints as null */
+    if (!isinf(d))
+    {
+        check_round_trip(d);
+    }
+}
+
+/* a decimal string close to the midpoint between d and the next double up */
+static void check_halfway(double d)
+{
+    char text[96];
+    double up = nextafter(d, HUGE_VAL);
+    long double middle = (long double)d + ((long double)up - (long double)d) / 2;
+
+    if (isinf(up))
+    {
+        return;
+    }
+    sprintf(text, "%.40Le", middle);
+    check_parse(text);
+    sprintf(text, "%.25Le", middle);
+    check_parse(text);
+    sprintf(text, "%.17Le", middle);
+    check_parse(text);
+}
+
+/* a mantissa of 19 to 40 digits with a random exponent */
+static void check_long_mantissa(void)
+{
+    char text[96];
+    int digits = 19 + (int)(next_random() % 22);
+    int length = 0;
+    int i = 0;
+
+    if (next_random() & 1)
+    {
+        text[length++] = '-';
+    }
+    text[length++] = (char)('1' + next_random() % 9);
+    if (next_random() & 1)
+    {
+        text[length++] = '.';
+    }
+    for (i = 1; i < digits; i++)
+    {
+        text[length++] = (char)('0' + next_random() % 10);
+    }
+    sprintf(text + length, "e%d", (int)(next_random() % 660) - 345);
+    check_both(text);
+}
+
+int main(int argc, char **argv)
+{
+    static const char *boundaries[] =
+    {
+        "0", "-0", "1", "-1", "0.1", "0.2", "0.3", "1e23", "8.98846567431158e307",
+        "4.9406564584124654e-324", "5e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "2.2250738585072009e-308", "2.2250738585072011e-308", "2.2250738585072012e-308",
+        "2.2250738585072014e-308", "2.225073858507201136057409796709131975934819546351645648e-308",
+        "1.7976931348623157e308", "1.7976931348623158e308", "1.797693134862315807e308",
+        "9007199254740991", "9007199254740992", "9007199254740993", "9007199254740994",
+        "9007199254740995", "-9007199254740993", "9007199254740993.0000000001",
+        "18014398509481985", "18014398509481987", "9223372036854775807", "9223372036854775808",
+        "18446744073709551615", "18446744073709551616", "1234567890123456789012345678901234567890",
+        "0.1000000000000000055511151231257827021181583404541015625",
+        "0.1000000000000000055511151231257827021181583404541015624",
+        "0.1000000000000000055511151231257827021181583404541015626",
+        "2.00000000000000011102230246251565404236316680908203125",
+        "2.00000000000000011102230246251565404236316680908203124",
+        "2.00000000000000011102230246251565404236316680908203126",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "7.3177701707893310e15", "123456789012345678e-20", "1e-400", "1e400" /* the last two go to 0 and inf */
+    };
+    long count = (argc > 1) ? atol(argv[1]) : 1000000;
+    clock_t start = clock();
+    size_t i = 0;
+    long n = 0;
+
+    for (i = 0; i < sizeof(boundaries) / sizeof(boundaries[0]); i++)
+    {
+        check_both(boundaries[i]);
+    }
+
+    /* the subnormal range and the step to the normal range */
+    for (n = 1; n < 4096; n++)
+    {
+        check_round_trip(bits_double((unsigned long long)n));
+        check_round_trip(bits_double(0x0010000000000000ULL - (unsigned long long)n));
+        check_round_trip(bits_double(0x0010000000000000ULL + (unsigned long long)n));
+        check_halfway(bits_double((unsigned long long)n));
+    }
+    /* integers around 2^53 and the halfway points above it */
+    for (n = -64; n <= 64; n++)
+    {
+        char text[32];
+        sprintf(text, "%.0f", 9007199254740992.0 + (double)n);
+        check_both(text);
+        sprintf(text, "%lld", 9007199254740992LL + n);
+        check_parse(text);
+        check_halfway(9007199254740992.0 + (double)(2 * n));
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        double d = bits_double(next_random());
+        if (isnan(d) || isinf(d))
+        {
+            continue;
+        }
+        check_round_trip(d);
+        if ((n & 7) == 0)
+        {
+            char text[40];
+            sprintf(text, "%.17g", d);
+            check_parse(text);
+            check_halfway(d);
+            check_long_mantissa();
+        }
+    }
+
+    printf("%ld conversions checked, %ld mismatches (%.2f s)\n", checked, failures, (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+/* Throughput of cJSON_ParseArrayParallel and cJSON_ParseNDJSON by number of threads against cJSON_Parse.
+ * Usage: parallel [records], the input is that many chart responses (default 2000), as an array and as NDJSON. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "cJSON.h"
+
+static char *generate_chart(int closes)
+{
+    size_t size = 256 + (size_t)closes * 48;
+    char *json = (char*)malloc(size);
+    size_t length = 0;
+    int i = 0;
+
+    length += (size_t)sprintf(json + length, "{\"chart\":{\"result\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AAPL\","
+        "\"regularMarketPrice\":189.84,\"previousClose\":187.15},\"timestamp\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%d", (i > 0) ? "," : "", 1700000000 + i * 86400);
+    }
+    length += (size_t)sprintf(json + length, "],\"indicators\":{\"quote\":[{\"close\":[");
+    for (i = 0; i < closes; i++)
+    {
+        length += (size_t)sprintf(json + length, "%s%.2f", (i > 0) ? "," : "", 150.0 + (i % 97) * 0.37);
+    }
+    sprintf(json + length, "]}]}}],\"error\":null}}");
+
+    return json;
+}
+
+static double now(void)
+{
+    struct timeval time;
+    gettimeofday(&time, NULL);
+    return (double)time.tv_sec + (double)time.tv_usec / 1e6;
+}
+
+/* best of three runs, in MB/s */
+static double measure(const char *json, size_t length, int threads, int ndjson)
+{
+    double best = 0;
+    int run = 0;
+
+    for (run = 0; run < 3; run++)
+    {
+        double start = now();
+        double elapsed = 0;
+        cJSON *result = NULL;
+
+        if (threads == 0)
+        {
+            result = cJSON_ParseWithLength(json, length);
+        }
+        else if (ndjson)
+        {
+            result = cJSON_ParseNDJSON(json, length, threads);
+        }
+        else
+        {
+            result = cJSON_ParseArrayParallel(json, length, threads);
+        }
+        elapsed = now() - start;
+        if (result == NULL)
+        {
+            return 0;
+        }
+        cJSON_Delete(result);
+        if ((best == 0) || (((double)length / elapsed / 1e6) > best))
+        {
+            best = (double)length / elapsed / 1e6;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    const int records = (argc > 1) ? atoi(argv[1]) : 2000;
+    char *record = generate_chart(1000);
+    const size_t record_length = strlen(record);
+    char *array = (char*)malloc((size_t)records * (record_length + 1) + 2);
+    char *ndjson = (char*)malloc((size_t)records * (record_length + 1) + 1);
+    size_t array_length = 0;
+    size_t ndjson_length = 0;
+    double serial = 0;
+    int threads = 0;
+    int i = 0;
+
+    array[array_length++] = '[';
+    for (i = 0; i < records; i++)
+    {
+        if (i > 0)
+        {
+            array[array_length++] = ',';
+        }
+        memcpy(array + array_length, record, record_length);
+        array_length += record_length;
+        memcpy(ndjson + ndjson_length, record, record_length);
+        ndjson_length += record_length;
+        ndjson[ndjson_length++] = '\n';
+    }
+    array[array_length++] = ']';
+
+    serial = measure(array, array_length, 0, 0);
+    printf("%lu bytes, cJSON_ParseWithLength %.1f MB/s\n", (unsigned long)array_length, serial);
+    printf("%8s %20s %20s\n", "threads", "array", "ndjson");
+    for (threads = 1; threads <= 16; threads *= 2)
+    {
+        const double parallel_array = measure(array, array_length, threads, 0);
+        const double parallel_ndjson = measure(ndjson, ndjson_length, threads, 1);
+        printf("%8d %11.1f MB/s x%.1f %11.1f MB/s x%.1f\n", threads,
+            parallel_array, parallel_array / serial, parallel_ndjson, parallel_ndjson / serial);
+    }
+
+    free(record);
+    free(array);
+    free(ndjson);
+
+    return 0;
+}
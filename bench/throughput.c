@@ -0,0 +1,607 @@
+/* Throughput, allocations and peak memory of the main cJSON workloads over a corpus of chart responses
+ * and synthetic shapes, with JSON results to compare commits.
+ * Usage: throughput [--time seconds] [--label name] [--json out.json] [--compare old.json] [file.json ...]
+ * Files are added to the corpus, recorded responses from the API are the most representative input. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cJSON.h"
+
+/* allocations through the hooks, with the live and peak bytes */
+static size_t live_bytes = 0;
+static size_t peak_bytes = 0;
+static size_t allocations = 0;
+
+typedef union
+{
+    size_t size;
+    double align;
+} header;
+
+static void *counting_malloc(size_t size)
+{
+    header *block = (header*)malloc(sizeof(header) + size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->size = size;
+    live_bytes += size;
+    if (live_bytes > peak_bytes)
+    {
+        peak_bytes = live_bytes;
+    }
+    allocations++;
+    return block + 1;
+}
+
+static void counting_free(void *pointer)
+{
+    header *block = NULL;
+    if (pointer == NULL)
+    {
+        return;
+    }
+    block = (header*)pointer - 1;
+    live_bytes -= block->size;
+    free(block);
+}
+
+/* growable text for the generators */
+typedef struct
+{
+    char *text;
+    size_t length;
+    size_t size;
+} text;
+
+static void append(text *out, const char *string)
+{
+    const size_t length = strlen(string);
+    if ((out->length + length + 1) > out->size)
+    {
+        out->size = (out->size + length + 1) * 2;
+        out->text = (char*)realloc(out->text, out->size);
+    }
+    memcpy(out->text + out->length, string, length + 1);
+    out->length += length;
+}
+
+/* a chart response like the API returns them: every quote series, a few missing points and the adjusted closes */
+static char *generate_chart(int points, int interval)
+{
+    text out = { NULL, 0, 0 };
+    char number[64];
+    const char *series[] = { "open", "high", "low", "close" };
+    size_t i = 0;
+    int point = 0;
+
+    append(&out, "{\"chart\":{\"result\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AAPL\",\"exchangeName\":\"NMS\","
+        "\"fullExchangeName\":\"NasdaqGS\",\"instrumentType\":\"EQUITY\",\"firstTradeDate\":345479400,"
+        "\"regularMarketTime\":1700078400,\"hasPrePostMarketData\":true,\"gmtoffset\":-18000,\"timezone\":\"EST\",");
+    append(&out, "\"exchangeTimezoneName\":\"America/New_York\",\"regularMarketPrice\":189.84,\"fiftyTwoWeekHigh\":199.62,"
+        "\"fiftyTwoWeekLow\":124.17,\"regularMarketDayHigh\":190.96,\"regularMarketDayLow\":188.65,"
+        "\"regularMarketVolume\":53790500,\"longName\":\"Apple Inc.\",\"shortName\":\"Apple Inc.\",");
+    append(&out, "\"chartPreviousClose\":187.15,\"previousClose\":187.15,\"scale\":3,\"priceHint\":2,"
+        "\"currentTradingPeriod\":{\"pre\":{\"timezone\":\"EST\",\"start\":1700038800,\"end\":1700058600,\"gmtoffset\":-18000},"
+        "\"regular\":{\"timezone\":\"EST\",\"start\":1700058600,\"end\":1700082000,\"gmtoffset\":-18000},"
+        "\"post\":{\"timezone\":\"EST\",\"start\":1700082000,\"end\":1700096400,\"gmtoffset\":-18000}},");
+    append(&out, "\"dataGranularity\":\"1d\",\"range\":\"1y\",\"validRanges\":[\"1d\",\"5d\",\"1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},"
+        "\"timestamp\":[");
+    for (point = 0; point < points; point++)
+    {
+        sprintf(number, "%s%d", (point > 0) ? "," : "", 1670000000 + point * interval);
+        append(&out, number);
+    }
+    append(&out, "],\"indicators\":{\"quote\":[{");
+    for (i = 0; i < sizeof(series) / sizeof(series[0]); i++)
+    {
+        sprintf(number, "%s\"%s\":[", (i > 0) ? "," : "", series[i]);
+        append(&out, number);
+        for (point = 0; point < points; point++)
+        {
+            if ((point % 61) == 60)
+            {
+                sprintf(number, "%snull", (point > 0) ? "," : "");
+            }
+            else
+            {
+                sprintf(number, "%s%.15g", (point > 0) ? "," : "", 150.0 + (double)(point % 97) * 0.37 + (double)i * 0.011 + 1e-9 * (double)point);
+            }
+            append(&out, number);
+        }
+        append(&out, "]");
+    }
+    append(&out, ",\"volume\":[");
+    for (point = 0; point < points; point++)
+    {
+        sprintf(number, "%s%d", (point > 0) ? "," : "", 40000000 + (point * 7919) % 30000000);
+        append(&out, number);
+    }
+    append(&out, "]}],\"adjclose\":[{\"adjclose\":[");
+    for (point = 0; point < points; point++)
+    {
+        sprintf(number, "%s%.15g", (point > 0) ? "," : "", 149.5 + (double)(point % 89) * 0.41);
+        append(&out, number);
+    }
+    append(&out, "]}]}}],\"error\":null}}");
+
+    return out.text;
+}
+
+static char *generate_numbers(int count)
+{
+    text out = { NULL, 0, 0 };
+    char number[64];
+    int i = 0;
+
+    append(&out, "[");
+    for (i = 0; i < count; i++)
+    {
+        if ((i % 2) == 0)
+        {
+            sprintf(number, "%s%d", (i > 0) ? "," : "", (i * 7919) % 1000003 - 500000);
+        }
+        else
+        {
+            sprintf(number, "%s%.17g", (i > 0) ? "," : "", (double)i / 7.0 * ((i % 3) ? 1e-3 : 1e12));
+        }
+        append(&out, number);
+    }
+    append(&out, "]");
+
+    return out.text;
+}
+
+/* arrays and objects nested depth levels deep, a little below the nesting limit */
+static char *generate_deep(int depth)
+{
+    text out = { NULL, 0, 0 };
+    int level = 0;
+
+    for (level = 0; level < depth; level++)
+    {
+        append(&out, (level % 2) ? "{\"level\":" : "[1,");
+    }
+    append(&out, "\"bottom\"");
+    for (level = depth - 1; level >= 0; level--)
+    {
+        append(&out, (level % 2) ? "}" : "]");
+    }
+
+    return out.text;
+}
+
+static char *generate_strings(int count)
+{
+    text out = { NULL, 0, 0 };
+    char string[160];
+    int i = 0;
+
+    append(&out, "[");
+    for (i = 0; i < count; i++)
+    {
+        switch (i % 4)
+        {
+            case 0:
+                sprintf(string, "%s\"Apple Inc. closed at 189.84 USD on the Nasdaq, volume %d shares\"", (i > 0) ? "," : "", i);
+                break;
+            case 1:
+                sprintf(string, ",\"line one\\nline two\\t\\\"quoted\\\" \\\\ path\\/to\\/file %d\"", i);
+                break;
+            case 2:
+                sprintf(string, ",\"caf\\u00e9 \\u65e5\\u672c \\ud83d\\ude00 %d\"", i);
+                break;
+            default:
+                sprintf(string, ",\"\xc3\xa9t\xc3\xa9 \xe2\x82\xac \xf0\x9f\x93\x88 short %d\"", i);
+                break;
+        }
+        append(&out, string);
+    }
+    append(&out, "]");
+
+    return out.text;
+}
+
+static char *generate_wide(int count)
+{
+    text out = { NULL, 0, 0 };
+    char member[96];
+    int i = 0;
+
+    append(&out, "{");
+    for (i = 0; i < count; i++)
+    {
+        sprintf(member, "%s\"field_%d_%x\":%s", (i > 0) ? "," : "", i, (unsigned int)(i * 2654435761u),
+            (i % 3 == 0) ? "true" : ((i % 3 == 1) ? "\"value\"" : "12.5"));
+        append(&out, member);
+    }
+    append(&out, "}");
+
+    return out.text;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *json = NULL;
+    long size = 0;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    json = (char*)malloc((size_t)size + 1);
+    if ((json != NULL) && (fread(json, 1, (size_t)size, file) != (size_t)size))
+    {
+        free(json);
+        json = NULL;
+    }
+    if (json != NULL)
+    {
+        json[size] = '\0';
+    }
+    fclose(file);
+
+    return json;
+}
+
+/* the workloads, each run once per call on an input that is prepared outside of the measurement */
+typedef struct
+{
+    const char *json;
+    size_t length;
+    char *formatted; /* the input printed with formatting, for minify */
+    char *scratch; /* minify works in place */
+    cJSON *tree;
+    size_t bytes; /* processed by one run */
+} input;
+
+/* every object member by name and every array element by index */
+static size_t look_up(const cJSON *item)
+{
+    size_t found = 0;
+    const cJSON *child = NULL;
+    int index = 0;
+
+    cJSON_ArrayForEach(child, item)
+    {
+        if (cJSON_IsObject(item))
+        {
+            found += (cJSON_GetObjectItemCaseSensitive(item, child->string) == child);
+        }
+        else
+        {
+            found += (cJSON_GetArrayItem(item, index++) == child);
+        }
+        if (cJSON_IsArray(child) || cJSON_IsObject(child))
+        {
+            found += look_up(child);
+        }
+    }
+
+    return found;
+}
+
+/* replace every member, add and remove one per object, insert and remove elements of every array */
+static void mutate(cJSON *item)
+{
+    cJSON *child = NULL;
+    int size = 0;
+
+    cJSON_ArrayForEach(child, item)
+    {
+        if (cJSON_IsArray(child) || cJSON_IsObject(child))
+        {
+            mutate(child);
+        }
+    }
+
+    if (cJSON_IsObject(item))
+    {
+        child = item->child;
+        while (child != NULL)
+        {
+            cJSON *next = child->next;
+            if (!cJSON_IsArray(child) && !cJSON_IsObject(child))
+            {
+                cJSON_ReplaceItemInObjectCaseSensitive(item, child->string, cJSON_CreateNumber(42));
+            }
+            child = next;
+        }
+        cJSON_AddStringToObject(item, "added", "value");
+        cJSON_DeleteItemFromObjectCaseSensitive(item, "added");
+    }
+    else if (cJSON_IsArray(item))
+    {
+        size = cJSON_GetArraySize(item);
+        cJSON_InsertItemInArray(item, 0, cJSON_CreateNumber(-1));
+        cJSON_InsertItemInArray(item, size / 2, cJSON_CreateString("middle"));
+        cJSON_DeleteItemFromArray(item, size / 2);
+        cJSON_DeleteItemFromArray(item, 0);
+    }
+}
+
+static void run_parse(input *in)
+{
+    cJSON_Delete(cJSON_ParseWithLength(in->json, in->length));
+}
+
+static void run_print(input *in)
+{
+    cJSON_free(cJSON_PrintUnformatted(in->tree));
+}
+
+static void run_print_formatted(input *in)
+{
+    cJSON_free(cJSON_Print(in->tree));
+}
+
+static void run_minify(input *in)
+{
+    memcpy(in->scratch, in->formatted, in->bytes + 1);
+    cJSON_Minify(in->scratch);
+}
+
+static void run_lookup(input *in)
+{
+    look_up(in->tree);
+}
+
+static void run_mutate(input *in)
+{
+    cJSON *copy = cJSON_Duplicate(in->tree, 1);
+    mutate(copy);
+    cJSON_Delete(copy);
+}
+
+typedef struct
+{
+    const char *name;
+    void (*run)(input *in);
+} workload;
+
+static const workload workloads[] =
+{
+    { "parse", run_parse },
+    { "print", run_print },
+    { "print_formatted", run_print_formatted },
+    { "minify", run_minify },
+    { "lookup", run_lookup },
+    { "mutate", run_mutate }
+};
+
+typedef struct
+{
+    double megabytes_per_second;
+    double allocations; /* per run */
+    size_t peak_bytes; /* above what was live before the run */
+} measurement;
+
+static measurement measure(const workload *work, input *in, double seconds)
+{
+    measurement result;
+    size_t runs = 0;
+    size_t counted = 0;
+    size_t base = 0;
+    clock_t start = 0;
+    clock_t elapsed = 0;
+
+    /* one counted run, starting from an empty node pool so the numbers don't depend on what ran before */
+    cJSON_TrimPool(0);
+    base = live_bytes;
+    peak_bytes = live_bytes;
+    counted = allocations;
+    work->run(in);
+    result.allocations = (double)(allocations - counted);
+    result.peak_bytes = peak_bytes - base;
+
+    start = clock();
+    do
+    {
+        work->run(in);
+        runs++;
+        elapsed = clock() - start;
+    } while ((double)elapsed < (seconds * CLOCKS_PER_SEC));
+
+    result.megabytes_per_second = (double)in->bytes * (double)runs / ((double)elapsed / CLOCKS_PER_SEC) / 1e6;
+
+    return result;
+}
+
+/* the result for input and workload in earlier results, NULL if there is none */
+static const cJSON *find_result(const cJSON *results, const char *input_name, const char *workload_name)
+{
+    const cJSON *result = NULL;
+
+    cJSON_ArrayForEach(result, cJSON_GetObjectItemCaseSensitive(results, "results"))
+    {
+        const char *name = cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(result, "input"));
+        const char *work = cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(result, "workload"));
+        if ((name != NULL) && (work != NULL) && (strcmp(name, input_name) == 0) && (strcmp(work, workload_name) == 0))
+        {
+            return result;
+        }
+    }
+
+    return NULL;
+}
+
+typedef struct
+{
+    char *name;
+    char *json;
+} corpus_entry;
+
+int main(int argc, char **argv)
+{
+    cJSON_Hooks hooks;
+    corpus_entry corpus[32];
+    size_t corpus_size = 0;
+    double seconds = 0.3;
+    const char *label = "";
+    const char *json_path = NULL;
+    const char *compare_path = NULL;
+    cJSON *previous = NULL;
+    cJSON *report = NULL;
+    cJSON *results = NULL;
+    size_t entry = 0;
+    size_t work = 0;
+    int regressions = 0;
+    int i = 0;
+
+    hooks.malloc_fn = counting_malloc;
+    hooks.free_fn = counting_free;
+    cJSON_InitHooks(&hooks);
+
+    corpus[corpus_size].name = "chart_1d_1m";
+    corpus[corpus_size++].json = generate_chart(390, 60);
+    corpus[corpus_size].name = "chart_1y_1d";
+    corpus[corpus_size++].json = generate_chart(252, 86400);
+    corpus[corpus_size].name = "chart_10y_1d";
+    corpus[corpus_size++].json = generate_chart(2520, 86400);
+    corpus[corpus_size].name = "numbers";
+    corpus[corpus_size++].json = generate_numbers(100000);
+    corpus[corpus_size].name = "deep";
+    corpus[corpus_size++].json = generate_deep(CJSON_NESTING_LIMIT - 10);
+    corpus[corpus_size].name = "strings";
+    corpus[corpus_size++].json = generate_strings(20000);
+    corpus[corpus_size].name = "wide_object";
+    corpus[corpus_size++].json = generate_wide(2000);
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--time") == 0) && ((i + 1) < argc))
+        {
+            seconds = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--label") == 0) && ((i + 1) < argc))
+        {
+            label = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--json") == 0) && ((i + 1) < argc))
+        {
+            json_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--compare") == 0) && ((i + 1) < argc))
+        {
+            compare_path = argv[++i];
+        }
+        else if (corpus_size < (sizeof(corpus) / sizeof(corpus[0])))
+        {
+            corpus[corpus_size].name = argv[i];
+            corpus[corpus_size].json = read_file(argv[i]);
+            if (corpus[corpus_size].json == NULL)
+            {
+                fprintf(stderr, "%s cannot be read\n", argv[i]);
+                return 1;
+            }
+            corpus_size++;
+        }
+    }
+
+    if (compare_path != NULL)
+    {
+        char *text = read_file(compare_path);
+        previous = (text != NULL) ? cJSON_Parse(text) : NULL;
+        free(text);
+        if (previous == NULL)
+        {
+            fprintf(stderr, "%s cannot be read\n", compare_path);
+            return 1;
+        }
+    }
+
+    report = cJSON_CreateObject();
+    cJSON_AddStringToObject(report, "label", label);
+    cJSON_AddStringToObject(report, "version", cJSON_Version());
+    cJSON_AddNumberToObject(report, "seconds_per_workload", seconds);
+    results = cJSON_AddArrayToObject(report, "results");
+
+    printf("%-16s %-16s %10s %12s %12s %12s", "input", "workload", "bytes", "MB/s", "allocations", "peak bytes");
+    printf((previous != NULL) ? " %9s\n" : "\n", "change");
+    for (entry = 0; entry < corpus_size; entry++)
+    {
+        input in;
+
+        in.json = corpus[entry].json;
+        in.length = strlen(in.json);
+        in.tree = cJSON_ParseWithLength(in.json, in.length);
+        if (in.tree == NULL)
+        {
+            printf("%-16s does not parse\n", corpus[entry].name);
+            continue;
+        }
+        in.formatted = cJSON_Print(in.tree);
+        in.scratch = (char*)malloc(strlen(in.formatted) + 1);
+
+        for (work = 0; work < sizeof(workloads) / sizeof(workloads[0]); work++)
+        {
+            measurement result;
+            cJSON *record = NULL;
+
+            /* the formatted printer and minify are measured on the formatted text */
+            in.bytes = in.length;
+            if ((strcmp(workloads[work].name, "print_formatted") == 0) || (strcmp(workloads[work].name, "minify") == 0))
+            {
+                in.bytes = strlen(in.formatted);
+            }
+
+            result = measure(&workloads[work], &in, seconds);
+            printf("%-16s %-16s %10lu %12.1f %12.0f %12lu", corpus[entry].name, workloads[work].name,
+                (unsigned long)in.bytes, result.megabytes_per_second, result.allocations, (unsigned long)result.peak_bytes);
+            if (previous != NULL)
+            {
+                const double before = cJSON_GetNumberValue(cJSON_GetObjectItemCaseSensitive(find_result(previous, corpus[entry].name, workloads[work].name), "mb_per_s"));
+                if (before > 0)
+                {
+                    const double change = (result.megabytes_per_second / before - 1.0) * 100.0;
+                    /* differences below 5% are within the noise of most machines */
+                    printf(" %+8.1f%%%s", change, (change < -5.0) ? "  slower" : "");
+                    regressions += (change < -5.0);
+                }
+            }
+            printf("\n");
+
+            record = cJSON_CreateObject();
+            cJSON_AddStringToObject(record, "input", corpus[entry].name);
+            cJSON_AddStringToObject(record, "workload", workloads[work].name);
+            cJSON_AddNumberToObject(record, "bytes", (double)in.bytes);
+            cJSON_AddNumberToObject(record, "mb_per_s", result.megabytes_per_second);
+            cJSON_AddNumberToObject(record, "allocations", result.allocations);
+            cJSON_AddNumberToObject(record, "peak_bytes", (double)result.peak_bytes);
+            cJSON_AddItemToArray(results, record);
+        }
+
+        cJSON_Delete(in.tree);
+        cJSON_free(in.formatted);
+        free(in.scratch);
+    }
+
+    if (json_path != NULL)
+    {
+        FILE *file = fopen(json_path, "wb");
+        if ((file == NULL) || !cJSON_PrintToFile(report, file, 1))
+        {
+            fprintf(stderr, "%s cannot be written\n", json_path);
+        }
+        if (file != NULL)
+        {
+            fclose(file);
+        }
+    }
+
+    cJSON_Delete(report);
+    cJSON_Delete(previous);
+    for (entry = 0; entry < corpus_size; entry++)
+    {
+        free(corpus[entry].json);
+    }
+
+    /* a failing exit status lets scripts stop on regressions */
+    return (regressions > 0) ? 2 : 0;
+}
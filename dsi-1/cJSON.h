@@ -84,6 +84,7 @@ then using the CJSON_API_VISIBILITY flag to "export" the same symbols the way CJ
 #define CJSON_VERSION_PATCH 19
 
 #include <stddef.h>
+#include <stdio.h>
 
 /* cJSON Types: */
 #define cJSON_Invalid (0)
@@ -98,6 +99,21 @@ then using the CJSON_API_VISIBILITY flag to "export" the same symbols the way CJ
 
 #define cJSON_IsReference 256
 #define cJSON_StringIsConst 512
+/* Set with cJSON_StringIsConst when the name points into a context's interned keys or into the input of an
+ * in-place parse, so it is only valid as long as those are. cJSON_Duplicate copies such names. */
+#define cJSON_StringIsBorrowed 1024
+
+/* Compact read-only trees (cJSON_ParseCompact) for memory-constrained builds, off by default. */
+#ifndef CJSON_COMPACT
+#define CJSON_COMPACT 0
+#endif
+
+/* Arrays and objects can carry a contiguous vector of child pointers, built by cJSON_BuildArrayIndex,
+ * which makes cJSON_GetArrayItem and cJSON_GetArraySize O(1). Off by default: define CJSON_ARRAY_INDEX
+ * to 1 to compile it in, at the cost of one pointer per node and a different cJSON struct layout. */
+#ifndef CJSON_ARRAY_INDEX
+#define CJSON_ARRAY_INDEX 0
+#endif
 
 /* The cJSON structure: */
 typedef struct cJSON
@@ -120,6 +136,11 @@ typedef struct cJSON
 
     /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
     char *string;
+
+#if CJSON_ARRAY_INDEX
+    /* Child pointer vector for indexed access. Managed by cJSON, don't touch. */
+    struct cJSON_ArrayIndex *array_index;
+#endif
 } cJSON;
 
 typedef struct cJSON_Hooks
@@ -137,6 +158,45 @@ typedef int cJSON_bool;
 #define CJSON_NESTING_LIMIT 1000
 #endif
 
+/* The parser and printer keep the arrays and objects they are inside of on an explicit stack instead of
+ * recursing. This many levels fit on the C stack, deeper documents move the stack to the heap. */
+#ifndef CJSON_STACK_FRAMES
+#define CJSON_STACK_FRAMES 32
+#endif
+
+/* Arrays shorter than this are never indexed, walking them is cheaper than the index. */
+#ifndef CJSON_ARRAY_INDEX_MIN_SIZE
+#define CJSON_ARRAY_INDEX_MIN_SIZE 16
+#endif
+
+/* Deleted nodes, and the short strings cJSON frees while parsing, are kept on a per-thread free list and
+ * reused by the next parse, up to CJSON_POOL_LIMIT bytes, with separate lists for up to four sets of hooks.
+ * The strings of items are allocated with their exact size and always go back to the allocator, they may have
+ * been replaced by the user. With CJSON_THREADS the cache of a thread is released when the thread exits,
+ * without it call cJSON_TrimPool(0) before a thread exits. Define CJSON_POOL to 0 to always go to the allocator. */
+#ifndef CJSON_POOL
+#define CJSON_POOL 1
+#endif
+
+#ifndef CJSON_POOL_LIMIT
+#define CJSON_POOL_LIMIT (1024 * 1024)
+#endif
+
+/* Size of the buffer the streaming printers fill before handing it to the writer. */
+#ifndef CJSON_PRINT_CHUNK_SIZE
+#define CJSON_PRINT_CHUNK_SIZE 4096
+#endif
+
+/* Most threads cJSON_ParseNDJSON and cJSON_ParseArrayParallel use. Targets without POSIX threads,
+ * like the consoles, parse on the calling thread. */
+#ifndef CJSON_THREADS
+#if defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+#define CJSON_THREADS 64
+#else
+#define CJSON_THREADS 0
+#endif
+#endif
+
 /* Limits the length of circular references can be before cJSON rejects to parse them.
  * This is to prevent stack overflows. */
 #ifndef CJSON_CIRCULAR_LIMIT
@@ -157,6 +217,18 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithLength(const char *value, size_t buffer_len
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error so will match cJSON_GetErrorPtr(). */
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated);
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated);
+/* Parse without copying strings: names and string values point into value, which is modified (escape
+ * sequences are decoded in place and the closing quotes become '\0') and has to outlive the result.
+ * The nodes are flagged cJSON_StringIsConst and cJSON_IsReference, so cJSON_Delete leaves the strings alone. */
+CJSON_PUBLIC(cJSON *) cJSON_ParseInPlace(char *value);
+CJSON_PUBLIC(cJSON *) cJSON_ParseInPlaceWithLength(char *value, size_t buffer_length);
+/* Parse newline delimited JSON (one value per line, blank lines are skipped) or the elements of a top level
+ * array into an array. Large inputs are cut into chunks of whole records that are parsed on up to threads
+ * threads, 0 uses one per processor. On failure cJSON_GetErrorPtr points at the first error in the input.
+ * NDJSON without records, an empty buffer as well as one of blank lines, gives an empty array. Only a NULL
+ * value returns NULL. cJSON_ParseArrayParallel fails on an empty buffer, it has no array. */
+CJSON_PUBLIC(cJSON *) cJSON_ParseNDJSON(const char *value, size_t buffer_length, int threads);
+CJSON_PUBLIC(cJSON *) cJSON_ParseArrayParallel(const char *value, size_t buffer_length, int threads);
 
 /* Render a cJSON entity to text for transfer/storage. */
 CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item);
@@ -167,6 +239,14 @@ CJSON_PUBLIC(char *) cJSON_PrintBuffered(const cJSON *item, int prebuffer, cJSON
 /* Render a cJSON entity to text using a buffer already allocated in memory with given length. Returns 1 on success and 0 on failure. */
 /* NOTE: cJSON is not always 100% accurate in estimating how much memory it will use, so to be safe allocate 5 bytes more than you actually need */
 CJSON_PUBLIC(cJSON_bool) cJSON_PrintPreallocated(cJSON *item, char *buffer, const int length, const cJSON_bool format);
+/* Render a cJSON entity straight to a writer, chunk_size bytes at a time (0 uses CJSON_PRINT_CHUNK_SIZE), so memory
+ * stays bounded by the chunk size however large the document is. A single string longer than a chunk still has to
+ * fit in memory. The writer returns 0 to abort. Returns 1 on success and 0 on failure, in which case part of the
+ * output may already have been written. */
+typedef cJSON_bool (*cJSON_WriteCallback)(void *user_data, const char *data, size_t length);
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToCallback(const cJSON *item, cJSON_bool format, size_t chunk_size, cJSON_WriteCallback writer, void *user_data);
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToFile(const cJSON *item, FILE *file, cJSON_bool format);
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToFileDescriptor(const cJSON *item, int fd, cJSON_bool format);
 /* Delete a cJSON entity and all subentities. */
 CJSON_PUBLIC(void) cJSON_Delete(cJSON *item);
 
@@ -178,9 +258,54 @@ CJSON_PUBLIC(cJSON *) cJSON_GetArrayItem(const cJSON *array, int index);
 CJSON_PUBLIC(cJSON *) cJSON_GetObjectItem(const cJSON * const object, const char * const string);
 CJSON_PUBLIC(cJSON *) cJSON_GetObjectItemCaseSensitive(const cJSON * const object, const char * const string);
 CJSON_PUBLIC(cJSON_bool) cJSON_HasObjectItem(const cJSON *object, const char *string);
+/* Build the child index of an array or object, so the two getters above are O(1) on it. Adding, inserting,
+ * detaching and replacing items keep it up to date. The getters only read it, so they stay safe for concurrent
+ * readers; build it before sharing the tree. Returns false if the index is compiled out, the array is shorter
+ * than CJSON_ARRAY_INDEX_MIN_SIZE or allocation failed. */
+CJSON_PUBLIC(cJSON_bool) cJSON_BuildArrayIndex(cJSON *array);
+/* Returns the number of bytes used by array indexes in item and all of its children. */
+CJSON_PUBLIC(size_t) cJSON_GetArrayIndexMemory(const cJSON *item);
 /* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when cJSON_Parse() returns 0. 0 when cJSON_Parse() succeeds. */
 CJSON_PUBLIC(const char *) cJSON_GetErrorPtr(void);
 
+/* Contexts make parsing and printing reentrant: each one carries its own allocator, error position,
+ * nesting limit and options, so threads with a context each don't share any state. The functions
+ * without a context parameter use a global default context, which cJSON_InitHooks configures.
+ * Items from cJSON_ParseCtx must be released with cJSON_DeleteCtx and printed text with cJSON_FreeCtx. */
+typedef struct cJSON_Context cJSON_Context;
+
+/* Context options */
+#define cJSON_RequireNullTerminated 1 /* cJSON_ParseCtx and cJSON_ParseWithLengthCtx reject anything after the value */
+#define cJSON_ValidateUTF8 2 /* reject parsed text that isn't valid UTF-8, the error points at the first invalid byte */
+#define cJSON_InternKeys 4 /* object keys are stored once per context and shared by every item with that name, see cJSON_InternKeyCtx */
+
+/* hooks may be NULL for malloc and free */
+CJSON_PUBLIC(cJSON_Context *) cJSON_CreateContext(const cJSON_Hooks *hooks);
+CJSON_PUBLIC(void) cJSON_DeleteContext(cJSON_Context *context);
+CJSON_PUBLIC(void) cJSON_SetContextNestingLimit(cJSON_Context *context, size_t limit);
+CJSON_PUBLIC(void) cJSON_SetContextOptions(cJSON_Context *context, int options);
+/* Like cJSON_GetErrorPtr for the last parse with this context. */
+CJSON_PUBLIC(const char *) cJSON_GetContextErrorPtr(const cJSON_Context *context);
+CJSON_PUBLIC(cJSON *) cJSON_ParseCtx(cJSON_Context *context, const char *value);
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthCtx(cJSON_Context *context, const char *value, size_t buffer_length);
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOptsCtx(cJSON_Context *context, const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated);
+CJSON_PUBLIC(char *) cJSON_PrintCtx(cJSON_Context *context, const cJSON *item);
+CJSON_PUBLIC(char *) cJSON_PrintUnformattedCtx(cJSON_Context *context, const cJSON *item);
+CJSON_PUBLIC(char *) cJSON_PrintBufferedCtx(cJSON_Context *context, const cJSON *item, int prebuffer, cJSON_bool fmt);
+CJSON_PUBLIC(cJSON_bool) cJSON_PrintToCallbackCtx(cJSON_Context *context, const cJSON *item, cJSON_bool format, size_t chunk_size, cJSON_WriteCallback writer, void *user_data);
+CJSON_PUBLIC(void) cJSON_DeleteCtx(cJSON_Context *context, cJSON *item);
+/* Interned keys are flagged cJSON_StringIsConst | cJSON_StringIsBorrowed and stay valid until the context is deleted,
+ * so items parsed with cJSON_InternKeys, detached ones included, must not outlive their context; cJSON_Duplicate
+ * them to keep them longer. This returns the context's copy of key (adding it if needed), looking an item up by
+ * that pointer compares addresses instead of strings. */
+CJSON_PUBLIC(const char *) cJSON_InternKeyCtx(cJSON_Context *context, const char *key);
+/* Returns the number of bytes used by the context's interned keys. */
+CJSON_PUBLIC(size_t) cJSON_GetContextKeyMemory(const cJSON_Context *context);
+CJSON_PUBLIC(void) cJSON_FreeCtx(cJSON_Context *context, void *object);
+
+/* Returns 1 if length bytes of data are valid UTF-8 (no overlong forms, surrogates or code points above U+10FFFF). */
+CJSON_PUBLIC(cJSON_bool) cJSON_IsValidUTF8(const char *data, size_t length);
+
 /* Check item type and return its value */
 CJSON_PUBLIC(char *) cJSON_GetStringValue(const cJSON * const item);
 CJSON_PUBLIC(double) cJSON_GetNumberValue(const cJSON * const item);
@@ -265,6 +390,138 @@ CJSON_PUBLIC(cJSON_bool) cJSON_Compare(const cJSON * const a, const cJSON * cons
  * but should point to a readable and writable address area. */
 CJSON_PUBLIC(void) cJSON_Minify(char *json);
 
+/* Incremental (push) parsing: feed the input in chunks of any size as they arrive and get the
+ * values reported through callbacks, without holding the whole document in memory.
+ * Strings and keys are passed decoded and '\0' terminated; they are only valid during the call.
+ * Callbacks may be NULL, returning false from one aborts parsing. */
+typedef struct cJSON_StreamCallbacks
+{
+    cJSON_bool (*start_object)(void *user_data);
+    cJSON_bool (*end_object)(void *user_data);
+    cJSON_bool (*start_array)(void *user_data);
+    cJSON_bool (*end_array)(void *user_data);
+    cJSON_bool (*key)(void *user_data, const char *key, size_t length);
+    cJSON_bool (*string)(void *user_data, const char *string, size_t length);
+    cJSON_bool (*number)(void *user_data, double number);
+    cJSON_bool (*boolean)(void *user_data, cJSON_bool boolean);
+    cJSON_bool (*null)(void *user_data);
+} cJSON_StreamCallbacks;
+
+typedef struct cJSON_StreamParser cJSON_StreamParser;
+
+CJSON_PUBLIC(cJSON_StreamParser *) cJSON_CreateStreamParser(const cJSON_StreamCallbacks *callbacks, void *user_data);
+/* Returns false on a syntax error or when a callback aborted, all further input is then rejected. */
+CJSON_PUBLIC(cJSON_bool) cJSON_FeedStreamParser(cJSON_StreamParser *parser, const char *chunk, size_t length);
+/* Signal the end of the input. Returns true if exactly one complete value has been parsed. */
+CJSON_PUBLIC(cJSON_bool) cJSON_FinishStreamParser(cJSON_StreamParser *parser);
+/* Offset of the offending byte within the whole stream after a failure. */
+CJSON_PUBLIC(size_t) cJSON_GetStreamParserErrorOffset(const cJSON_StreamParser *parser);
+/* Start over with a new document, keeping the callbacks and buffers. */
+CJSON_PUBLIC(void) cJSON_ResetStreamParser(cJSON_StreamParser *parser);
+CJSON_PUBLIC(void) cJSON_DeleteStreamParser(cJSON_StreamParser *parser);
+
+/* On-demand parsing: cJSON_ParseDocument only records where each value starts, values are parsed
+ * when they are navigated to. The input has to stay alive and unchanged while the document is used.
+ * Scalars are only checked when they are read, so errors in parts that are never read go unnoticed. */
+typedef struct cJSON_Document cJSON_Document;
+/* Position of a value within a document, the document is NULL if the value doesn't exist. */
+typedef struct cJSON_Cursor
+{
+    const cJSON_Document *document;
+    size_t entry;
+} cJSON_Cursor;
+
+CJSON_PUBLIC(cJSON_Document *) cJSON_ParseDocument(const char *value);
+CJSON_PUBLIC(cJSON_Document *) cJSON_ParseDocumentWithLength(const char *value, size_t buffer_length);
+CJSON_PUBLIC(void) cJSON_DeleteDocument(cJSON_Document *document);
+/* Bytes used by the document, not counting the input. */
+CJSON_PUBLIC(size_t) cJSON_GetDocumentMemory(const cJSON_Document *document);
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetDocumentRoot(const cJSON_Document *document);
+/* Returns one of the cJSON type values, cJSON_Invalid for a cursor to nothing. */
+CJSON_PUBLIC(int) cJSON_GetCursorType(const cJSON_Cursor cursor);
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorObjectItem(const cJSON_Cursor object, const char *string);
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorObjectItemCaseSensitive(const cJSON_Cursor object, const char *string);
+CJSON_PUBLIC(cJSON_Cursor) cJSON_GetCursorArrayItem(const cJSON_Cursor array, int index);
+CJSON_PUBLIC(int) cJSON_GetCursorArraySize(const cJSON_Cursor array);
+/* NAN if the value is not a valid number. */
+CJSON_PUBLIC(double) cJSON_GetCursorNumberValue(const cJSON_Cursor cursor);
+/* Parse the value into a new cJSON tree that has to be released with cJSON_Delete. */
+CJSON_PUBLIC(cJSON *) cJSON_MaterializeCursor(const cJSON_Cursor cursor);
+
+/* Schema-directed decoding: cJSON_Decode fills a C struct straight from the text in one pass, without
+ * building a tree. Each binding names a value by a JSON pointer ("/chart/result/0/meta/symbol", "" for
+ * the whole document) and says where it goes in the struct. Values no binding asks for are skipped;
+ * like with cJSON_ParseDocument their scalars are only checked lexically. Fields of missing optional
+ * values are left alone, except that array counts start at 0 and list pointers at NULL. */
+#define cJSON_BindNumber 0 /* double */
+#define cJSON_BindInt 1 /* int, saturated like valueint */
+#define cJSON_BindBool 2 /* cJSON_bool, from true or false */
+#define cJSON_BindString 3 /* char[size], the string has to fit including the '\0' */
+#define cJSON_BindNumberArray 4 /* double[size] from an array, null elements are skipped */
+#define cJSON_BindNumberList 5 /* double * from an array, allocated with the global hooks (release it with cJSON_free), null elements are skipped */
+
+typedef struct cJSON_Binding
+{
+    const char *path;
+    int type; /* one of the cJSON_Bind types */
+    size_t offset; /* offsetof the field in the struct */
+    size_t size; /* cJSON_BindString: size of the char array, cJSON_BindNumberArray: number of elements */
+    size_t count_offset; /* number arrays and lists: offsetof a size_t that receives the number of elements */
+    cJSON_bool optional; /* a missing value is not an error */
+} cJSON_Binding;
+
+/* Decode status */
+#define cJSON_DecodeOk 0
+#define cJSON_DecodeSyntaxError 1
+#define cJSON_DecodeMissing 2 /* a value that isn't optional is not in the input */
+#define cJSON_DecodeWrongType 3 /* the value (or a value on its path) has another type than the binding needs */
+#define cJSON_DecodeOverflow 4 /* a string or array doesn't fit its field */
+#define cJSON_DecodeNoMemory 5
+#define cJSON_DecodeInvalidBinding 6 /* a path isn't a JSON pointer or the type is unknown */
+
+typedef struct cJSON_DecodeError
+{
+    int status;
+    size_t binding; /* index of the binding the error is about, binding_count for syntax errors */
+    size_t offset; /* byte offset of the offending value or character in the input */
+} cJSON_DecodeError;
+
+/* Returns true if every binding that isn't optional has been filled. error may be NULL.
+ * On failure the lists allocated so far are released again. */
+CJSON_PUBLIC(cJSON_bool) cJSON_Decode(const char *value, const cJSON_Binding *bindings, size_t binding_count, void *target, cJSON_DecodeError *error);
+CJSON_PUBLIC(cJSON_bool) cJSON_DecodeWithLength(const char *value, size_t buffer_length, const cJSON_Binding *bindings, size_t binding_count, void *target, cJSON_DecodeError *error);
+
+#if CJSON_COMPACT
+/* Compact trees: 24 byte nodes linked by 32 bit indices instead of 64 byte cJSON items (on 64 bit),
+ * and arrays that only hold numbers store them as a plain run of doubles.
+ * The tree is read only and the input can be released after parsing. */
+typedef struct cJSON_Compact cJSON_Compact;
+/* A value in a compact tree, compact is NULL if the value doesn't exist. */
+typedef struct cJSON_CompactItem
+{
+    const cJSON_Compact *compact;
+    unsigned int node;
+    unsigned int element; /* index plus one for numbers in a packed array, 0 otherwise */
+} cJSON_CompactItem;
+
+CJSON_PUBLIC(cJSON_Compact *) cJSON_ParseCompact(const char *value);
+CJSON_PUBLIC(cJSON_Compact *) cJSON_ParseCompactWithLength(const char *value, size_t buffer_length);
+CJSON_PUBLIC(void) cJSON_DeleteCompact(cJSON_Compact *compact);
+/* Bytes used by the tree, including its strings. */
+CJSON_PUBLIC(size_t) cJSON_GetCompactMemory(const cJSON_Compact *compact);
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactRoot(const cJSON_Compact *compact);
+/* Returns one of the cJSON type values, cJSON_Invalid for an item that doesn't exist. */
+CJSON_PUBLIC(int) cJSON_GetCompactType(const cJSON_CompactItem item);
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactObjectItem(const cJSON_CompactItem object, const char *string);
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactObjectItemCaseSensitive(const cJSON_CompactItem object, const char *string);
+CJSON_PUBLIC(int) cJSON_GetCompactArraySize(const cJSON_CompactItem array);
+CJSON_PUBLIC(cJSON_CompactItem) cJSON_GetCompactArrayItem(const cJSON_CompactItem array, int index);
+/* The numbers of an array that only holds numbers, NULL for other arrays. */
+CJSON_PUBLIC(const double *) cJSON_GetCompactNumbers(const cJSON_CompactItem array, int *count);
+CJSON_PUBLIC(double) cJSON_GetCompactNumberValue(const cJSON_CompactItem item);
+CJSON_PUBLIC(const char *) cJSON_GetCompactStringValue(const cJSON_CompactItem item);
+#endif
+
 /* Helper functions for creating and adding items to an object at the same time.
  * They return the added item or NULL on failure. */
 CJSON_PUBLIC(cJSON*) cJSON_AddNullToObject(cJSON * const object, const char * const name);
@@ -299,6 +556,20 @@ CJSON_PUBLIC(char*) cJSON_SetValuestring(cJSON *object, const char *valuestring)
 CJSON_PUBLIC(void *) cJSON_malloc(size_t size);
 CJSON_PUBLIC(void) cJSON_free(void *object);
 
+/* Usage of the calling thread's free list of nodes and short strings. */
+typedef struct cJSON_PoolStats
+{
+    size_t cached_nodes;
+    size_t cached_strings;
+    size_t cached_bytes;
+    size_t reused; /* allocations served from the free list */
+    size_t allocated; /* allocations that had to go to the allocator */
+} cJSON_PoolStats;
+
+CJSON_PUBLIC(void) cJSON_GetPoolStats(cJSON_PoolStats *stats);
+/* Give cached memory of the calling thread back to the allocator until at most keep_bytes are left. */
+CJSON_PUBLIC(void) cJSON_TrimPool(size_t keep_bytes);
+
 #ifdef __cplusplus
 }
 #endif